@@ -0,0 +1,77 @@
+# Copyright (c) 2025, J. D. Mitchell
+#
+# Distributed under the terms of the GPL license version 3.
+#
+# The full license is in the file LICENSE, distributed with this software.
+
+"""Benchmarks for enumerating congruences with ToddCoxeter, KnuthBendix and
+Sims1, using presentations from presentation.examples.
+"""
+
+import pytest
+
+from libsemigroups_pybind11 import (
+    KnuthBendix,
+    Presentation,
+    Sims1,
+    ToddCoxeter,
+    congruence_kind,
+    presentation,
+)
+from libsemigroups_pybind11.presentation import examples
+
+from .common import bench_fresh
+
+
+@pytest.mark.parametrize(
+    "p, expected",
+    [
+        pytest.param(examples.symmetric_group(7), 5040, id="symmetric_group(7)"),
+        pytest.param(
+            examples.full_transformation_monoid(5), 3125, id="full_transformation_monoid(5)"
+        ),
+        pytest.param(examples.partition_monoid(4), 4140, id="partition_monoid(4)"),
+    ],
+)
+def test_todd_coxeter_number_of_classes(benchmark, p, expected):
+    result = bench_fresh(
+        benchmark,
+        lambda tc: tc.number_of_classes(),
+        lambda: (ToddCoxeter(congruence_kind.twosided, p),),
+    )
+    assert result == expected
+
+
+@pytest.mark.parametrize(
+    "p, expected",
+    [
+        pytest.param(examples.symmetric_group(6), 720, id="symmetric_group(6)"),
+        pytest.param(examples.temperley_lieb_monoid(8), 1430, id="temperley_lieb_monoid(8)"),
+    ],
+)
+def test_knuth_bendix_number_of_classes(benchmark, p, expected):
+    result = bench_fresh(
+        benchmark,
+        lambda kb: kb.number_of_classes(),
+        lambda: (KnuthBendix(congruence_kind.twosided, p),),
+    )
+    assert result == expected
+
+
+def test_sims1_number_of_congruences(benchmark):
+    p = Presentation([0, 1, 2])
+    p.contains_empty_word(True)
+    presentation.add_rule(p, [0, 1, 0], [0, 0])
+    presentation.add_rule(p, [2, 2], [0, 0])
+    presentation.add_rule(p, [0, 0, 0], [0, 0])
+    presentation.add_rule(p, [2, 1], [1, 2])
+    presentation.add_rule(p, [2, 0], [0, 0])
+    presentation.add_rule(p, [1, 1], [1])
+    presentation.add_rule(p, [0, 2], [0, 0])
+
+    result = bench_fresh(
+        benchmark,
+        lambda S: S.number_of_congruences(8),
+        lambda: (Sims1(word=list[int]).presentation(p),),
+    )
+    assert result == 175
@@ -0,0 +1,35 @@
+# Copyright (c) 2025, J. D. Mitchell
+#
+# Distributed under the terms of the GPL license version 3.
+#
+# The full license is in the file LICENSE, distributed with this software.
+
+"""Benchmarks for enumerating FroidurePin instances over various element
+types.
+"""
+
+from libsemigroups_pybind11 import BMat8, FroidurePin, Transf
+
+from .common import bench_fresh
+
+
+def test_froidure_pin_transf_size(benchmark):
+    gens = [
+        Transf([1, 0, 2, 3, 4, 5]),
+        Transf([1, 2, 3, 4, 5, 0]),
+        Transf([0, 0, 2, 3, 4, 5]),
+    ]
+    result = bench_fresh(benchmark, lambda S: S.size(), lambda: (FroidurePin(gens),))
+    assert result == 6**6
+
+
+def test_froidure_pin_bmat8_size(benchmark):
+    # The monoid of regular 4 x 4 boolean matrices.
+    gens = [
+        BMat8([[0, 1, 0, 0], [1, 0, 0, 0], [0, 0, 1, 0], [0, 0, 0, 1]]),
+        BMat8([[0, 1, 0, 0], [0, 0, 1, 0], [0, 0, 0, 1], [1, 0, 0, 0]]),
+        BMat8([[1, 0, 0, 0], [1, 1, 0, 0], [0, 0, 1, 0], [0, 0, 0, 1]]),
+        BMat8([[1, 0, 0, 0], [0, 1, 0, 0], [0, 0, 1, 0], [0, 0, 0, 0]]),
+    ]
+    result = bench_fresh(benchmark, lambda S: S.size(), lambda: (FroidurePin(gens),))
+    assert result == 63904
@@ -0,0 +1,102 @@
+# Copyright (c) 2025, J. D. Mitchell
+#
+# Distributed under the terms of the GPL license version 3.
+#
+# The full license is in the file LICENSE, distributed with this software.
+
+"""Benchmarks for the per-call overhead of the bindings, where the C++ work
+done by each call is trivial, so that the timings are dominated by argument
+conversion, CxxWrapper dispatch, and so on.
+"""
+
+from libsemigroups_pybind11 import (
+    FroidurePin,
+    KnuthBendix,
+    ToddCoxeter,
+    Transf,
+    WordGraph,
+    congruence_kind,
+)
+from libsemigroups_pybind11.presentation import examples
+
+_N = 1000
+
+
+def _froidure_pin():
+    S = FroidurePin(Transf([1, 0, 2, 3, 4]), Transf([1, 2, 3, 4, 0]), Transf([0, 0, 2, 3, 4]))
+    S.run()
+    return S
+
+
+def test_froidure_pin_fast_product(benchmark):
+    S = _froidure_pin()
+
+    def fast_products():
+        for i in range(_N):
+            S.fast_product(i, i)
+
+    benchmark(fast_products)
+
+
+def test_froidure_pin_position(benchmark):
+    S = _froidure_pin()
+    x = S[_N]
+
+    def positions():
+        for _ in range(_N):
+            S.position(x)
+
+    benchmark(positions)
+
+
+def test_froidure_pin_iter(benchmark):
+    S = _froidure_pin()
+    assert benchmark(lambda: sum(1 for _ in S)) == 5**5
+
+
+def test_transf_construct(benchmark):
+    imgs = [1, 0, 2, 3, 4] * 10
+
+    def constructions():
+        for _ in range(_N):
+            Transf(imgs)
+
+    benchmark(constructions)
+
+
+def test_todd_coxeter_reduce(benchmark):
+    tc = ToddCoxeter(congruence_kind.twosided, examples.symmetric_group(5))
+    tc.run()
+    w = [0, 1] * 10
+
+    def reductions():
+        for _ in range(_N):
+            tc.reduce(w)
+
+    benchmark(reductions)
+
+
+def test_knuth_bendix_reduce(benchmark):
+    kb = KnuthBendix(congruence_kind.twosided, examples.symmetric_group(5))
+    kb.run()
+    w = [0, 1] * 10
+
+    def reductions():
+        for _ in range(_N):
+            kb.reduce(w)
+
+    benchmark(reductions)
+
+
+def test_word_graph_target(benchmark):
+    wg = WordGraph(_N, 2)
+    for s in range(_N):
+        wg.target(s, 0, (s + 1) % _N)
+        wg.target(s, 1, (s * 7) % _N)
+
+    def targets():
+        for s in range(_N):
+            wg.target(s, 0)
+            wg.target(s, 1)
+
+    benchmark(targets)
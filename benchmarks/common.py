@@ -0,0 +1,16 @@
+# Copyright (c) 2025, J. D. Mitchell
+#
+# Distributed under the terms of the GPL license version 3.
+#
+# The full license is in the file LICENSE, distributed with this software.
+
+"""Helpers used by several of the benchmark files."""
+
+
+def bench_fresh(benchmark, fn, make_args, rounds=5):
+    """Benchmark fn(*make_args()), where make_args is called before, and not
+    timed as part of, every round. This is required when fn runs an
+    algorithm, since otherwise all but the first round would just return a
+    cached result.
+    """
+    return benchmark.pedantic(fn, setup=lambda: (make_args(), {}), rounds=rounds, iterations=1)
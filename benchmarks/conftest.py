@@ -0,0 +1,30 @@
+# Copyright (c) 2025, J. D. Mitchell
+#
+# Distributed under the terms of the GPL license version 3.
+#
+# The full license is in the file LICENSE, distributed with this software.
+
+"""Configuration for the benchmarks, see ``make bench``."""
+
+import pytest
+
+from libsemigroups_pybind11 import ReportGuard
+
+
+def pytest_configure(config):
+    """The ``filterwarnings = ["error"]`` in ``pyproject.toml`` would otherwise
+    turn the warning that ``--benchmark-compare`` issues when ``.benchmarks/``
+    has no previous run (such as the first time ``make bench`` is run) into an
+    error.
+    """
+    config.addinivalue_line(
+        "filterwarnings",
+        "ignore:Can't compare. No benchmark files:pytest_benchmark.logger.PytestBenchmarkWarning",
+    )
+
+
+@pytest.fixture(autouse=True)
+def no_reporting():
+    """Reporting is disabled so that printing doesn't distort the timings."""
+    guard = ReportGuard(False)  # pylint: disable=unused-variable
+    yield
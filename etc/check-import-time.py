@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+"""
+This module measures how long "import libsemigroups_pybind11" takes, and exits
+with a non-zero status if the median over a number of fresh interpreters
+exceeds a budget.
+"""
+
+import argparse
+import statistics
+import subprocess
+import sys
+
+_IMPORT = "import libsemigroups_pybind11"
+
+
+def __parse_args():
+    parser = argparse.ArgumentParser(prog="check-import-time.py", usage="%(prog)s [options]")
+    parser.add_argument(
+        "--budget",
+        type=float,
+        default=1.0,
+        help="the maximum median import time in seconds (default: 1.0)",
+    )
+    parser.add_argument(
+        "--repeats",
+        type=int,
+        default=5,
+        help="the number of fresh interpreters to time the import in (default: 5)",
+    )
+    parser.add_argument(
+        "--verbose",
+        action="store_true",
+        help="print the 10 slowest modules imported, as reported by -X importtime",
+    )
+    return parser.parse_args()
+
+
+def __time_import() -> tuple[float, list[tuple[int, str]]]:
+    # -X importtime writes one line per module to stderr, in the form
+    # "import time: self [us] | cumulative | imported package"
+    result = subprocess.run(
+        [sys.executable, "-X", "importtime", "-c", _IMPORT],
+        capture_output=True,
+        text=True,
+        check=True,
+    )
+    total, modules = 0, []
+    for line in result.stderr.splitlines():
+        if not line.startswith("import time:") or "[us]" in line:
+            continue
+        _, cumulative, name = line[len("import time:") :].split("|")
+        modules.append((int(cumulative), name.strip()))
+        if name.strip() == "libsemigroups_pybind11":
+            total = int(cumulative)
+    return total / 1e6, modules
+
+
+def main():
+    args = __parse_args()
+    times = []
+    for _ in range(args.repeats):
+        seconds, modules = __time_import()
+        times.append(seconds)
+    median = statistics.median(times)
+
+    print(f'"{_IMPORT}" took {median:.3f}s (median of {args.repeats}), budget {args.budget:.3f}s')
+    if args.verbose:
+        for cumulative, name in sorted(modules, reverse=True)[:10]:
+            print(f"  {cumulative / 1e6:.3f}s  {name}")
+    if median > args.budget:
+        print("import time budget exceeded!")
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -70,6 +70,10 @@ acting on the seeds of the action by the generators of the action until no
 further points can be found, or :any:`Runner.stopped` returns
 ``True``.  This is achieved by performing a breadth first search.
 
+The breadth first search of any single action is serial. However, the global
+interpreter lock is released by every function that enumerates an action, and
+so independent actions can be enumerated in parallel using Python threads.
+
 In this documentation we refer to:
 
 * ``Element`` -- the type of the elements of the underlying semigroup
@@ -273,11 +277,16 @@ Checks if the :py:class:`Action` contains any points.
 
       thing.def("size",
                 &Action_::size,
+                py::call_guard<py::gil_scoped_release>(),
                 R"pbdoc(
 :sig=(self: Action) -> int:
 
 Returns the size of the fully enumerated action.
 
+This function triggers a full enumeration of the action. The global interpreter
+lock is released while the action is enumerated, and so several actions can be
+enumerated at the same time in different Python threads.
+
 :returns:
    The size of the action, a value of type ``int``.
 
@@ -348,6 +357,7 @@ cached, and not recomputed every time one of these functions is called.
       thing.def("multiplier_from_scc_root",
                 &Action_::multiplier_from_scc_root,
                 py::arg("pos"),
+                py::call_guard<py::gil_scoped_release>(),
                 R"pbdoc(
 :sig=(self: Action, pos: int) -> Element:
 
@@ -375,6 +385,7 @@ containing ``self[pos]``, then after calling ``Func(res, r, x)`` the point
       thing.def("multiplier_to_scc_root",
                 &Action_::multiplier_to_scc_root,
                 py::arg("pos"),
+                py::call_guard<py::gil_scoped_release>(),
                 R"pbdoc(
 :sig=(self: Action, pos: int) -> Element:
 
@@ -404,6 +415,7 @@ of the strongly connected component containing ``self[pos]``.
             return self.root_of_scc(x);
           },
           py::arg("x"),
+          py::call_guard<py::gil_scoped_release>(),
           R"pbdoc(
 :sig=(self: Action, x: Point) -> Point:
 
@@ -427,6 +439,7 @@ Returns the root point of a strongly connected component containing a
           "root_of_scc",
           [](Action_& self, index_type pos) { return self.root_of_scc(pos); },
           py::arg("pos"),
+          py::call_guard<py::gil_scoped_release>(),
           R"pbdoc(
 :sig=(self: Action, pos: int) -> Point:
 
@@ -446,6 +459,7 @@ Returns the root point of a strongly connected component.
 )pbdoc");
       thing.def("word_graph",
                 &Action_::word_graph,
+                py::call_guard<py::gil_scoped_release>(),
                 R"pbdoc(
 :sig=(self: Action) -> WordGraph:
 
@@ -463,6 +477,7 @@ Returns the word graph of the completely enumerated action.
 )pbdoc");
       thing.def("scc",
                 &Action_::scc,
+                py::call_guard<py::gil_scoped_release>(),
                 R"pbdoc(
 :sig=(self: Action) -> Gabow:
 
@@ -17,10 +17,15 @@
 //
 
 // C++ stl headers....
-#include <string>  // for string
+#include <algorithm>  // for max, sort
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint64_t
+#include <string>     // for string
+#include <vector>     // for vector
 
 // libsemigroups....
 #include <libsemigroups/aho-corasick.hpp>  // for AhoCorasick, AhoCorasick::...
+#include <libsemigroups/constants.hpp>     // for UNDEFINED
 #include <libsemigroups/dot.hpp>           // for Dot
 #include <libsemigroups/types.hpp>         // for word_type
 
@@ -28,16 +33,85 @@
 #include <pybind11/cast.h>           // for arg
 #include <pybind11/detail/common.h>  // for const_, overload_cast, ove...
 #include <pybind11/detail/descr.h>   // for operator+
+#include <pybind11/numpy.h>          // for array_t
 #include <pybind11/pybind11.h>       // for class_, init, module
 #include <pybind11/pytypes.h>        // for sequence, str_attr_accessor
 #include <pybind11/stl.h>            // for std::vector conversion
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_aho_corasick
+#include "main.hpp"          // for init_aho_corasick
+#include "packed-words.hpp"  // for packed_letters, packed_offsets
+#include "threads.hpp"       // for run_in_threads
 
 namespace libsemigroups {
   namespace py = pybind11;
 
+  namespace {
+    // A read-only snapshot of the suffix links of an AhoCorasick, together
+    // with the nearest terminal node on the suffix link path from every node
+    // (its "output link"). The suffix links of an AhoCorasick are computed
+    // lazily, and so AhoCorasick::traverse cannot safely be called from
+    // several threads at once; once this snapshot is constructed, searching
+    // only reads from the AhoCorasick and the snapshot.
+    class AhoCorasickSearcher {
+      using index_type = AhoCorasick::index_type;
+
+      AhoCorasick const&      _ac;
+      std::vector<index_type> _link;
+      std::vector<index_type> _output;
+
+     public:
+      // Must be called while holding the GIL
+      explicit AhoCorasickSearcher(AhoCorasick& ac)
+          : _ac(ac), _link(), _output() {
+        std::vector<index_type> nodes(ac.cbegin_nodes(), ac.cend_nodes());
+        // Suffix links point to nodes of smaller height, so processing the
+        // nodes in order of height means output links are set in order.
+        std::sort(nodes.begin(), nodes.end(), [&ac](auto x, auto y) {
+          return ac.height(x) < ac.height(y);
+        });
+        size_t const n = *std::max_element(nodes.begin(), nodes.end()) + 1;
+        _link.assign(n, AhoCorasick::root);
+        _output.assign(n, static_cast<index_type>(UNDEFINED));
+        for (auto v : nodes) {
+          if (v == AhoCorasick::root) {
+            // Matches of the empty word are not reported
+            continue;
+          }
+          _link[v]   = ac.suffix_link(v);
+          _output[v] = ac.node_no_checks(v).is_terminal() ? v
+                                                          : _output[_link[v]];
+        }
+      }
+
+      index_type traverse(index_type current, letter_type a) const {
+        index_type next = _ac.child_no_checks(current, a);
+        while (next == UNDEFINED && current != AhoCorasick::root) {
+          current = _link[current];
+          next    = _ac.child_no_checks(current, a);
+        }
+        return next == UNDEFINED ? AhoCorasick::root : next;
+      }
+
+      // Calls f(j, t) for every j in [first, last) and every terminal node t
+      // whose signature is a suffix of letters[first:j + 1].
+      template <typename Func>
+      void search(uint32_t const* letters,
+                  uint64_t        first,
+                  uint64_t        last,
+                  Func&&          f) const {
+        index_type current = AhoCorasick::root;
+        for (uint64_t j = first; j < last; ++j) {
+          current = traverse(current, letters[j]);
+          for (index_type t = _output[current]; t != UNDEFINED;
+               t            = _output[_link[t]]) {
+            f(j, t);
+          }
+        }
+      }
+    };
+  }  // namespace
+
   void init_aho_corasick(py::module& m) {
     using index_type = AhoCorasick::index_type;
     py::class_<AhoCorasick> thing(m,
@@ -517,6 +591,190 @@ Construct a :any:`Dot` object representing the trie of *ac*.
 
 :returns: A :any:`Dot` object representing *ac*.
 :rtype: Dot
+)pbdoc");
+
+    m.def(
+        "aho_corasick_count_matches",
+        [](AhoCorasick&          ac,
+           packed_letters const& letters,
+           packed_offsets const& offsets,
+           size_t                number_of_threads) {
+          size_t const          n = throw_if_bad_packed_words(letters, offsets);
+          AhoCorasickSearcher   searcher(ac);
+          py::array_t<uint64_t> result(n);
+          uint32_t const*       l   = letters.data();
+          uint64_t const*       o   = offsets.data();
+          uint64_t*             out = result.mutable_data();
+          {
+            py::gil_scoped_release release;
+            run_in_threads(
+                n, number_of_threads, [&](size_t first, size_t last) {
+                  for (size_t i = first; i < last; ++i) {
+                    uint64_t count = 0;
+                    searcher.search(
+                        l, o[i], o[i + 1], [&count](uint64_t, auto) {
+                          ++count;
+                        });
+                    out[i] = count;
+                  }
+                });
+          }
+          return result;
+        },
+        py::arg("ac"),
+        py::arg("letters"),
+        py::arg("offsets"),
+        py::arg("number_of_threads") = 1,
+        R"pbdoc(
+:sig=(ac: AhoCorasick, letters: numpy.ndarray, offsets: numpy.ndarray, number_of_threads: int = 1) -> numpy.ndarray:
+
+Count the occurrences of the words in a trie in each of a batch of texts.
+
+The texts are passed as a packed pair of arrays *letters* and *offsets*, so
+that the ``i``-th text is ``letters[offsets[i]:offsets[i + 1]]``; such arrays
+are returned by, for example, :any:`random_words`. An occurrence of a word
+``w`` in the trie of *ac* is counted for every position in a text where ``w``
+ends, and so overlapping occurrences are counted separately. The empty word is
+never counted. The texts are searched without holding the GIL using
+*number_of_threads* threads.
+
+:param ac: the trie containing the words to search for.
+:type ac: AhoCorasick
+
+:param letters: the letters of the texts.
+:type letters: numpy.ndarray
+
+:param offsets: the offsets of the texts in *letters*.
+:type offsets: numpy.ndarray
+
+:param number_of_threads: the number of threads to use (default: ``1``).
+:type number_of_threads: int
+
+:returns:
+  An array of ``numpy.uint64`` whose ``i``-th entry is the number of
+  occurrences of words in the trie of *ac* in the ``i``-th text.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError:
+  if *letters* and *offsets* are not 1-dimensional, or *offsets* is not
+  non-decreasing from ``0`` to ``len(letters)``.
+
+.. doctest::
+
+   >>> import numpy as np
+   >>> from libsemigroups_pybind11 import AhoCorasick, aho_corasick
+   >>> ac = AhoCorasick()
+   >>> for w in ([0, 1], [1, 1], [1]):
+   ...     _ = aho_corasick.add_word(ac, w)
+   >>> letters = np.array([0, 1, 1, 1, 0, 0], dtype=np.uint32)
+   >>> offsets = np.array([0, 4, 6], dtype=np.uint64)
+   >>> aho_corasick.count_matches(ac, letters, offsets)
+   array([6, 0], dtype=uint64)
+)pbdoc");
+
+    m.def(
+        "aho_corasick_search_all",
+        [](AhoCorasick&          ac,
+           packed_letters const& letters,
+           packed_offsets const& offsets,
+           size_t                number_of_threads) {
+          size_t const        n = throw_if_bad_packed_words(letters, offsets);
+          AhoCorasickSearcher searcher(ac);
+          uint32_t const*     l = letters.data();
+          uint64_t const*     o = offsets.data();
+
+          // Each thread fills its own matches, which are concatenated in
+          // order, so that the result does not depend on number_of_threads.
+          struct Matches {
+            std::vector<uint64_t> text, end, node;
+          };
+          number_of_threads = std::max(
+              size_t(1), std::min(number_of_threads, std::max(n, size_t(1))));
+          // This is the same partition of [0, n) used by run_in_threads
+          size_t const chunk = std::max(
+              size_t(1), (n + number_of_threads - 1) / number_of_threads);
+          std::vector<Matches> matches(number_of_threads);
+          {
+            py::gil_scoped_release release;
+            run_in_threads(
+                n, number_of_threads, [&](size_t first, size_t last) {
+                  Matches& mine = matches[first / chunk];
+                  for (size_t i = first; i < last; ++i) {
+                    searcher.search(
+                        l, o[i], o[i + 1], [&](uint64_t j, auto t) {
+                          mine.text.push_back(i);
+                          mine.end.push_back(j + 1 - o[i]);
+                          mine.node.push_back(t);
+                        });
+                  }
+                });
+          }
+          size_t total = 0;
+          for (auto const& mine : matches) {
+            total += mine.text.size();
+          }
+          py::array_t<uint64_t> text(total), end(total), node(total);
+          size_t                k = 0;
+          for (auto const& mine : matches) {
+            std::copy(
+                mine.text.begin(), mine.text.end(), text.mutable_data() + k);
+            std::copy(
+                mine.end.begin(), mine.end.end(), end.mutable_data() + k);
+            std::copy(
+                mine.node.begin(), mine.node.end(), node.mutable_data() + k);
+            k += mine.text.size();
+          }
+          return py::make_tuple(text, end, node);
+        },
+        py::arg("ac"),
+        py::arg("letters"),
+        py::arg("offsets"),
+        py::arg("number_of_threads") = 1,
+        R"pbdoc(
+:sig=(ac: AhoCorasick, letters: numpy.ndarray, offsets: numpy.ndarray, number_of_threads: int = 1) -> tuple[numpy.ndarray, numpy.ndarray, numpy.ndarray]:
+
+Find all occurrences of the words in a trie in a batch of texts.
+
+The texts are passed as in :any:`count_matches`. This function returns a tuple
+``(text, end, node)`` of arrays of ``numpy.uint64`` of equal length, with one
+entry for every occurrence of a (non-empty) word in the trie of *ac* in one of
+the texts: ``text[k]`` is the index of the text, ``end[k]`` is the position in
+that text immediately after the occurrence, and ``node[k]`` is the index of
+the terminal node whose signature is the word that occurs. The word that
+occurs therefore begins at position ``end[k] - ac.height(node[k])``. The
+occurrences are ordered by ``text``, then by ``end``, and then by decreasing
+length, regardless of *number_of_threads*.
+
+:param ac: the trie containing the words to search for.
+:type ac: AhoCorasick
+
+:param letters: the letters of the texts.
+:type letters: numpy.ndarray
+
+:param offsets: the offsets of the texts in *letters*.
+:type offsets: numpy.ndarray
+
+:param number_of_threads: the number of threads to use (default: ``1``).
+:type number_of_threads: int
+
+:returns: The tuple ``(text, end, node)``.
+:rtype: tuple[numpy.ndarray, numpy.ndarray, numpy.ndarray]
+
+:raises LibsemigroupsError:
+  if *letters* and *offsets* are not 1-dimensional, or *offsets* is not
+  non-decreasing from ``0`` to ``len(letters)``.
+
+.. doctest::
+
+   >>> import numpy as np
+   >>> from libsemigroups_pybind11 import AhoCorasick, aho_corasick
+   >>> ac = AhoCorasick()
+   >>> n = aho_corasick.add_word(ac, [1, 1])
+   >>> letters = np.array([0, 1, 1, 1], dtype=np.uint32)
+   >>> offsets = np.array([0, 4], dtype=np.uint64)
+   >>> text, end, node = aho_corasick.search_all(ac, letters, offsets)
+   >>> end.tolist(), node.tolist() == [n, n]
+   ([3, 4], True)
 )pbdoc");
   }  // init_aho_corasick
 
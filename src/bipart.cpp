@@ -16,10 +16,20 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
+// C++ stl headers....
+#include <algorithm>  // for copy, fill
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint32_t
+#include <numeric>    // for iota
+#include <vector>     // for vector
+
 // libsemigroups headers
 #include <libsemigroups/bipart.hpp>
+#include <libsemigroups/constants.hpp>  // for UNDEFINED
+#include <libsemigroups/exception.hpp>  // for LIBSEMIGROUPS_EXCEPTION
 
 // pybind11....
+#include <pybind11/numpy.h>  // for array_t
 #include <pybind11/operators.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -30,6 +40,89 @@
 namespace libsemigroups {
   namespace py = pybind11;
 
+  namespace {
+    // A collection of k bipartitions of degree n is stored as a numpy array
+    // of shape (k, 2n) and dtype uint32, whose i-th row is the blocks lookup
+    // of the i-th bipartition, i.e. the list returned by its iterator.
+    using bipartition_array
+        = py::array_t<uint32_t, py::array::c_style | py::array::forcecast>;
+
+    size_t bipartition_array_degree(bipartition_array const& a) {
+      if (a.ndim() != 2 || a.shape(1) % 2 != 0) {
+        LIBSEMIGROUPS_EXCEPTION("expected an array of shape (k, 2n), found "
+                                "an array with {} dimensions and size {}",
+                                a.ndim(),
+                                a.size());
+      }
+      return a.shape(1) / 2;
+    }
+
+    // Throws if the i-th row of length m is not a blocks lookup, i.e. if
+    // some value j > 0 occurs before j - 1, and returns the number of blocks.
+    uint32_t throw_if_bad_lookup(uint32_t const* row, size_t m, size_t i) {
+      uint32_t next = 0;
+      for (size_t j = 0; j < m; ++j) {
+        if (row[j] > next) {
+          LIBSEMIGROUPS_EXCEPTION("invalid blocks lookup in row {}, expected "
+                                  "value at most {} in position {}, found {}",
+                                  i,
+                                  next,
+                                  j,
+                                  row[j]);
+        } else if (row[j] == next) {
+          ++next;
+        }
+      }
+      return next;
+    }
+
+    uint32_t find_root(std::vector<uint32_t>& parent, uint32_t u) {
+      while (parent[u] != u) {
+        parent[u] = parent[parent[u]];
+        u         = parent[u];
+      }
+      return u;
+    }
+
+    // Must be called without the GIL. Computes the products of the k
+    // bipartitions of degree n in x and y, and stores their blocks lookups
+    // in out. The same union-find workspace is used for every product, so
+    // that nothing is allocated inside the loop.
+    void bipartition_product_batch(uint32_t const* x,
+                                   uint32_t const* y,
+                                   uint32_t*       out,
+                                   size_t          k,
+                                   size_t          n) {
+      std::vector<uint32_t> parent(4 * n, 0);
+      std::vector<uint32_t> label(4 * n, 0);
+      for (size_t i = 0; i < k; ++i, x += 2 * n, y += 2 * n, out += 2 * n) {
+        uint32_t const nx = throw_if_bad_lookup(x, 2 * n, i);
+        uint32_t const ny = throw_if_bad_lookup(y, 2 * n, i);
+        // The blocks of x are [0, nx) and those of y are [nx, nx + ny), and
+        // the bottom of x is glued to the top of y.
+        std::iota(parent.begin(), parent.begin() + nx + ny, 0);
+        for (size_t j = 0; j < n; ++j) {
+          uint32_t u = find_root(parent, x[n + j]);
+          uint32_t v = find_root(parent, nx + y[j]);
+          if (u < v) {
+            parent[v] = u;
+          } else if (v < u) {
+            parent[u] = v;
+          }
+        }
+        std::fill(label.begin(), label.begin() + nx + ny, UNDEFINED);
+        uint32_t next = 0;
+        for (size_t j = 0; j < 2 * n; ++j) {
+          uint32_t r = find_root(parent, j < n ? x[j] : nx + y[j]);
+          if (label[r] == UNDEFINED) {
+            label[r] = next++;
+          }
+          out[j] = label[r];
+        }
+      }
+    }
+  }  // namespace
+
   void init_blocks(py::module& m) {
     py::class_<Blocks> thing(m,
                              "Blocks",
@@ -663,6 +756,148 @@ is not uniform.
 
 :returns: A random :any:`Bipartition`.
 :rtype: Bipartition
+)pbdoc");
+
+    ////////////////////////////////////////////////////////////////////////
+    // Arrays of bipartitions
+    ////////////////////////////////////////////////////////////////////////
+
+    m.def(
+        "bipartition_to_array",
+        [](std::vector<Bipartition> const& xs) {
+          size_t const n = xs.empty() ? 0 : xs[0].degree();
+          py::array_t<uint32_t> result(std::vector<py::ssize_t>(
+              {static_cast<py::ssize_t>(xs.size()),
+               static_cast<py::ssize_t>(2 * n)}));
+          uint32_t* out = result.mutable_data();
+          for (size_t i = 0; i < xs.size(); ++i, out += 2 * n) {
+            if (xs[i].degree() != n) {
+              LIBSEMIGROUPS_EXCEPTION("expected every bipartition to have "
+                                      "degree {}, found degree {} in position "
+                                      "{}",
+                                      n,
+                                      xs[i].degree(),
+                                      i);
+            }
+            std::copy(xs[i].cbegin(), xs[i].cend(), out);
+          }
+          return result;
+        },
+        py::arg("xs"),
+        R"pbdoc(
+:sig=(xs: list[Bipartition]) -> numpy.ndarray:
+
+Returns a flat array containing the blocks lookups of some bipartitions.
+
+This function returns a numpy array of shape ``(k, 2n)`` and dtype
+``numpy.uint32`` whose ``i``-th row is ``list(xs[i].iterator())``, where ``k``
+is ``len(xs)`` and ``n`` is the degree of the bipartitions in *xs*. Such
+arrays store the bipartitions contiguously, and can be used with
+:any:`product_batch` without constructing any :any:`Bipartition` objects.
+
+:param xs: the bipartitions.
+:type xs: list[Bipartition]
+
+:returns: The array of blocks lookups.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError:
+  if the bipartitions in *xs* do not all have the same degree.
+)pbdoc");
+
+    m.def(
+        "bipartition_from_array",
+        [](bipartition_array const& a) {
+          size_t const             n  = bipartition_array_degree(a);
+          uint32_t const*          in = a.data();
+          std::vector<Bipartition> result;
+          result.reserve(a.shape(0));
+          for (py::ssize_t i = 0; i < a.shape(0); ++i, in += 2 * n) {
+            result.push_back(
+                make<Bipartition>(std::vector<uint32_t>(in, in + 2 * n)));
+          }
+          return result;
+        },
+        py::arg("a"),
+        R"pbdoc(
+:sig=(a: numpy.ndarray) -> list[Bipartition]:
+
+Returns the bipartitions whose blocks lookups are the rows of an array.
+
+This function is the inverse of :any:`to_array`.
+
+:param a: an array of shape ``(k, 2n)`` of blocks lookups.
+:type a: numpy.ndarray
+
+:returns: The list of bipartitions.
+:rtype: list[Bipartition]
+
+:raises LibsemigroupsError: if *a* does not have shape ``(k, 2n)``.
+
+:raises LibsemigroupsError:
+  if any row of *a* is not a valid blocks lookup, see :any:`Bipartition`.
+)pbdoc");
+
+    m.def(
+        "bipartition_product_batch",
+        [](bipartition_array const& a, bipartition_array const& b) {
+          size_t const n = bipartition_array_degree(a);
+          if (b.ndim() != 2 || a.shape(0) != b.shape(0)
+              || a.shape(1) != b.shape(1)) {
+            LIBSEMIGROUPS_EXCEPTION(
+                "expected the arguments to have the same shape, found "
+                "arrays of sizes {} and {}",
+                a.size(),
+                b.size());
+          }
+          size_t const          k = a.shape(0);
+          py::array_t<uint32_t> result(
+              std::vector<py::ssize_t>({a.shape(0), a.shape(1)}));
+          uint32_t const* x   = a.data();
+          uint32_t const* y   = b.data();
+          uint32_t*       out = result.mutable_data();
+          {
+            py::gil_scoped_release release;
+            bipartition_product_batch(x, y, out, k, n);
+          }
+          return result;
+        },
+        py::arg("a"),
+        py::arg("b"),
+        R"pbdoc(
+:sig=(a: numpy.ndarray, b: numpy.ndarray) -> numpy.ndarray:
+
+Returns the products of two arrays of bipartitions.
+
+The arrays *a* and *b* must have the same shape ``(k, 2n)``, and contain the
+blocks lookups of bipartitions of degree ``n`` as returned by
+:any:`to_array`. The products are computed without holding the GIL, and
+without constructing any :any:`Bipartition` objects; the same workspace is
+reused for every product.
+
+:param a: the left hand factors.
+:type a: numpy.ndarray
+
+:param b: the right hand factors.
+:type b: numpy.ndarray
+
+:returns:
+  An array of shape ``(k, 2n)`` whose ``i``-th row is the blocks lookup of
+  the product of the bipartitions defined by ``a[i]`` and ``b[i]``.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError: if *a* and *b* do not have the same shape.
+
+:raises LibsemigroupsError:
+  if any row of *a* or *b* is not a valid blocks lookup.
+
+.. doctest::
+
+   >>> from libsemigroups_pybind11 import Bipartition, bipartition
+   >>> x = Bipartition([[1, -1], [2, -2, 3], [-3]])
+   >>> a = bipartition.to_array([x, x])
+   >>> bipartition.from_array(bipartition.product_batch(a, a)) == [x * x] * 2
+   True
 )pbdoc");
   }  // init_bipart
 
@@ -20,10 +20,17 @@
 // TODO
 // * iwyu
 
+#include <algorithm>  // for equal
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint64_t
+#include <vector>     // for vector
+
 // libsemigroups headers
 #include <libsemigroups/bmat8.hpp>
+#include <libsemigroups/exception.hpp>  // for LIBSEMIGROUPS_EXCEPTION
 
 // pybind11....
+#include <pybind11/numpy.h>  // for array_t
 #include <pybind11/operators.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -34,6 +41,36 @@
 namespace libsemigroups {
   namespace py = pybind11;
 
+  namespace {
+    // An array of BMat8s is passed to and from Python as a numpy array of
+    // uint64, where each entry is the value of BMat8::to_int.
+    using bmat8_array
+        = py::array_t<uint64_t, py::array::c_style | py::array::forcecast>;
+
+    // Returns the array whose i-th entry is f(BMat8(a[i])), the result has
+    // the same shape as a, and f is applied with the GIL released.
+    template <typename Func>
+    py::array_t<uint64_t> bmat8_map(bmat8_array const& a, Func&& f) {
+      py::array_t<uint64_t> result(std::vector<py::ssize_t>(
+          a.shape(), a.shape() + a.ndim()));
+      uint64_t const* in  = a.data();
+      uint64_t*       out = result.mutable_data();
+      size_t const    n   = a.size();
+      {
+        py::gil_scoped_release release;
+        for (size_t i = 0; i < n; ++i) {
+          out[i] = f(BMat8(in[i]));
+        }
+      }
+      return result;
+    }
+
+    template <typename Func>
+    py::array_t<uint64_t> bmat8_map_to_int(bmat8_array const& a, Func&& f) {
+      return bmat8_map(a, [&f](BMat8 const& x) { return f(x).to_int(); });
+    }
+  }  // namespace
+
   void init_bmat8(py::module& m) {
     py::class_<BMat8> thing(m,
                             "BMat8",
@@ -605,5 +642,146 @@ appropriate dimension.
    >>> sum(1 for x in range(100000) if bmat8.is_regular_element(BMat8(x)))
    97996
 )pbdoc");
+
+    ////////////////////////////////////////////////////////////////////////
+    // Batched functions
+    ////////////////////////////////////////////////////////////////////////
+
+    m.def(
+        "bmat8_product_batch",
+        [](bmat8_array const& a, bmat8_array const& b) {
+          if (a.ndim() != b.ndim()
+              || !std::equal(a.shape(), a.shape() + a.ndim(), b.shape())) {
+            LIBSEMIGROUPS_EXCEPTION(
+                "expected the arguments to have the same shape, found "
+                "arrays of sizes {} and {}",
+                a.size(),
+                b.size());
+          }
+          py::array_t<uint64_t> result(std::vector<py::ssize_t>(
+              a.shape(), a.shape() + a.ndim()));
+          uint64_t const* x   = a.data();
+          uint64_t const* y   = b.data();
+          uint64_t*       out = result.mutable_data();
+          size_t const    n   = a.size();
+          {
+            py::gil_scoped_release release;
+            for (size_t i = 0; i < n; ++i) {
+              out[i] = (BMat8(x[i]) * BMat8(y[i])).to_int();
+            }
+          }
+          return result;
+        },
+        py::arg("a"),
+        py::arg("b"),
+        R"pbdoc(
+:sig=(a: numpy.ndarray, b: numpy.ndarray) -> numpy.ndarray:
+Returns the products of two arrays of :any:`BMat8` objects.
+
+The arrays *a* and *b* contain the values of :any:`BMat8.to_int` of the
+matrices being multiplied, and are converted to arrays of ``numpy.uint64`` if
+necessary. The products are computed without holding the GIL, and without
+constructing any :any:`BMat8` objects in Python.
+
+:param a: the left hand factors.
+:type a: numpy.ndarray
+
+:param b: the right hand factors.
+:type b: numpy.ndarray
+
+:returns:
+  An array of ``numpy.uint64`` of the same shape as *a* and *b* whose ``i``-th
+  entry is ``(BMat8(a[i]) * BMat8(b[i])).to_int()``.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError: if *a* and *b* do not have the same shape.
+
+.. doctest::
+
+   >>> import numpy as np
+   >>> from libsemigroups_pybind11 import BMat8, bmat8
+   >>> x = BMat8([[0, 1], [1, 0]])
+   >>> a = np.array([x.to_int(), bmat8.one(2).to_int()], dtype=np.uint64)
+   >>> [BMat8(int(y)) for y in bmat8.product_batch(a, a)] == [x * x, bmat8.one(2)]
+   True
+)pbdoc");
+
+    m.def(
+        "bmat8_transpose_batch",
+        [](bmat8_array const& a) {
+          return bmat8_map_to_int(
+              a, [](BMat8 const& x) { return bmat8::transpose(x); });
+        },
+        py::arg("a"),
+        R"pbdoc(
+:sig=(a: numpy.ndarray) -> numpy.ndarray:
+Returns the transposes of an array of :any:`BMat8` objects.
+
+The array *a* contains the values of :any:`BMat8.to_int` of the matrices, as
+in :any:`product_batch`.
+
+:param a: the matrices.
+:type a: numpy.ndarray
+
+:returns:
+  An array of ``numpy.uint64`` of the same shape as *a* whose ``i``-th entry
+  is ``bmat8.transpose(BMat8(a[i])).to_int()``.
+:rtype: numpy.ndarray
+)pbdoc");
+
+    m.def(
+        "bmat8_row_space_basis_batch",
+        [](bmat8_array const& a) {
+          return bmat8_map_to_int(
+              a, [](BMat8 const& x) { return bmat8::row_space_basis(x); });
+        },
+        py::arg("a"),
+        R"pbdoc(
+:sig=(a: numpy.ndarray) -> numpy.ndarray:
+Returns the canonical row space bases of an array of :any:`BMat8` objects.
+
+The array *a* contains the values of :any:`BMat8.to_int` of the matrices, as
+in :any:`product_batch`. Two matrices have the same row space if and only if
+the corresponding entries of the returned array are equal.
+
+:param a: the matrices.
+:type a: numpy.ndarray
+
+:returns:
+  An array of ``numpy.uint64`` of the same shape as *a* whose ``i``-th entry
+  is ``bmat8.row_space_basis(BMat8(a[i])).to_int()``.
+:rtype: numpy.ndarray
+)pbdoc");
+
+    m.def(
+        "bmat8_row_space_size_batch",
+        [](bmat8_array const& a) {
+          return bmat8_map(
+              a, [](BMat8 const& x) { return bmat8::row_space_size(x); });
+        },
+        py::arg("a"),
+        R"pbdoc(
+:sig=(a: numpy.ndarray) -> numpy.ndarray:
+Returns the sizes of the row spaces of an array of :any:`BMat8` objects.
+
+The array *a* contains the values of :any:`BMat8.to_int` of the matrices, as
+in :any:`product_batch`.
+
+:param a: the matrices.
+:type a: numpy.ndarray
+
+:returns:
+  An array of ``numpy.uint64`` of the same shape as *a* whose ``i``-th entry
+  is ``bmat8.row_space_size(BMat8(a[i]))``.
+:rtype: numpy.ndarray
+
+.. doctest::
+
+   >>> import numpy as np
+   >>> from libsemigroups_pybind11 import BMat8, bmat8
+   >>> x = BMat8([[1, 0, 0], [0, 1, 1], [0, 1, 0]])
+   >>> bmat8.row_space_size_batch(np.array([x.to_int()] * 3, dtype=np.uint64))
+   array([6, 6, 6], dtype=uint64)
+)pbdoc");
   }  // init_bmat8
 }  // namespace libsemigroups
@@ -18,7 +18,12 @@
 
 #include "cong-common.hpp"  // for doc
 
-#include <string_view>
+#include <cstddef>      // for size_t
+#include <memory>       // for make_shared, shared_ptr
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <utility>      // for declval, pair, move
+#include <vector>       // for vector
 
 // libsemigroups headers
 #include <libsemigroups/cong.hpp>
@@ -30,12 +35,14 @@
 #include <libsemigroups/detail/cong-common-class.hpp>
 
 // pybind11....
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
 #include "constants.hpp"
-#include "main.hpp"  // for init_detail_cong_common
+#include "main.hpp"          // for init_detail_cong_common
+#include "packed-words.hpp"  // for packed_letters, pack_words, unpack_words
 
 namespace libsemigroups {
   namespace py = pybind11;
@@ -85,6 +92,25 @@ namespace libsemigroups {
                      "var"_a    = extra_doc.var);
       return result.c_str();
     }
+
+    // Returns a numpy array whose i-th entry indicates whether or not
+    // pairs[i] belongs to the congruence represented by self. Must be called
+    // while holding the GIL, which is released while checking the pairs.
+    template <typename Thing, typename Word>
+    py::array_t<bool> contains_pairs(
+        Thing&                                    self,
+        std::vector<std::pair<Word, Word>> const& pairs) {
+      py::array_t<bool> result(pairs.size());
+      bool*             data = result.mutable_data();
+      {
+        py::gil_scoped_release release;
+        for (size_t i = 0; i < pairs.size(); ++i) {
+          data[i] = congruence_common::contains(
+              self, pairs[i].first, pairs[i].second);
+        }
+      }
+      return result;
+    }
   }  // namespace
 
   ////////////////////////////////////////////////////////////////////////
@@ -419,12 +445,14 @@ Copy a :any:`{name}` object.
     thing.def(
         "number_of_classes",
         [](Thing& self) { return from_int(self.number_of_classes()); },
+        py::call_guard<py::gil_scoped_release>(),
         make_doc(R"pbdoc(
 :sig=(self: {name}) -> int | PositiveInfinity:
 {only_document_once}
 
 Compute the number of classes in the congruence. This function computes the
 number of classes in the congruence represented by a :any:`{name}` instance.
+The global interpreter lock is released while this function runs.
 
 {detail}
 
@@ -647,6 +675,7 @@ contained in the congruence, but that this is not currently known.
         },
         py::arg("u"),
         py::arg("v"),
+        py::call_guard<py::gil_scoped_release>(),
         make_doc(R"pbdoc(
 :sig=(self: {name}, u: list[int] | str, v: list[int] | str) -> bool:
 {only_document_once}
@@ -654,7 +683,8 @@ contained in the congruence, but that this is not currently known.
 Check containment of a pair of words.
 
 This function checks whether or not the words *u* and *v* are contained in the
-congruence represented by a :py:class:`{name}` instance.
+congruence represented by a :py:class:`{name}` instance. The global interpreter
+lock is released while this function runs.
 
 :param u: the first word.
 :type u: list[int] | str
@@ -793,6 +823,7 @@ normal form for the input word *w*.
           return congruence_common::reduce(self, w);
         },
         py::arg("w"),
+        py::call_guard<py::gil_scoped_release>(),
         make_doc(R"pbdoc(
 :sig=(self: {name}, w: list[int] | str) -> list[int] | str:
 {only_document_once}
@@ -801,7 +832,7 @@ Reduce a word.
 
 This function triggers a full enumeration of an :py:class:`{name}` object and
 then reduces the word *w*. As such the returned word is a normal form for the
-input word.
+input word. The global interpreter lock is released while this function runs.
 
 {detail}
 
@@ -854,6 +885,255 @@ input word.
   ////////////////////////////////////////////////////////////////////////
   ////////////////////////////////////////////////////////////////////////
 
+  template <typename Thing, typename ThingBase>
+  void def_reduce_batch(py::class_<Thing, ThingBase>& thing,
+                        std::string_view              name,
+                        doc                           extra_doc) {
+    using Word = typename Thing::native_word_type;
+    thing.def(
+        "reduce_batch",
+        [](Thing& self, std::vector<Word> const& words) {
+          std::vector<Word> result;
+          result.reserve(words.size());
+          for (auto const& w : words) {
+            result.push_back(congruence_common::reduce(self, w));
+          }
+          return result;
+        },
+        py::arg("words"),
+        py::call_guard<py::gil_scoped_release>(),
+        make_doc(R"pbdoc(
+:sig=(self: {name}, words: list[list[int] | str]) -> list[list[int] | str]:
+{only_document_once}
+
+Reduce many words.
+
+This function triggers a full enumeration of an :py:class:`{name}` object and
+then reduces every word in *words*, in a single call. The returned list
+contains a normal form for each word in *words*, in the same order, and is
+the same as ``[self.reduce(w) for w in words]``. The global interpreter lock is
+released while the words are reduced.
+
+{detail}
+
+:param words: the input words.
+:type words: list[list[int] | str]
+
+:returns: The normal forms of the input words.
+:rtype: list[list[int] | str]
+
+:raises LibsemigroupsError:
+  if any of the values in any word in *words* is out of range, i.e. they do
+  not belong to ``presentation().alphabet()`` and
+  :any:`Presentation.throw_if_letter_not_in_alphabet` raises.
+
+{raises}
+)pbdoc",
+                 name,
+                 extra_doc));
+
+    thing.def(
+        "reduce_batch",
+        [](Thing&                self,
+           packed_letters const& letters,
+           packed_offsets const& offsets) {
+          auto words = unpack_words<Word>(letters, offsets);
+          {
+            py::gil_scoped_release release;
+            for (auto& w : words) {
+              w = congruence_common::reduce(self, w);
+            }
+          }
+          return pack_words(words);
+        },
+        py::arg("letters"),
+        py::arg("offsets"),
+        make_doc(R"pbdoc(
+:sig=(self: {name}, letters: numpy.ndarray, offsets: numpy.ndarray) -> tuple[numpy.ndarray, numpy.ndarray]:
+{only_document_once}
+
+Reduce many words stored in flat arrays.
+
+This function is the same as the previous one, except that the words, and the
+returned normal forms, are stored in a pair of flat arrays: the *i*-th word
+is ``letters[offsets[i]:offsets[i + 1]]``. There is one more offset than
+there are words, the first offset is ``0`` and the last is ``len(letters)``.
+If the words are strings, then the letters are the code points of the
+characters. The global interpreter lock is released while the words are
+reduced.
+
+:param letters: the letters of the input words.
+:type letters: numpy.ndarray
+
+:param offsets: the offsets of the input words in *letters*.
+:type offsets: numpy.ndarray
+
+:returns:
+  A tuple ``(letters, offsets)`` of arrays with dtypes ``uint32`` and
+  ``uint64`` containing the normal forms of the input words.
+:rtype: tuple[numpy.ndarray, numpy.ndarray]
+
+:raises LibsemigroupsError:
+  if *letters* or *offsets* is not 1-dimensional, or *offsets* is not as
+  described above.
+
+:raises LibsemigroupsError:
+  if any of the letters is out of range, i.e. they do not belong to
+  ``presentation().alphabet()`` and
+  :any:`Presentation.throw_if_letter_not_in_alphabet` raises.
+)pbdoc",
+                 name,
+                 extra_doc));
+  }
+
+  ////////////////////////////////////////////////////////////////////////
+
+#define DEF_REDUCE_BATCH(A, B)          \
+  template void def_reduce_batch<A, B>( \
+      py::class_<A, B>&, std::string_view, doc)
+
+  DEF_REDUCE_BATCH(ToddCoxeter<word_type>, detail::ToddCoxeterImpl);
+  DEF_REDUCE_BATCH(ToddCoxeter<std::string>, detail::ToddCoxeterImpl);
+
+  DEF_REDUCE_BATCH(Kambites<word_type>, detail::CongruenceCommon);
+  DEF_REDUCE_BATCH(Kambites<MultiView<std::string>>,
+                   detail::CongruenceCommon);
+  DEF_REDUCE_BATCH(Kambites<std::string>, detail::CongruenceCommon);
+
+  DEF_REDUCE_BATCH(KnuthBendixStringRewriteTrie,
+                   detail::KnuthBendixImpl<RewriteTrie>);
+  DEF_REDUCE_BATCH(KnuthBendixStringRewriteFromLeft,
+                   detail::KnuthBendixImpl<RewriteFromLeft>);
+  DEF_REDUCE_BATCH(KnuthBendixWordRewriteTrie,
+                   detail::KnuthBendixImpl<RewriteTrie>);
+  DEF_REDUCE_BATCH(KnuthBendixWordRewriteFromLeft,
+                   detail::KnuthBendixImpl<RewriteFromLeft>);
+
+  DEF_REDUCE_BATCH(Congruence<word_type>, detail::CongruenceCommon);
+  DEF_REDUCE_BATCH(Congruence<std::string>, detail::CongruenceCommon);
+
+  ////////////////////////////////////////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////
+
+  template <typename Thing, typename ThingBase>
+  void def_contains_batch(py::class_<Thing, ThingBase>& thing,
+                          std::string_view              name,
+                          doc                           extra_doc) {
+    using Word = typename Thing::native_word_type;
+    thing.def(
+        "contains_batch",
+        [](Thing& self, std::vector<std::pair<Word, Word>> const& pairs) {
+          return contains_pairs(self, pairs);
+        },
+        py::arg("pairs"),
+        make_doc(R"pbdoc(
+:sig=(self: {name}, pairs: list[tuple[list[int], list[int]] | tuple[str, str]]) -> numpy.ndarray:
+{only_document_once}
+
+Check containment of many pairs of words.
+
+This function checks whether or not each pair of words in *pairs* is
+contained in the congruence represented by a :py:class:`{name}` instance, in a
+single call. The *i*-th entry of the returned array is the same as
+``self.contains(*pairs[i])``. The global interpreter lock is released while the
+pairs are checked.
+
+:param pairs: the pairs of words.
+:type pairs: list[tuple[list[int], list[int]] | tuple[str, str]]
+
+:returns: A boolean array with one entry for each pair in *pairs*.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError:
+  if any of the values in any word in *pairs* is out of range, i.e. they do
+  not belong to ``presentation().alphabet()`` and
+  :any:`Presentation.throw_if_letter_not_in_alphabet` raises.
+
+{raises}
+)pbdoc",
+                 name,
+                 extra_doc));
+
+    thing.def(
+        "contains_batch",
+        [](Thing&                self,
+           packed_letters const& letters,
+           packed_offsets const& offsets) {
+          auto words = unpack_words<Word>(letters, offsets);
+          if (words.size() % 2 != 0) {
+            LIBSEMIGROUPS_EXCEPTION(
+                "expected an even number of words, found {}", words.size());
+          }
+          std::vector<std::pair<Word, Word>> pairs;
+          pairs.reserve(words.size() / 2);
+          for (size_t i = 0; i < words.size(); i += 2) {
+            pairs.emplace_back(std::move(words[i]), std::move(words[i + 1]));
+          }
+          return contains_pairs(self, pairs);
+        },
+        py::arg("letters"),
+        py::arg("offsets"),
+        make_doc(R"pbdoc(
+:sig=(self: {name}, letters: numpy.ndarray, offsets: numpy.ndarray) -> numpy.ndarray:
+{only_document_once}
+
+Check containment of many pairs of words stored in flat arrays.
+
+This function is the same as the previous one, except that the words are
+stored in a pair of flat arrays as described in :any:`{name}.reduce_batch`,
+and the words with indices ``2 * i`` and ``2 * i + 1`` form the *i*-th pair.
+
+:param letters: the letters of the words.
+:type letters: numpy.ndarray
+
+:param offsets: the offsets of the words in *letters*.
+:type offsets: numpy.ndarray
+
+:returns: A boolean array with one entry for each pair.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError:
+  if *letters* or *offsets* is not 1-dimensional, *offsets* is not valid, or
+  the number of words is odd.
+
+:raises LibsemigroupsError:
+  if any of the letters is out of range, i.e. they do not belong to
+  ``presentation().alphabet()`` and
+  :any:`Presentation.throw_if_letter_not_in_alphabet` raises.
+)pbdoc",
+                 name,
+                 extra_doc));
+  }
+
+  ////////////////////////////////////////////////////////////////////////
+
+#define DEF_CONTAINS_BATCH(A, B)          \
+  template void def_contains_batch<A, B>( \
+      py::class_<A, B>&, std::string_view, doc)
+
+  DEF_CONTAINS_BATCH(ToddCoxeter<word_type>, detail::ToddCoxeterImpl);
+  DEF_CONTAINS_BATCH(ToddCoxeter<std::string>, detail::ToddCoxeterImpl);
+
+  DEF_CONTAINS_BATCH(Kambites<word_type>, detail::CongruenceCommon);
+  DEF_CONTAINS_BATCH(Kambites<MultiView<std::string>>,
+                     detail::CongruenceCommon);
+  DEF_CONTAINS_BATCH(Kambites<std::string>, detail::CongruenceCommon);
+
+  DEF_CONTAINS_BATCH(KnuthBendixStringRewriteTrie,
+                     detail::KnuthBendixImpl<RewriteTrie>);
+  DEF_CONTAINS_BATCH(KnuthBendixStringRewriteFromLeft,
+                     detail::KnuthBendixImpl<RewriteFromLeft>);
+  DEF_CONTAINS_BATCH(KnuthBendixWordRewriteTrie,
+                     detail::KnuthBendixImpl<RewriteTrie>);
+  DEF_CONTAINS_BATCH(KnuthBendixWordRewriteFromLeft,
+                     detail::KnuthBendixImpl<RewriteFromLeft>);
+
+  DEF_CONTAINS_BATCH(Congruence<word_type>, detail::CongruenceCommon);
+  DEF_CONTAINS_BATCH(Congruence<std::string>, detail::CongruenceCommon);
+
+  ////////////////////////////////////////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////
+
   template <typename Thing, typename ThingBase>
   void def_generating_pairs(py::class_<Thing, ThingBase>& thing,
                             std::string_view              name,
@@ -1167,6 +1447,103 @@ the congruence represented by an instance of :any:`{name}`.
   // DEF_NORMAL_FORMS(Congruence<word_type>);
   // DEF_NORMAL_FORMS(Congruence<std::string>);
 
+  ////////////////////////////////////////////////////////////////////////
+
+  template <typename Thing>
+  void def_normal_forms_batches(py::module&      m,
+                                std::string_view class_name,
+                                std::string_view func_prefix,
+                                doc              extra_doc) {
+    std::string func_name(func_prefix);
+    func_name += "_normal_forms_batches";
+    m.def(
+        func_name.c_str(),
+        [](py::object ci, size_t n) {
+          using Word  = typename Thing::native_word_type;
+          using Range = decltype(congruence_common::normal_forms(
+              std::declval<Thing&>()));
+
+          if (n == 0) {
+            LIBSEMIGROUPS_EXCEPTION(
+                "the 2nd argument (batch size) must be positive, found 0");
+          }
+          std::shared_ptr<Range> nf;
+          {
+            Thing&                 thing = ci.cast<Thing&>();
+            py::gil_scoped_release release;
+            nf = std::make_shared<Range>(congruence_common::normal_forms(thing));
+          }
+          // The returned iterator calls next_batch until it returns None, and
+          // holds a reference to ci so that nf remains valid.
+          py::cpp_function next_batch([ci, nf, n]() -> py::object {
+            std::vector<Word> words;
+            {
+              py::gil_scoped_release release;
+              for (; words.size() < n && !nf->at_end(); nf->next()) {
+                words.push_back(nf->get());
+              }
+            }
+            if (words.empty()) {
+              return py::none();
+            }
+            return pack_words(words);
+          });
+          return py::module_::import("builtins")
+              .attr("iter")(next_batch, py::none());
+        },
+        py::arg(extra_doc.var.data()),
+        py::arg("n"),
+        make_doc(R"pbdoc(
+:sig=({var}: {name}, n: int) -> collections.abc.Iterator[tuple[numpy.ndarray, numpy.ndarray]]:
+{only_document_once}
+
+Returns an iterator yielding normal forms in batches.
+
+This function returns an iterator yielding the same normal forms as
+``normal_forms({var})``, in the same order, but in batches of (at most) *n*
+words. Each batch is a tuple ``(letters, offsets)`` of flat arrays with dtypes
+``uint32`` and ``uint64``, where the *i*-th word of the batch is
+``letters[offsets[i]:offsets[i + 1]]``. If the words are strings, then the
+letters are the code points of the characters. The global interpreter lock is
+released while each batch is computed.
+
+{detail}
+
+:param {var}: the :any:`{name}` instance.
+:type {var}: {name}
+
+:param n: the maximum number of words in each batch.
+:type n: int
+
+:returns: An iterator yielding batches of normal forms.
+:rtype: collections.abc.Iterator[tuple[numpy.ndarray, numpy.ndarray]]
+
+:raises LibsemigroupsError: if *n* is ``0``.
+
+{raises}
+)pbdoc",
+                 class_name,
+                 extra_doc));
+  }
+
+  ////////////////////////////////////////////////////////////////////////
+
+#define DEF_NORMAL_FORMS_BATCHES(Thing)          \
+  template void def_normal_forms_batches<Thing>( \
+      py::module&, std::string_view, std::string_view, doc)
+
+  DEF_NORMAL_FORMS_BATCHES(ToddCoxeter<word_type>);
+  DEF_NORMAL_FORMS_BATCHES(ToddCoxeter<std::string>);
+
+  DEF_NORMAL_FORMS_BATCHES(Kambites<word_type>);
+  DEF_NORMAL_FORMS_BATCHES(Kambites<MultiView<std::string>>);
+  DEF_NORMAL_FORMS_BATCHES(Kambites<std::string>);
+
+  DEF_NORMAL_FORMS_BATCHES(KnuthBendixStringRewriteTrie);
+  DEF_NORMAL_FORMS_BATCHES(KnuthBendixStringRewriteFromLeft);
+  DEF_NORMAL_FORMS_BATCHES(KnuthBendixWordRewriteTrie);
+  DEF_NORMAL_FORMS_BATCHES(KnuthBendixWordRewriteFromLeft);
+
   ////////////////////////////////////////////////////////////////////////
   // The init function for detail::CongruenceCommon
   ////////////////////////////////////////////////////////////////////////
@@ -103,6 +103,16 @@ namespace libsemigroups {
                   std::string_view              name,
                   doc                           extra_doc = {});
 
+  template <typename Thing, typename ThingBase>
+  void def_reduce_batch(py::class_<Thing, ThingBase>& thing,
+                        std::string_view              name,
+                        doc                           extra_doc = {});
+
+  template <typename Thing, typename ThingBase>
+  void def_contains_batch(py::class_<Thing, ThingBase>& thing,
+                          std::string_view              name,
+                          doc                           extra_doc = {});
+
   template <typename Thing, typename ThingBase>
   void def_generating_pairs(py::class_<Thing, ThingBase>& thing,
                             std::string_view              name,
@@ -135,5 +145,11 @@ namespace libsemigroups {
                         std::string_view func_prefix,
                         doc              extra_doc = {});
 
+  template <typename Thing>
+  void def_normal_forms_batches(py::module&      m,
+                                std::string_view class_name,
+                                std::string_view func_prefix,
+                                doc              extra_doc = {});
+
 }  // namespace libsemigroups
 #endif  // SRC_CONG_COMMON_HPP_
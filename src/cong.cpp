@@ -16,11 +16,25 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
+// C++ stl headers....
+#include <algorithm>  // for min
+#include <atomic>     // for atomic
+#include <chrono>     // for steady_clock, nanoseconds, duration
+#include <cstddef>    // for size_t
+#include <exception>  // for exception
+#include <optional>   // for optional
+#include <string>     // for string
+#include <thread>     // for thread
+#include <utility>    // for pair
+#include <vector>     // for vector
+
 // libsemigroups headers
 #include <libsemigroups/cong.hpp>
+#include <libsemigroups/runner.hpp>  // for Runner
 #include <libsemigroups/todd-coxeter.hpp>
 
 // pybind11....
+#include <pybind11/chrono.h>  // for timedelta conversion
 #include <pybind11/detail/common.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -32,6 +46,109 @@ namespace libsemigroups {
   namespace py = pybind11;
 
   namespace {
+    using race_report = std::vector<std::pair<std::string, double>>;
+
+    // Runs each of the runners, at most number_of_threads at a time, until
+    // one of them finishes, or the time limit (if any) is reached. The first
+    // runner to finish kills every other runner, which stop the next time
+    // that they check whether they are dead. Runners that have not been
+    // started when the race is won are never started.
+    std::pair<std::optional<size_t>, race_report>
+    race_runners(std::vector<Runner*> const&             runners,
+                 size_t                                  number_of_threads,
+                 std::optional<std::chrono::nanoseconds> time_limit) {
+      using clock = std::chrono::steady_clock;
+      if (number_of_threads == 0) {
+        LIBSEMIGROUPS_EXCEPTION(
+            "the 2nd argument (number of threads) must be non-zero");
+      }
+      for (size_t i = 0; i < runners.size(); ++i) {
+        if (runners[i] == nullptr) {
+          LIBSEMIGROUPS_EXCEPTION("the runner in position {} is None", i);
+        }
+        for (size_t j = 0; j < i; ++j) {
+          if (runners[i] == runners[j]) {
+            LIBSEMIGROUPS_EXCEPTION("the runners in positions {} and {} are "
+                                    "the same object, expected distinct "
+                                    "runners",
+                                    j,
+                                    i);
+          }
+        }
+      }
+
+      size_t const        n     = runners.size();
+      auto const          start = clock::now();
+      std::atomic<size_t> next(0);
+      std::atomic<size_t> winner(n);
+      race_report         report(n, {"not started", 0.0});
+
+      auto contend = [&]() {
+        for (size_t i = next++; i < n && winner == n; i = next++) {
+          auto const begin = clock::now();
+          try {
+            if (time_limit) {
+              auto const left = *time_limit - (begin - start);
+              if (left <= std::chrono::nanoseconds(0)) {
+                continue;
+              }
+              runners[i]->run_for(
+                  std::chrono::duration_cast<std::chrono::nanoseconds>(left));
+            } else {
+              runners[i]->run();
+            }
+            // The other runners may be running in other threads, and so
+            // only kill, which is designed to be called from another thread,
+            // is called on them here. Their states are read once every
+            // thread has been joined.
+            size_t none = n;
+            if (runners[i]->finished()
+                && winner.compare_exchange_strong(none, i)) {
+              for (size_t j = 0; j < n; ++j) {
+                if (j != i) {
+                  runners[j]->kill();
+                }
+              }
+            }
+            report[i].first = "ran";
+          } catch (std::exception const& e) {
+            report[i].first = std::string("error: ") + e.what();
+          }
+          std::chrono::duration<double> const secs = clock::now() - begin;
+          report[i].second                         = secs.count();
+        }
+      };
+
+      {
+        py::gil_scoped_release   release;
+        std::vector<std::thread> threads;
+        for (size_t i = 1; i < std::min(number_of_threads, n); ++i) {
+          threads.emplace_back(contend);
+        }
+        contend();
+        for (auto& t : threads) {
+          t.join();
+        }
+      }
+      for (size_t i = 0; i < n; ++i) {
+        if (report[i].first != "ran") {
+          continue;
+        } else if (i == winner) {
+          report[i].first = "won";
+        } else if (runners[i]->finished()) {
+          report[i].first = "finished";
+        } else if (runners[i]->dead()) {
+          report[i].first = "killed";
+        } else {
+          report[i].first = "timed out";
+        }
+      }
+      std::optional<size_t> result;
+      if (winner != n) {
+        result = winner;
+      }
+      return {result, report};
+    }
 
     template <typename Word>
     void bind_cong(py::module& m, char const* name) {
@@ -99,6 +216,8 @@ individual algorithms, such as :any:`Kambites`,
 
       def_reduce_no_run(thing, "Congruence");
       def_reduce(thing, "Congruence");
+      def_reduce_batch(thing, "Congruence");
+      def_contains_batch(thing, "Congruence");
 
       ////////////////////////////////////////////////////////////////////////
       // Congruence specific stuff
@@ -255,5 +374,59 @@ obviously infinite; ``False`` is returned if it is not.
   void init_cong(py::module& m) {
     bind_cong<word_type>(m, "CongruenceWord");
     bind_cong<std::string>(m, "CongruenceString");
+
+    m.def("congruence_race",
+          &race_runners,
+          py::arg("runners"),
+          py::arg("number_of_threads") = 1,
+          py::arg("time_limit")        = std::nullopt,
+          R"pbdoc(
+:sig=(runners: list[Runner], number_of_threads: int = 1, time_limit: datetime.timedelta | None = None) -> tuple[int | None, list[tuple[str, float]]]:
+
+Run several algorithms in parallel until one of them finishes.
+
+This function runs every runner in *runners* (for example, several
+:any:`ToddCoxeter` instances with different strategies, together with a
+:any:`KnuthBendix` and a :any:`Kambites` instance) in its own thread, with at
+most *number_of_threads* runners running at the same time. The runners are
+started in the order they are given, and whenever a runner stops another is
+started. As soon as any runner finishes, every other runner is killed (see
+:any:`Runner.kill`), and stops cooperatively the next time that it checks
+whether it is dead; runners not yet started are not run at all. If
+*time_limit* is not ``None``, then the race is abandoned once *time_limit* has
+passed since it started. The global interpreter lock is released while the
+race is running.
+
+The runners are run in place, so the winner can be used directly afterwards.
+Since the other runners are killed, they may not be in a valid state after
+the race, and should not be used.
+
+This function returns a tuple ``(winner, report)``, where ``winner`` is the
+index in *runners* of the runner that finished first, or ``None`` if no runner
+finished, and ``report[i]`` is a tuple ``(outcome, seconds)`` where
+``seconds`` is the time the ``i``-th runner spent running, and ``outcome`` is
+one of ``"won"``, ``"finished"`` (finished, but not first), ``"killed"``,
+``"timed out"``, ``"not started"``, or ``"error: "`` followed by the message
+of the exception that the runner raised. An exception raised by a runner does
+not stop the race.
+
+:param runners: the runners.
+:type runners: list[Runner]
+
+:param number_of_threads:
+  the maximum number of runners to run at the same time (default: ``1``).
+:type number_of_threads: int
+
+:param time_limit: the maximum duration of the race (default: ``None``).
+:type time_limit: datetime.timedelta | None
+
+:returns: The index of the winner, and the outcome and time of every runner.
+:rtype: tuple[int | None, list[tuple[str, float]]]
+
+:raises LibsemigroupsError: if *number_of_threads* is ``0``.
+
+:raises LibsemigroupsError:
+  if *runners* contains ``None``, or the same runner more than once.
+)pbdoc");
   }
 }  // namespace libsemigroups
@@ -18,24 +18,79 @@
 
 // C std headers....
 #include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t, uint64_t
 
 // C++ stl headers....
 #include <initializer_list>  // for initializer_list
+#include <vector>            // for vector
 
 // libsemigroups....
-#include <libsemigroups/forest.hpp>  // for Forest
-#include <libsemigroups/ranges.hpp>  // for rx::to_vector
+#include <libsemigroups/exception.hpp>  // for LIBSEMIGROUPS_EXCEPTION
+#include <libsemigroups/forest.hpp>     // for Forest
+#include <libsemigroups/ranges.hpp>     // for rx::to_vector
 
 // pybind11....
+#include <pybind11/numpy.h>      // for array_t
 #include <pybind11/operators.h>  // for py::operator
 #include <pybind11/pybind11.h>   // for class_, init, make_iterator, module
 #include <pybind11/stl.h>        // for conversion of C++ to py types
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_forest
+#include "main.hpp"     // for init_forest
+#include "threads.hpp"  // for run_in_threads
 
 namespace libsemigroups {
   namespace py = pybind11;
+
+  namespace {
+    // Returns a numpy array containing a copy of the data of vec. A view of
+    // vec is not returned, because it would dangle when vec is reallocated,
+    // for example, by Forest::add_nodes.
+    template <typename T>
+    py::array_t<T> to_array(std::vector<T> const& vec) {
+      return py::array_t<T>(vec.size(), vec.data());
+    }
+
+    // Returns the depths of the nodes in nodes, memoizing the depths of all
+    // the nodes on the paths from these nodes to their roots in depth, so
+    // that each node of f is visited at most once.
+    std::vector<uint64_t> memoized_depths(Forest const&                  f,
+                                          Forest::node_type const*       nodes,
+                                          size_t                         k,
+                                          std::vector<Forest::node_type>& depth) {
+      using node_type      = Forest::node_type;
+      size_t const    n    = f.number_of_nodes();
+      node_type const none = static_cast<node_type>(UNDEFINED);
+      auto const&     parents = f.parents();
+
+      depth.assign(n, none);
+      std::vector<node_type> stack;
+      std::vector<uint64_t>  result(k);
+      for (size_t i = 0; i < k; ++i) {
+        node_type v = nodes[i];
+        while (depth[v] == none && parents[v] != none) {
+          stack.push_back(v);
+          if (stack.size() > n) {
+            LIBSEMIGROUPS_EXCEPTION("the forest contains a cycle through "
+                                    "the node {}",
+                                    nodes[i]);
+          }
+          v = parents[v];
+        }
+        if (depth[v] == none) {
+          depth[v] = 0;  // v is a root
+        }
+        while (!stack.empty()) {
+          depth[stack.back()] = depth[v] + 1;
+          v                   = stack.back();
+          stack.pop_back();
+        }
+        result[i] = depth[nodes[i]];
+      }
+      return result;
+    }
+  }  // namespace
+
   void init_forest(py::module& m) {
     using node_type = Forest::node_type;
 
@@ -293,6 +348,46 @@ then node ``i`` is a root node.
    Constant.
 )pbdoc");
 
+      thing.def(
+          "parents_array",
+          [](Forest const& self) { return to_array(self.parents()); },
+          R"pbdoc(
+:sig=(self: Forest) -> numpy.ndarray:
+
+Returns a numpy array of the parents of the nodes in the forest.
+
+This function returns a 1-dimensional numpy array whose entry in position
+``i`` is the parent of node ``i``. The array is a copy, made in a single pass
+over the parents, and so it is not changed by subsequent modifications of
+*self*. Roots are represented by ``2 ** 32 - 1`` (the maximum value of the
+``dtype``) rather than :any:`UNDEFINED`.
+
+:returns: The parents of the nodes in the forest.
+:rtype: numpy.ndarray
+
+:complexity: Linear in :any:`number_of_nodes`.
+)pbdoc");
+
+      thing.def(
+          "labels_array",
+          [](Forest const& self) { return to_array(self.labels()); },
+          R"pbdoc(
+:sig=(self: Forest) -> numpy.ndarray:
+
+Returns a numpy array of the edge labels in the forest.
+
+This function returns a 1-dimensional numpy array whose entry in position
+``i`` is the label of the edge from the parent of node ``i`` to ``i``. The
+array is a copy, made in a single pass over the labels, and so it is not
+changed by subsequent modifications of *self*. The labels of roots are
+represented by the maximum value of the ``dtype`` rather than :any:`UNDEFINED`.
+
+:returns: The edge labels of the forest.
+:rtype: numpy.ndarray
+
+:complexity: Linear in :any:`number_of_nodes`.
+)pbdoc");
+
       thing.def(
           "path_to_root",
           [](Forest const& self, node_type i) {
@@ -372,6 +467,164 @@ a root node.
   if *n* is greater than or equal to :any:`Forest.number_of_nodes`.
 )pbdoc");
 
+    m.def(
+        "forest_from_arrays",
+        [](py::array_t<node_type, py::array::c_style | py::array::forcecast>
+               parents,
+           py::array_t<Forest::label_type,
+                       py::array::c_style | py::array::forcecast> labels) {
+          if (parents.ndim() != 1 || labels.ndim() != 1) {
+            LIBSEMIGROUPS_EXCEPTION(
+                "expected 1-dimensional arrays of parents and labels, found "
+                "{}- and {}-dimensional arrays",
+                parents.ndim(),
+                labels.ndim());
+          }
+          std::vector<node_type> p(parents.data(),
+                                   parents.data() + parents.size());
+          std::vector<Forest::label_type> l(labels.data(),
+                                            labels.data() + labels.size());
+          return make<Forest>(std::move(p), std::move(l));
+        },
+        py::arg("parents"),
+        py::arg("labels"),
+        R"pbdoc(
+:sig=(parents: numpy.ndarray, labels: numpy.ndarray) -> Forest:
+
+Construct a :any:`Forest` from numpy arrays of parents and labels.
+
+This function constructs a :any:`Forest` in the same way as the constructor
+``Forest(parents, labels)``, but from 1-dimensional numpy arrays, without
+converting every entry to a Python object. The roots of the forest are
+indicated by the value ``2 ** 32 - 1`` (the maximum value of the ``dtype``)
+in both arrays, as in the arrays returned by :any:`Forest.parents_array` and
+:any:`Forest.labels_array`.
+
+:param parents: the parents of the nodes.
+:type parents: numpy.ndarray
+
+:param labels: the edge labels.
+:type labels: numpy.ndarray
+
+:returns: The constructed forest.
+:rtype: Forest
+
+:raises LibsemigroupsError:
+  if *parents* and *labels* are not 1-dimensional or have different sizes, or
+  they do not indicate roots in the same positions, or any parent is out of
+  bounds.
+
+.. doctest::
+
+   >>> import numpy as np
+   >>> from libsemigroups_pybind11 import forest
+   >>> none = 2 ** 32 - 1
+   >>> f = forest.from_arrays(np.array([none, 0, 1], dtype=np.uint32),
+   ...                        np.array([none, 1, 0], dtype=np.uint32))
+   >>> f.parents()
+   [UNDEFINED, 0, 1]
+)pbdoc");
+
+    m.def(
+        "forest_paths_to_roots",
+        [](Forest const& f,
+           py::array_t<node_type, py::array::c_style | py::array::forcecast>
+                  nodes,
+           size_t number_of_threads) {
+          if (nodes.ndim() != 1) {
+            LIBSEMIGROUPS_EXCEPTION("expected a 1-dimensional array of nodes, "
+                                    "found a {}-dimensional array",
+                                    nodes.ndim());
+          }
+          size_t const     k = nodes.size();
+          node_type const* v = nodes.data();
+          for (size_t i = 0; i < k; ++i) {
+            if (v[i] >= f.number_of_nodes()) {
+              LIBSEMIGROUPS_EXCEPTION("node value out of bounds, expected "
+                                      "value in the range [0, {}), found {} "
+                                      "in position {}",
+                                      f.number_of_nodes(),
+                                      v[i],
+                                      i);
+            }
+          }
+          py::array_t<uint64_t> offsets(k + 1);
+          uint64_t*             o = offsets.mutable_data();
+          std::vector<uint64_t> depths;
+          std::vector<node_type> memo;
+          {
+            py::gil_scoped_release release;
+            depths = memoized_depths(f, v, k, memo);
+          }
+          o[0] = 0;
+          for (size_t i = 0; i < k; ++i) {
+            o[i + 1] = o[i] + depths[i];
+          }
+          py::array_t<uint32_t> letters(o[k]);
+          uint32_t*             l = letters.mutable_data();
+          {
+            py::gil_scoped_release release;
+            auto const&            parents = f.parents();
+            auto const&            labels  = f.labels();
+            run_in_threads(
+                k, number_of_threads, [&](size_t first, size_t last) {
+                  for (size_t i = first; i < last; ++i) {
+                    node_type x = v[i];
+                    for (uint64_t j = o[i]; j < o[i + 1]; ++j) {
+                      l[j] = labels[x];
+                      x    = parents[x];
+                    }
+                  }
+                });
+          }
+          return py::make_tuple(letters, offsets);
+        },
+        py::arg("f"),
+        py::arg("nodes"),
+        py::arg("number_of_threads") = 1,
+        R"pbdoc(
+:sig=(f: Forest, nodes: numpy.ndarray, number_of_threads: int = 1) -> tuple[numpy.ndarray, numpy.ndarray]:
+
+Returns the words labelling the paths from many nodes to the roots.
+
+This function returns the words :any:`path_to_root` for every node in the
+1-dimensional array *nodes*, as a pair of arrays ``(letters, offsets)``, so
+that the ``i``-th word is ``letters[offsets[i]:offsets[i + 1]]``. The depths of
+all the nodes are computed first, memoizing the depth of every node visited,
+so that each node of *f* is visited once, and then the words are written into
+a single buffer without holding the GIL using *number_of_threads* threads.
+
+:param f: the forest.
+:type f: Forest
+
+:param nodes: the nodes.
+:type nodes: numpy.ndarray
+
+:param number_of_threads: the number of threads to use (default: ``1``).
+:type number_of_threads: int
+
+:returns:
+  A tuple containing an array of ``numpy.uint32`` letters, and an array of
+  ``numpy.uint64`` offsets, with one more offset than there are nodes.
+:rtype: tuple[numpy.ndarray, numpy.ndarray]
+
+:raises LibsemigroupsError:
+  if *nodes* is not 1-dimensional, or any value in *nodes* is not a node of
+  *f*, or *f* contains a cycle.
+
+.. doctest::
+
+   >>> import numpy as np
+   >>> from libsemigroups_pybind11 import Forest, forest, UNDEFINED
+   >>> f = Forest([UNDEFINED, 0, 1, 0], [UNDEFINED, 1, 0, 0])
+   >>> letters, offsets = forest.paths_to_roots(f, np.arange(4))
+   >>> offsets
+   array([0, 0, 1, 3, 4], dtype=uint64)
+   >>> all(letters[offsets[i]:offsets[i + 1]].tolist() == forest.path_to_root(f, i)
+   ...     for i in range(4))
+   True
+)pbdoc");
+
     m.def(
         "forest_depth",
         [](Forest const& f, node_type n) { return forest::depth(f, n); },
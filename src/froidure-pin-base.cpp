@@ -16,19 +16,56 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
+#include <cstddef>  // for size_t
+#include <vector>   // for vector
+
 // libsemigroups headers
 #include <libsemigroups/froidure-pin-base.hpp>
 
 // pybind11....
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_froidure_pin_base
+#include "main.hpp"          // for init_froidure_pin_base
+#include "packed-words.hpp"  // for packed_letters, pack_words, unpack_words
 
 namespace libsemigroups {
   namespace py = pybind11;
 
+  namespace {
+    using element_index_type = FroidurePinBase::element_index_type;
+    using positions_array
+        = py::array_t<element_index_type,
+                      py::array::c_style | py::array::forcecast>;
+
+    // Returns a numpy array containing the current positions of the words
+    // stored in (letters, offsets), UNDEFINED is represented by the maximum
+    // value of the dtype. If enumerate is true, then fp is fully enumerated
+    // first. The GIL is released while fp is enumerated and the words are
+    // traced in the right Cayley graph.
+    py::array_t<element_index_type>
+    current_positions(FroidurePinBase&      fp,
+                      packed_letters const& letters,
+                      packed_offsets const& offsets,
+                      bool                  enumerate) {
+      auto words = unpack_words<word_type>(letters, offsets);
+      py::array_t<element_index_type> result(words.size());
+      element_index_type*             data = result.mutable_data();
+      {
+        py::gil_scoped_release release;
+        if (enumerate) {
+          fp.run();
+        }
+        for (size_t i = 0; i < words.size(); ++i) {
+          data[i] = froidure_pin::current_position(fp, words[i]);
+        }
+      }
+      return result;
+    }
+  }  // namespace
+
   void init_froidure_pin_base(py::module& m) {
     py::class_<FroidurePinBase, Runner> thing(m,
                                               "FroidurePinBase",
@@ -214,6 +251,7 @@ Returns the degree of any and all elements.
 
     thing.def("enumerate",
               &FroidurePinBase::enumerate,
+              py::call_guard<py::gil_scoped_release>(),
               py::arg("limit"),
               R"pbdoc(
 :sig=(self: FroidurePin, limit: int) -> None:
@@ -286,6 +324,7 @@ first letter of the element.
 
     thing.def("contains_one",
               &FroidurePinBase::contains_one,
+              py::call_guard<py::gil_scoped_release>(),
               R"pbdoc(
 :sig=(self: FroidurePin) -> bool:
 
@@ -322,6 +361,7 @@ Check if the categorical multiplicative identity is an element.
 
     thing.def("left_cayley_graph",
               &FroidurePinBase::left_cayley_graph,
+              py::call_guard<py::gil_scoped_release>(),
               R"pbdoc(
 :sig=(self: FroidurePin) -> WordGraph:
 
@@ -418,6 +458,7 @@ trigger any enumeration.
 
     thing.def("number_of_rules",
               &FroidurePinBase::number_of_rules,
+              py::call_guard<py::gil_scoped_release>(),
               R"pbdoc(
 :sig=(self: FroidurePin) -> int:
 
@@ -458,6 +499,7 @@ Returns the position of the prefix of the element ``x`` in position *pos*
 
     thing.def("right_cayley_graph",
               &FroidurePinBase::right_cayley_graph,
+              py::call_guard<py::gil_scoped_release>(),
               R"pbdoc(
 :sig=(self: FroidurePin) -> WordGraph:
 
@@ -478,10 +520,12 @@ Returns the fully enumerated right Cayley graph.
 
     thing.def("size",
               &FroidurePinBase::size,
+              py::call_guard<py::gil_scoped_release>(),
               R"pbdoc(
 :sig=(self: FroidurePin) -> int:
 
 Returns the size of the semigroup represented by a :any:`FroidurePin` instance.
+The global interpreter lock is released while the semigroup is enumerated.
 
 :returns:
   The size of the semigroup.
@@ -618,6 +662,142 @@ This function returns the short-lex least word (in the generators) representing
           py::arg("fp"),
           py::arg("pos"));
 
+      m.def(
+          "froidure_pin_current_positions",
+          [](FroidurePinBase&      fp,
+             packed_letters const& letters,
+             packed_offsets const& offsets) {
+            return current_positions(fp, letters, offsets, false);
+          },
+          py::arg("fp"),
+          py::arg("letters"),
+          py::arg("offsets"),
+          R"pbdoc(
+:sig=(fp: FroidurePin, letters: numpy.ndarray, offsets: numpy.ndarray) -> numpy.ndarray:
+
+Returns the positions corresponding to many words.
+
+This function returns an array containing the position in *fp* of each of the
+words stored in *letters* and *offsets*, where the *i*-th word is
+``letters[offsets[i]:offsets[i + 1]]``, so that there is one more offset than
+there are words. The *i*-th entry of the returned array is the same as
+``current_position(fp, w)`` where *w* is the *i*-th word, except that
+:any:`UNDEFINED` is represented by the maximum value of the dtype of the
+array. No enumeration is performed, and the words are traced in the current
+right Cayley graph with the global interpreter lock released.
+
+:param fp: the :any:`FroidurePin` instance.
+:type fp: FroidurePin
+
+:param letters: the letters of the words.
+:type letters: numpy.ndarray
+
+:param offsets: the offsets of the words in *letters*.
+:type offsets: numpy.ndarray
+
+:returns: The current positions of the elements represented by the words.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError:
+    if *letters* or *offsets* is not 1-dimensional, or *offsets* is not as
+    described above.
+
+:raises LibsemigroupsError:
+    if any letter is not strictly less than
+    :any:`FroidurePin.number_of_generators`.
+)pbdoc");
+
+      m.def(
+          "froidure_pin_positions",
+          [](FroidurePinBase&      fp,
+             packed_letters const& letters,
+             packed_offsets const& offsets) {
+            return current_positions(fp, letters, offsets, true);
+          },
+          py::arg("fp"),
+          py::arg("letters"),
+          py::arg("offsets"),
+          R"pbdoc(
+:sig=(fp: FroidurePin, letters: numpy.ndarray, offsets: numpy.ndarray) -> numpy.ndarray:
+
+Returns the positions corresponding to many words.
+
+This function is the same as :any:`current_positions`, except that a full
+enumeration of *fp* is triggered first, and so every entry of the returned
+array is the same as ``position(fp, w)`` for the corresponding word *w*. The
+global interpreter lock is released while *fp* is enumerated and the words
+are traced.
+
+:param fp: the :any:`FroidurePin` instance.
+:type fp: FroidurePin
+
+:param letters: the letters of the words.
+:type letters: numpy.ndarray
+
+:param offsets: the offsets of the words in *letters*.
+:type offsets: numpy.ndarray
+
+:returns: The positions of the elements represented by the words.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError:
+    if *letters* or *offsets* is not 1-dimensional, or *offsets* is not
+    valid.
+
+:raises LibsemigroupsError:
+    if any letter is not strictly less than
+    :any:`FroidurePin.number_of_generators`.
+)pbdoc");
+
+      m.def(
+          "froidure_pin_factorisations",
+          [](FroidurePinBase& fp, positions_array const& positions) {
+            if (positions.ndim() != 1) {
+              LIBSEMIGROUPS_EXCEPTION(
+                  "expected a 1-dimensional array of positions, found a "
+                  "{}-dimensional array",
+                  positions.ndim());
+            }
+            element_index_type const* data = positions.data();
+            std::vector<word_type>    words(positions.size());
+            {
+              py::gil_scoped_release release;
+              for (size_t i = 0; i < words.size(); ++i) {
+                words[i] = froidure_pin::factorisation(fp, data[i]);
+              }
+            }
+            return pack_words(words);
+          },
+          py::arg("fp"),
+          py::arg("positions"),
+          R"pbdoc(
+:sig=(fp: FroidurePin, positions: numpy.ndarray) -> tuple[numpy.ndarray, numpy.ndarray]:
+
+Returns factorisations of many elements given by index.
+
+This function returns a tuple ``(letters, offsets)`` of arrays containing a
+word in the generators for each index in *positions*, where the *i*-th word
+is ``letters[offsets[i]:offsets[i + 1]]`` and is the same as
+``factorisation(fp, positions[i])``. The global interpreter lock is released
+while the factorisations are computed.
+
+:param fp: the :any:`FroidurePin` instance.
+:type fp: FroidurePin
+
+:param positions: the indices of the elements.
+:type positions: numpy.ndarray
+
+:returns: The factorisations packed into a pair of arrays.
+:rtype: tuple[numpy.ndarray, numpy.ndarray]
+
+:raises LibsemigroupsError:
+    if *positions* is not 1-dimensional.
+
+:raises LibsemigroupsError:
+    if any value in *positions* is not strictly less than
+    :any:`FroidurePin.size`.
+)pbdoc");
+
       m.def(
           "froidure_pin_current_normal_forms",
           [](FroidurePinBase const& fp) {
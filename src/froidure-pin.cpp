@@ -16,31 +16,204 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
-#include <string>
+#include <algorithm>      // for min, max
+#include <cstddef>        // for size_t
+#include <cstdint>        // for uint32_t
+#include <deque>          // for deque
+#include <iterator>       // for make_move_iterator
+#include <limits>         // for numeric_limits
+#include <string>         // for string
+#include <thread>         // for thread
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for move, pair
+#include <vector>         // for vector
 
 // libsemigroups headers
 #include <libsemigroups/bipart.hpp>
 #include <libsemigroups/bmat8.hpp>
+#include <libsemigroups/config.hpp>  // for LIBSEMIGROUPS_HPCOMBI_ENABLED
 #include <libsemigroups/froidure-pin.hpp>
 #include <libsemigroups/knuth-bendix.hpp>
 #include <libsemigroups/matrix.hpp>
 #include <libsemigroups/pbr.hpp>
 #include <libsemigroups/transf.hpp>
+#include <libsemigroups/word-graph.hpp>
+
+#ifdef LIBSEMIGROUPS_HPCOMBI_ENABLED
+#include <libsemigroups/hpcombi.hpp>
+#endif
 
 // pybind11....
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <type_traits>
 
 // libsemigroups_pybind11....
 #include "kbe.hpp"
-#include "main.hpp"  // for init_froidure_pin
+#include "main.hpp"     // for init_froidure_pin
+#include "threads.hpp"  // for run_in_threads_with_id
 
 namespace libsemigroups {
   namespace py = pybind11;
 
   namespace {
 
+    // Returns a numpy array containing index_of(x) for every x in xs, where
+    // UNDEFINED is represented by the maximum value of the dtype. The GIL is
+    // released while the indices are computed.
+    template <typename Element, typename Func>
+    py::array_t<FroidurePinBase::element_index_type>
+    indices_of(std::vector<Element> const& xs, Func&& index_of) {
+      py::array_t<FroidurePinBase::element_index_type> result(xs.size());
+      auto* data = result.mutable_data();
+      {
+        py::gil_scoped_release release;
+        for (size_t i = 0; i < xs.size(); ++i) {
+          data[i] = index_of(xs[i]);
+        }
+      }
+      return result;
+    }
+
+    // Returns the elements of the semigroup generated by gens, in the same
+    // order as FroidurePin<Element>, together with its right Cayley graph. The
+    // products of all of the elements of a given length with the generators
+    // are computed in parallel, and then the new elements are added to the
+    // hash map in the order that FroidurePin would find them, so that the
+    // output does not depend on number_of_threads. Must be called without the
+    // GIL.
+    template <typename Element>
+    std::pair<std::vector<Element>, WordGraph<uint32_t>>
+    enumerate_parallel(std::vector<Element> const& gens,
+                       size_t                      number_of_threads) {
+      if (gens.empty()) {
+        LIBSEMIGROUPS_EXCEPTION("expected at least 1 generator, found 0");
+      }
+      if (number_of_threads == 0) {
+        LIBSEMIGROUPS_EXCEPTION(
+            "the 2nd argument (number of threads) must be positive, found 0");
+      }
+      size_t const deg = Degree<Element>()(gens[0]);
+      for (size_t i = 1; i < gens.size(); ++i) {
+        if (Degree<Element>()(gens[i]) != deg) {
+          LIBSEMIGROUPS_EXCEPTION("expected generators of degree {}, found a "
+                                  "generator of degree {} in position {}",
+                                  deg,
+                                  Degree<Element>()(gens[i]),
+                                  i);
+        }
+      }
+      // Some element types, such as Bipartition and PBR, use buffers indexed
+      // by the thread id when computing products, and these are only
+      // allocated for each hardware thread.
+      number_of_threads = std::min<size_t>(
+          number_of_threads, std::max(std::thread::hardware_concurrency(), 1u));
+
+      auto hash  = [](Element const* x) { return Hash<Element>()(*x); };
+      auto equal = [](Element const* x, Element const* y) {
+        return EqualTo<Element>()(*x, *y);
+      };
+
+      // A deque is used so that the pointers in map remain valid.
+      std::deque<Element> elements;
+      std::unordered_map<Element const*,
+                         uint32_t,
+                         decltype(hash),
+                         decltype(equal)>
+          map(0, hash, equal);
+
+      auto position = [&elements, &map](Element&& x) -> uint32_t {
+        auto it = map.find(&x);
+        if (it != map.end()) {
+          return it->second;
+        }
+        if (elements.size() >= std::numeric_limits<uint32_t>::max()) {
+          LIBSEMIGROUPS_EXCEPTION("too many elements, found more than {}",
+                                  std::numeric_limits<uint32_t>::max() - 1);
+        }
+        uint32_t const pos = elements.size();
+        elements.push_back(std::move(x));
+        map.emplace(&elements.back(), pos);
+        return pos;
+      };
+
+      size_t const          k = gens.size();
+      std::vector<uint32_t> targets;
+      for (auto const& x : gens) {
+        position(Element(x));
+      }
+
+      std::vector<Element> products;
+      for (size_t first = 0; first < elements.size();) {
+        size_t const last = elements.size();
+        products.assign((last - first) * k, One<Element>()(gens[0]));
+        run_in_threads_with_id(
+            last - first,
+            number_of_threads,
+            [&](size_t thread_id, size_t lo, size_t hi) {
+              Product<Element> product;
+              for (size_t i = lo; i < hi; ++i) {
+                for (size_t j = 0; j < k; ++j) {
+                  product(products[i * k + j],
+                          elements[first + i],
+                          gens[j],
+                          thread_id);
+                }
+              }
+            });
+        targets.resize(last * k);
+        for (size_t i = 0; i < products.size(); ++i) {
+          targets[first * k + i] = position(std::move(products[i]));
+        }
+        first = last;
+      }
+      products.clear();
+      map.clear();
+
+      WordGraph<uint32_t> wg(elements.size(), k);
+      for (size_t s = 0; s < elements.size(); ++s) {
+        for (size_t a = 0; a < k; ++a) {
+          wg.target_no_checks(s, a, targets[s * k + a]);
+        }
+      }
+      return {std::vector<Element>(std::make_move_iterator(elements.begin()),
+                                   std::make_move_iterator(elements.end())),
+              std::move(wg)};
+    }
+
+    // Returns an estimate of the number of bytes used by fp to store its
+    // current elements, their factorisations, and its Cayley graphs. This does
+    // not include any memory allocated by the elements themselves (such as
+    // the images of a dynamic Transf), nor the unused capacity of containers.
+    template <typename FroidurePin_>
+    py::dict memory_usage(FroidurePin_ const& fp) {
+      using element_type       = typename FroidurePin_::element_type;
+      using element_index_type = FroidurePinBase::element_index_type;
+
+      size_t const n = fp.current_size();
+      size_t const cayley_graph
+          = n * fp.number_of_generators() * sizeof(element_index_type);
+      // Every element is stored once, and referenced by the hash map used to
+      // find its position, where each node holds a pointer, the key, and the
+      // position.
+      size_t const elements
+          = n
+            * (sizeof(element_type) + 2 * sizeof(void*)
+               + sizeof(element_index_type));
+      // The first and final letters, prefix, suffix, length, and position in
+      // the enumeration order of every element.
+      size_t const factorisations = 6 * n * sizeof(element_index_type);
+
+      py::dict result;
+      result["elements"]           = elements;
+      result["factorisations"]     = factorisations;
+      result["left_cayley_graph"]  = cayley_graph;
+      result["right_cayley_graph"] = cayley_graph;
+      result["total"] = elements + factorisations + 2 * cayley_graph;
+      return result;
+    }
+
     // Functionality that doesn't depend on the Element type is bound by this
     // function
     template <typename FroidurePin_>
@@ -194,6 +367,32 @@ idempotent and ``False`` if it is not.
   instance.
 )pbdoc");
 
+      thing.def("memory_usage",
+                &memory_usage<FroidurePin_>,
+                R"pbdoc(
+:sig=(self: FroidurePin) -> dict[str, int]:
+
+Returns an estimate of the memory used by a :any:`FroidurePin` instance.
+
+This function returns a dictionary containing an estimate of the number of
+bytes used to store the elements enumerated so far (key ``"elements"``), their
+factorisations (key ``"factorisations"``), the left and right Cayley graphs
+(keys ``"left_cayley_graph"`` and ``"right_cayley_graph"``), and the sum of
+these values (key ``"total"``). This function does not trigger any
+enumeration, and so can be used to monitor the memory required by a
+:any:`FroidurePin` instance while it is being run.
+
+The estimates are computed from the current number of elements and
+generators. They do not include the memory allocated by the elements
+themselves (for example, the images of a :any:`Transf` of large degree),
+and so should be regarded as lower bounds.
+
+:returns: The estimated number of bytes used by each component.
+:rtype: dict[str, int]
+
+:complexity: Constant.
+)pbdoc");
+
       thing.def("number_of_generators",
                 &FroidurePin_::number_of_generators,
                 R"pbdoc(
@@ -919,12 +1118,149 @@ if *x* is not an element.
 :rtype: int | Undefined
 
 .. seealso::  :any:`current_position` and :any:`position`.
+)pbdoc");
+
+      thing.def(
+          "current_positions",
+          [](FroidurePin_ const& self, std::vector<Element> const& xs) {
+            return indices_of(xs, [&self](Element const& x) {
+              return self.current_position(x);
+            });
+          },
+          py::arg("xs"),
+          R"pbdoc(
+:sig=(self: FroidurePin, xs: list[Element]) -> numpy.ndarray:
+
+Find the positions of many elements with no enumeration.
+
+This function returns an array whose *i*-th entry is the same as
+``self.current_position(xs[i])``, except that :any:`UNDEFINED` is represented
+by the maximum value of the dtype of the array. The global interpreter lock is
+released while the positions are found.
+
+:param xs: the possible elements.
+:type xs: list[Element]
+
+:returns: The current positions of the items in *xs*.
+:rtype: numpy.ndarray
+
+.. seealso::  :any:`positions` and :any:`sorted_positions`.
+)pbdoc");
+
+      thing.def(
+          "positions",
+          [](FroidurePin_& self, std::vector<Element> const& xs) {
+            return indices_of(xs, [&self](Element const& x) {
+              return self.position(x);
+            });
+          },
+          py::arg("xs"),
+          R"pbdoc(
+:sig=(self: FroidurePin, xs: list[Element]) -> numpy.ndarray:
+
+Find the positions of many elements with enumeration if necessary.
+
+This function returns an array whose *i*-th entry is the same as
+``self.position(xs[i])``, except that :any:`UNDEFINED` is represented by the
+maximum value of the dtype of the array. The global interpreter lock is
+released while the positions are found.
+
+:param xs: the possible elements.
+:type xs: list[Element]
+
+:returns: The positions of the items in *xs*.
+:rtype: numpy.ndarray
+
+.. seealso::  :any:`current_positions` and :any:`sorted_positions`.
+)pbdoc");
+
+      thing.def(
+          "sorted_positions",
+          [](FroidurePin_& self, std::vector<Element> const& xs) {
+            return indices_of(xs, [&self](Element const& x) {
+              return self.sorted_position(x);
+            });
+          },
+          py::arg("xs"),
+          R"pbdoc(
+:sig=(self: FroidurePin, xs: list[Element]) -> numpy.ndarray:
+
+Returns the sorted indices of many elements.
+
+This function returns an array whose *i*-th entry is the same as
+``self.sorted_position(xs[i])``, except that :any:`UNDEFINED` is represented
+by the maximum value of the dtype of the array. The global interpreter lock is
+released while the positions are found.
+
+:param xs: the possible elements.
+:type xs: list[Element]
+
+:returns: The sorted positions of the items in *xs*.
+:rtype: numpy.ndarray
+
+.. seealso::  :any:`current_positions` and :any:`positions`.
 )pbdoc");
 
       ////////////////////////////////////////////////////////////////////////
       // Helper functions
       ////////////////////////////////////////////////////////////////////////
 
+      m.def(
+          "froidure_pin_enumerate_parallel",
+          [](std::vector<Element> const& gens, size_t number_of_threads) {
+            py::gil_scoped_release release;
+            return enumerate_parallel(gens, number_of_threads);
+          },
+          py::arg("gens"),
+          py::arg("number_of_threads") = 1,
+          R"pbdoc(
+:sig=(gens: list[Element], number_of_threads: int = 1) -> tuple[list[Element], WordGraph]:
+:only-document-once:
+
+Enumerate the semigroup generated by some elements using multiple threads.
+
+This function returns the elements of the semigroup generated by *gens*, and
+its right Cayley graph, using the same algorithm as :any:`FroidurePin`, except
+that the products of all of the elements of a given length with the
+generators are computed in parallel, using *number_of_threads* threads. The
+new elements found are then added one at a time, in the same order as in the
+serial algorithm, and so the output does not depend on *number_of_threads*.
+In particular, the returned elements are the same, and in the same order, as
+those of ``FroidurePin(gens)``, and the returned word graph is equal to its
+:any:`FroidurePin.right_cayley_graph`.
+
+The global interpreter lock is released while this function runs. At most
+one thread per hardware thread is used, regardless of the value of
+*number_of_threads*.
+
+:param gens: the generators.
+:type gens: list[Element]
+
+:param number_of_threads: the number of threads to use (defaults to ``1``).
+:type number_of_threads: int
+
+:returns: The tuple consisting of the list of elements and the right Cayley
+  graph.
+:rtype: tuple[list[Element], WordGraph]
+
+:raises LibsemigroupsError: if *gens* is empty.
+:raises LibsemigroupsError: if the generators do not all have the same degree.
+:raises LibsemigroupsError: if *number_of_threads* is ``0``.
+
+.. doctest:: Python
+
+  >>> from libsemigroups_pybind11 import FroidurePin, Transf, froidure_pin
+  >>> gens = [Transf([1, 0, 2, 3]), Transf([1, 2, 3, 0]), Transf([0, 0, 2, 3])]
+  >>> elements, wg = froidure_pin.enumerate_parallel(gens, 4)
+  >>> len(elements)
+  256
+  >>> S = FroidurePin(gens)
+  >>> elements == list(S)
+  True
+  >>> wg == S.right_cayley_graph()
+  True
+)pbdoc");
+
       // Documented in the size_t overload.
       m.def(
           "froidure_pin_factorisation",
@@ -1271,17 +1607,17 @@ This function returns the element of *fp* obtained by evaluating *w*.
   }    // namespace
 
   void init_froidure_pin(py::module& m) {
-    // TODO(0) uncomment bind_froidure_pin<HPCombiTransf<16>>(m, "Transf16");
+#ifdef LIBSEMIGROUPS_HPCOMBI_ENABLED
+    bind_froidure_pin_stateless<HPCombi::Transf16>(m, "HPCombiTransf16");
+    bind_froidure_pin_stateless<HPCombi::PPerm16>(m, "HPCombiPPerm16");
+    bind_froidure_pin_stateless<HPCombi::Perm16>(m, "HPCombiPerm16");
+#endif
     bind_froidure_pin_stateless<Transf<0, uint8_t>>(m, "Transf1");
     bind_froidure_pin_stateless<Transf<0, uint16_t>>(m, "Transf2");
     bind_froidure_pin_stateless<Transf<0, uint32_t>>(m, "Transf4");
-    // TODO(0) uncomment bind_froidure_pin_stateless<LeastPPerm<16>>(m,
-    // "PPerm16");
     bind_froidure_pin_stateless<PPerm<0, uint8_t>>(m, "PPerm1");
     bind_froidure_pin_stateless<PPerm<0, uint16_t>>(m, "PPerm2");
     bind_froidure_pin_stateless<PPerm<0, uint32_t>>(m, "PPerm4");
-    // TODO(0) uncomment bind_froidure_pin_stateless<LeastPerm<16>>(m,
-    // "Perm16");
     bind_froidure_pin_stateless<Perm<0, uint8_t>>(m, "Perm1");
     bind_froidure_pin_stateless<Perm<0, uint16_t>>(m, "Perm2");
     bind_froidure_pin_stateless<Perm<0, uint32_t>>(m, "Perm4");
@@ -19,11 +19,14 @@
 // return_value_policy::reference_internal
 
 // C++ stl headers....
+#include <algorithm>         // for min, max, remove_if
 #include <array>             // for array
+#include <atomic>            // for atomic
 #include <cstddef>           // for uint32_t
 #include <cstdint>           // for uint64_t
 #include <initializer_list>  // for initializer_list
 #include <string>            // for to_string, basic_string
+#include <utility>           // for pair
 #include <vector>            // for vector
 
 // libsemigroups....
@@ -35,16 +38,353 @@
 #include <libsemigroups/word-graph.hpp>        // for WordGraph, word_graph
 
 // pybind11....
+#include <pybind11/numpy.h>      // for array_t
 #include <pybind11/operators.h>  // for self, self_t, operator!=, operator*
 #include <pybind11/pybind11.h>   // for class_, make_iterator, init, enum_
 #include <pybind11/stl.h>        // for conversion of C++ to py types
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_word_graph
+#include "main.hpp"     // for init_word_graph
+#include "threads.hpp"  // for run_in_threads
 
 namespace libsemigroups {
   namespace py    = pybind11;
   using node_type = uint32_t;
+
+  namespace {
+    constexpr node_type none = static_cast<node_type>(UNDEFINED);
+
+    // Replaces the root of the strongly connected component of every node in
+    // comp by the id of the component, where the components are numbered in
+    // order of their least nodes.
+    void renumber_components(std::vector<node_type>& comp) {
+      std::vector<node_type> id(comp.size(), none);
+      node_type              next = 0;
+      for (auto& c : comp) {
+        if (id[c] == none) {
+          id[c] = next++;
+        }
+        c = id[c];
+      }
+    }
+
+    // Tarjan's algorithm, with an explicit stack instead of recursion, so
+    // that deep word graphs can't overflow the call stack. Sets comp[v] to a
+    // node in the same strongly connected component as v (the same node for
+    // every node in the component).
+    void strongly_connected_components_serial(WordGraph<node_type> const& wg,
+                                              std::vector<node_type>& comp) {
+      size_t const n = wg.number_of_nodes();
+      size_t const m = wg.out_degree();
+
+      std::vector<node_type> index(n, none), low(n), stack;
+      std::vector<bool>      on_stack(n, false);
+      // Pairs (node, next label to follow)
+      std::vector<std::pair<node_type, size_t>> calls;
+      node_type                                 next_index = 0;
+
+      auto visit = [&](node_type v) {
+        index[v] = low[v] = next_index++;
+        stack.push_back(v);
+        on_stack[v] = true;
+        calls.emplace_back(v, 0);
+      };
+
+      comp.assign(n, none);
+      for (node_type s = 0; s < n; ++s) {
+        if (index[s] != none) {
+          continue;
+        }
+        visit(s);
+        while (!calls.empty()) {
+          node_type const v = calls.back().first;
+          if (calls.back().second < m) {
+            node_type const u = wg.target_no_checks(v, calls.back().second++);
+            if (u == none) {
+              continue;
+            } else if (index[u] == none) {
+              visit(u);
+            } else if (on_stack[u]) {
+              low[v] = std::min(low[v], index[u]);
+            }
+            continue;
+          }
+          calls.pop_back();
+          if (low[v] == index[v]) {
+            node_type w;
+            do {
+              w = stack.back();
+              stack.pop_back();
+              on_stack[w] = false;
+              comp[w]     = v;
+            } while (w != v);
+          }
+          if (!calls.empty()) {
+            node_type const p = calls.back().first;
+            low[p]            = std::min(low[p], low[v]);
+          }
+        }
+      }
+    }
+
+    // Calls f(v, out) for every v in frontier, in parallel if frontier is
+    // large enough for this to be worthwhile, where f pushes the nodes to be
+    // processed next onto out, and returns the concatenation of all the outs.
+    template <typename Func>
+    std::vector<node_type> process_frontier(
+        std::vector<node_type> const& frontier,
+        size_t                        number_of_threads,
+        Func&&                        f) {
+      constexpr size_t threshold = 1'024;
+      if (frontier.size() < threshold) {
+        number_of_threads = 1;
+      }
+      number_of_threads = std::max(
+          size_t(1), std::min(number_of_threads, frontier.size()));
+      std::vector<std::vector<node_type>> out(number_of_threads);
+      size_t const                        chunk
+          = (frontier.size() + number_of_threads - 1) / number_of_threads;
+      run_in_threads(
+          frontier.size(), number_of_threads, [&](size_t first, size_t last) {
+            auto& local = out[first / std::max(chunk, size_t(1))];
+            for (size_t i = first; i < last; ++i) {
+              f(frontier[i], local);
+            }
+          });
+      for (size_t i = 1; i < out.size(); ++i) {
+        out[0].insert(out[0].end(), out[i].begin(), out[i].end());
+      }
+      return std::move(out[0]);
+    }
+
+    // The algorithm of Hong, Rodia, and Olukotun (2013):
+    //
+    // 1. nodes with no in- or out-neighbours are repeatedly trimmed, since
+    //    these form strongly connected components by themselves;
+    // 2. the (typically giant) strongly connected component of a pivot node
+    //    is found as the set of nodes reachable both forwards and backwards
+    //    from the pivot;
+    // 3. the remaining components are found using the colouring algorithm
+    //    of Orzan (2004). In each round, the largest node that can reach
+    //    each remaining node v is propagated forwards to colour[v], and then
+    //    the nodes with colour r that can reach r (propagated backwards from
+    //    the roots r, those with colour[r] = r) form the strongly connected
+    //    component of r.
+    //
+    // Every propagation only visits the nodes whose values changed in the
+    // previous step, and each step is performed in parallel.
+    void strongly_connected_components_parallel(
+        WordGraph<node_type> const& wg,
+        std::vector<node_type>&     comp,
+        size_t                      number_of_threads) {
+      size_t const n = wg.number_of_nodes();
+      size_t const m = wg.out_degree();
+
+      // The reverse of wg, in compressed sparse row format.
+      std::vector<size_t> in_offsets(n + 1, 0);
+      std::vector<size_t> out_deg(n, 0);
+      for (node_type v = 0; v < n; ++v) {
+        for (size_t a = 0; a < m; ++a) {
+          node_type const u = wg.target_no_checks(v, a);
+          if (u != none) {
+            in_offsets[u + 1]++;
+            out_deg[v]++;
+          }
+        }
+      }
+      for (size_t v = 0; v < n; ++v) {
+        in_offsets[v + 1] += in_offsets[v];
+      }
+      std::vector<node_type> in_nodes(in_offsets[n]);
+      {
+        std::vector<size_t> pos(in_offsets.begin(), in_offsets.end() - 1);
+        for (node_type v = 0; v < n; ++v) {
+          for (size_t a = 0; a < m; ++a) {
+            node_type const u = wg.target_no_checks(v, a);
+            if (u != none) {
+              in_nodes[pos[u]++] = v;
+            }
+          }
+        }
+      }
+
+      comp.assign(n, none);
+
+      // 1. Trimming
+      {
+        std::vector<size_t> in_deg(n);
+        for (size_t v = 0; v < n; ++v) {
+          in_deg[v] = in_offsets[v + 1] - in_offsets[v];
+        }
+        std::vector<node_type> queue;
+        for (node_type v = 0; v < n; ++v) {
+          if (in_deg[v] == 0 || out_deg[v] == 0) {
+            comp[v] = v;
+            queue.push_back(v);
+          }
+        }
+        for (size_t i = 0; i < queue.size(); ++i) {
+          node_type const v = queue[i];
+          for (size_t a = 0; a < m; ++a) {
+            node_type const u = wg.target_no_checks(v, a);
+            if (u != none && comp[u] == none && --in_deg[u] == 0) {
+              comp[u] = u;
+              queue.push_back(u);
+            }
+          }
+          for (size_t j = in_offsets[v]; j < in_offsets[v + 1]; ++j) {
+            node_type const u = in_nodes[j];
+            if (comp[u] == none && --out_deg[u] == 0) {
+              comp[u] = u;
+              queue.push_back(u);
+            }
+          }
+        }
+      }
+
+      std::vector<node_type> active;
+      for (node_type v = 0; v < n; ++v) {
+        if (comp[v] == none) {
+          active.push_back(v);
+        }
+      }
+      if (active.empty()) {
+        return;
+      }
+
+      std::vector<std::atomic<bool>> flag(n);
+      for (size_t v = 0; v < n; ++v) {
+        flag[v] = false;
+      }
+
+      // 2. Forwards-backwards from a pivot
+      {
+        node_type const pivot = active[0];
+        std::vector<std::atomic<bool>> forwards(n);
+        for (size_t v = 0; v < n; ++v) {
+          forwards[v] = false;
+        }
+        forwards[pivot]                 = true;
+        std::vector<node_type> frontier = {pivot};
+        while (!frontier.empty()) {
+          frontier = process_frontier(
+              frontier,
+              number_of_threads,
+              [&](node_type v, std::vector<node_type>& out) {
+                for (size_t a = 0; a < m; ++a) {
+                  node_type const u = wg.target_no_checks(v, a);
+                  if (u != none && comp[u] == none
+                      && !forwards[u].exchange(true)) {
+                    out.push_back(u);
+                  }
+                }
+              });
+        }
+        // Every node on a path from a node in the component of pivot to
+        // pivot also belongs to the component, and so is reachable from
+        // pivot.
+        flag[pivot]                  = true;
+        std::vector<node_type> found = {pivot};
+        frontier                     = found;
+        while (!frontier.empty()) {
+          frontier = process_frontier(
+              frontier,
+              number_of_threads,
+              [&](node_type u, std::vector<node_type>& out) {
+                for (size_t j = in_offsets[u]; j < in_offsets[u + 1]; ++j) {
+                  node_type const v = in_nodes[j];
+                  if (forwards[v] && !flag[v].exchange(true)) {
+                    out.push_back(v);
+                  }
+                }
+              });
+          found.insert(found.end(), frontier.begin(), frontier.end());
+        }
+        for (auto v : found) {
+          comp[v] = pivot;
+          flag[v] = false;
+        }
+        active.erase(std::remove_if(active.begin(),
+                                    active.end(),
+                                    [&comp](node_type v) {
+                                      return comp[v] != none;
+                                    }),
+                     active.end());
+      }
+
+      // 3. Colouring
+      std::vector<std::atomic<node_type>> colour(n);
+      while (!active.empty()) {
+        // Forwards
+        for (auto v : active) {
+          colour[v] = v;
+        }
+        std::vector<node_type> frontier = active;
+        while (!frontier.empty()) {
+          frontier = process_frontier(
+              frontier,
+              number_of_threads,
+              [&](node_type v, std::vector<node_type>& out) {
+                node_type const c = colour[v].load(std::memory_order_relaxed);
+                for (size_t a = 0; a < m; ++a) {
+                  node_type const u = wg.target_no_checks(v, a);
+                  if (u == none || comp[u] != none) {
+                    continue;
+                  }
+                  node_type d = colour[u].load(std::memory_order_relaxed);
+                  while (d < c && !colour[u].compare_exchange_weak(d, c)) {
+                  }
+                  if (d < c && !flag[u].exchange(true)) {
+                    out.push_back(u);
+                  }
+                }
+              });
+          for (auto u : frontier) {
+            flag[u] = false;
+          }
+        }
+
+        // Backwards, flag[v] = true means v is in the component of colour[v]
+        frontier.clear();
+        for (auto v : active) {
+          if (colour[v] == v) {
+            flag[v] = true;
+            frontier.push_back(v);
+          }
+        }
+        std::vector<node_type> found = frontier;
+        while (!frontier.empty()) {
+          frontier = process_frontier(
+              frontier,
+              number_of_threads,
+              [&](node_type u, std::vector<node_type>& out) {
+                node_type const c = colour[u].load(std::memory_order_relaxed);
+                for (size_t j = in_offsets[u]; j < in_offsets[u + 1]; ++j) {
+                  node_type const v = in_nodes[j];
+                  if (comp[v] == none
+                      && colour[v].load(std::memory_order_relaxed) == c
+                      && !flag[v].exchange(true)) {
+                    out.push_back(v);
+                  }
+                }
+              });
+          found.insert(found.end(), frontier.begin(), frontier.end());
+        }
+
+        for (auto v : found) {
+          comp[v] = colour[v];
+          flag[v] = false;
+        }
+        active.erase(std::remove_if(active.begin(),
+                                    active.end(),
+                                    [&comp](node_type v) {
+                                      return comp[v] != none;
+                                    }),
+                     active.end());
+      }
+    }
+  }  // namespace
+
   void init_gabow(py::module& m) {
     ////////////////////////////////////////////////////////////////////////
     // Gabow
@@ -149,6 +489,47 @@ construct the :any:`Gabow` instance.
    components (if they are not already known).
 )pbdoc");
 
+    thing.def(
+        "component_ids",
+        [](Gabow_& self) {
+          size_t const n = self.word_graph().number_of_nodes();
+          // Trigger the computation of the components
+          self.number_of_components();
+          py::array_t<node_type> result(n);
+          node_type*             out = result.mutable_data();
+          {
+            py::gil_scoped_release release;
+            for (node_type v = 0; v < n; ++v) {
+              out[v] = self.id(v);
+            }
+          }
+          return result;
+        },
+        R"pbdoc(
+:sig=(self: Gabow) -> numpy.ndarray:
+
+Returns the id-numbers of the strongly connected components of all nodes.
+
+This function returns a numpy array of ``numpy.uint32`` whose entry in
+position ``n`` is :any:`Gabow.id` of the node *n*, for every node of
+:any:`Gabow.word_graph`.
+
+:returns: The id-numbers of the components of the nodes.
+:rtype: numpy.ndarray
+
+.. note::
+   This function triggers the computation of the strongly connected
+   components (if they are not already known).
+
+.. doctest::
+
+   >>> from libsemigroups_pybind11 import Gabow, WordGraph
+   >>> g = Gabow(WordGraph(4, [[1, 2], [0, 3], [2, 2], [3, 1]]))
+   >>> ids = g.component_ids()
+   >>> [g.id(n) for n in range(4)] == ids.tolist()
+   True
+)pbdoc");
+
     thing.def("components",
               &Gabow_::components,
               R"pbdoc(
@@ -323,6 +704,71 @@ minimum node of that component, with edges oriented away from the root.
    components (if they are not already known).
 )pbdoc");
 
+    m.def(
+        "word_graph_strongly_connected_components",
+        [](WordGraph<node_type> const& wg, size_t number_of_threads) {
+          std::vector<node_type> comp;
+          {
+            py::gil_scoped_release release;
+            if (number_of_threads <= 1) {
+              strongly_connected_components_serial(wg, comp);
+            } else {
+              strongly_connected_components_parallel(
+                  wg, comp, number_of_threads);
+            }
+            renumber_components(comp);
+          }
+          py::array_t<node_type> result(comp.size());
+          std::copy(comp.begin(), comp.end(), result.mutable_data());
+          return result;
+        },
+        py::arg("wg"),
+        py::arg("number_of_threads") = 1,
+        R"pbdoc(
+:sig=(wg: WordGraph, number_of_threads: int = 1) -> numpy.ndarray:
+
+Returns the strongly connected components of a word graph as an array.
+
+This function returns a numpy array of ``numpy.uint32`` whose entry in
+position ``n`` is the index of the strongly connected component of *wg*
+containing the node ``n``, where the components are numbered in increasing
+order of their least nodes. In particular, two nodes belong to the same
+strongly connected component if and only if they have the same entry in the
+returned array, and the number of components is one more than its maximum.
+
+Neither algorithm used by this function is recursive, and so this function
+uses a constant amount of call stack, and can be used with word graphs
+containing very long paths. If *number_of_threads* is ``1``, then
+Tarjan's algorithm is used, which is linear in the number of edges of *wg*. If
+*number_of_threads* is greater than ``1``, then the algorithm of Hong, Rodia,
+and Olukotun is used: nodes that are trivially components by themselves are
+trimmed, the component of a pivot node is found by searching forwards and
+backwards from it, and the remaining components are found using the colouring
+algorithm of Orzan. The searches and the colouring process the nodes in
+parallel using *number_of_threads* threads. This is fastest for word graphs
+with one large strongly connected component (such as Cayley graphs of
+groups), and for word graphs with many large components the serial version
+may be faster. In both cases, the GIL is not held.
+
+:param wg: the word graph.
+:type wg: WordGraph
+
+:param number_of_threads: the number of threads to use (default: ``1``).
+:type number_of_threads: int
+
+:returns: The index of the component of every node.
+:rtype: numpy.ndarray
+
+.. doctest::
+
+   >>> from libsemigroups_pybind11 import WordGraph, word_graph
+   >>> wg = WordGraph(4, [[1, 2], [0, 3], [2, 2], [3, 1]])
+   >>> word_graph.strongly_connected_components(wg)
+   array([0, 0, 1, 0], dtype=uint32)
+   >>> word_graph.strongly_connected_components(wg, 2)
+   array([0, 0, 1, 0], dtype=uint32)
+)pbdoc");
+
     thing.def("word_graph",
               &Gabow_::word_graph,
               py::return_value_policy::reference_internal,
@@ -0,0 +1,209 @@
+//
+// libsemigroups_pybind11
+// Copyright (C) 2024 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint8_t
+#include <string>   // for string
+#include <vector>   // for vector
+
+// libsemigroups headers
+#include <libsemigroups/config.hpp>  // for LIBSEMIGROUPS_HPCOMBI_ENABLED
+
+#ifdef LIBSEMIGROUPS_HPCOMBI_ENABLED
+#include <libsemigroups/adapters.hpp>   // for Product
+#include <libsemigroups/exception.hpp>  // for LIBSEMIGROUPS_EXCEPTION
+#include <libsemigroups/hpcombi.hpp>    // for Transf16, PPerm16, Perm16
+#endif
+
+// pybind11....
+#include <pybind11/operators.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+// libsemigroups_pybind11....
+#include "main.hpp"  // for init_hpcombi
+
+namespace libsemigroups {
+  namespace py = pybind11;
+
+#ifdef LIBSEMIGROUPS_HPCOMBI_ENABLED
+  namespace {
+    // The HPCombi element types always have degree 16, and store their
+    // images in a single 128-bit register, so that products etc are computed
+    // using SSE instructions. Points not in the list of images passed to the
+    // constructor are fixed, and undefined images (of partial perms) are
+    // stored as 0xFF.
+    template <typename Element>
+    void bind_hpcombi_element(py::module&        m,
+                              std::string const& name,
+                              std::string const& long_name) {
+      py::class_<Element> thing(m,
+                                name.c_str(),
+                                fmt::format(R"pbdoc(
+A {0} of degree 16 implemented using HPCombi.
+
+This class is only available if libsemigroups was compiled with HPCombi
+enabled, i.e. if ``LIBSEMIGROUPS_HPCOMBI_ENABLED`` is ``True``. Instances of this class can
+be used as generators for a :any:`FroidurePin`, which then computes products
+of elements using SIMD instructions.
+)pbdoc",
+                                            long_name)
+                                    .c_str());
+
+      thing.def(py::init([](std::vector<int_or_unsigned_constant<uint8_t>> const&
+                                 imgs) {
+                  if (imgs.size() > 16) {
+                    LIBSEMIGROUPS_EXCEPTION(
+                        "expected a list of at most 16 images, found {}",
+                        imgs.size());
+                  }
+                  Element result = Element::one();
+                  auto    vals   = to_ints<uint8_t>(imgs);
+                  for (size_t i = 0; i < vals.size(); ++i) {
+                    result[i] = vals[i];
+                  }
+                  if (!result.validate()) {
+                    LIBSEMIGROUPS_EXCEPTION(
+                        "the argument does not define a valid element");
+                  }
+                  return result;
+                }),
+                py::arg("imgs"),
+                fmt::format(R"pbdoc(
+:sig=(self: {0}, imgs: list[int | Undefined]) -> None:
+
+Construct from a list of images.
+
+The image of the point ``i`` is ``imgs[i]`` if ``i < len(imgs)`` and ``i``
+otherwise.
+
+:param imgs: the list of images.
+:type imgs: list[int | Undefined]
+
+:raises LibsemigroupsError:
+  if *imgs* has length greater than 16, or does not define a valid {1}.
+)pbdoc",
+                            name,
+                            long_name)
+                    .c_str());
+
+      thing.def(py::self == py::self);
+      thing.def(py::self != py::self);
+      thing.def(py::self < py::self);
+
+      thing.def("__mul__", [](Element const& x, Element const& y) {
+        Element result;
+        Product<Element>()(result, x, y);
+        return result;
+      });
+
+      thing.def(
+          "__getitem__",
+          [](Element const& self,
+             size_t         i) -> int_or_unsigned_constant<uint8_t> {
+            if (i >= 16) {
+              throw py::index_error(
+                  fmt::format("index out of range, expected a value in [0, "
+                              "16), found {}",
+                              i));
+            }
+            return from_int<uint8_t>(self[i]);
+          },
+          py::is_operator());
+
+      thing.def("__hash__", [](Element const& self) {
+        return std::hash<Element>()(self);
+      });
+
+      thing.def("__repr__", [name](Element const& self) {
+        std::string result = name + "([";
+        for (size_t i = 0; i < 16; ++i) {
+          result += (i == 0 ? "" : ", ");
+          result += (self[i] == 0xFF ? std::string("UNDEFINED")
+                                     : std::to_string(self[i]));
+        }
+        return result + "])";
+      });
+
+      thing.def(
+          "degree",
+          [](Element const&) { return 16; },
+          R"pbdoc(
+:sig=(self: Element) -> int:
+
+Returns the degree, which is always 16.
+
+:returns: The degree.
+:rtype: int
+)pbdoc");
+
+      thing.def(
+          "images",
+          [](Element const& self) {
+            std::vector<int_or_unsigned_constant<uint8_t>> result;
+            for (size_t i = 0; i < 16; ++i) {
+              result.push_back(from_int<uint8_t>(self[i]));
+            }
+            return result;
+          },
+          R"pbdoc(
+:sig=(self: Element) -> list[int | Undefined]:
+
+Returns the list of images.
+
+:returns: The images of the points ``0`` to ``15``.
+:rtype: list[int | Undefined]
+)pbdoc");
+
+      thing.def(
+          "rank",
+          [](Element const& self) { return self.rank(); },
+          R"pbdoc(
+:sig=(self: Element) -> int:
+
+Returns the size of the image.
+
+:returns: The rank.
+:rtype: int
+)pbdoc");
+
+      thing.def_static(
+          "one",
+          []() { return Element::one(); },
+          R"pbdoc(
+:sig=() -> Element:
+
+Returns the identity of degree 16.
+
+:returns: The identity.
+:rtype: Element
+)pbdoc");
+    }
+  }  // namespace
+#endif
+
+  void init_hpcombi([[maybe_unused]] py::module& m) {
+#ifdef LIBSEMIGROUPS_HPCOMBI_ENABLED
+    bind_hpcombi_element<HPCombi::Transf16>(
+        m, "HPCombiTransf16", "transformation");
+    bind_hpcombi_element<HPCombi::PPerm16>(
+        m, "HPCombiPPerm16", "partial permutation");
+    bind_hpcombi_element<HPCombi::Perm16>(m, "HPCombiPerm16", "permutation");
+#endif
+  }
+}  // namespace libsemigroups
@@ -16,23 +16,48 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
+// C++ stl headers....
+#include <cstddef>   // for size_t
+#include <optional>  // for optional
+#include <vector>    // for vector
+
 // libsemigroups headers
 #include <libsemigroups/kambites.hpp>
 #include <libsemigroups/to-froidure-pin.hpp>
 
 // pybind11....
+#include <pybind11/numpy.h>  // for array_t
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
-#include "cong-common.hpp"  // for contains etc
-#include "main.hpp"         // for init_kambites
+#include "cong-common.hpp"   // for contains etc
+#include "main.hpp"          // for init_kambites
+#include "packed-words.hpp"  // for packed_letters, unpack_words
+#include "threads.hpp"       // for run_in_threads
 
 namespace libsemigroups {
   using std::literals::operator""sv;
   namespace py = pybind11;
 
   namespace {
+    // Runs self, checks that its small overlap class is at least 4, and
+    // reduces every relation word. Kambites computes the decomposition of
+    // each relation word into pieces lazily, the first time it is required,
+    // so afterwards these are stored in self, and in any copy of self.
+    template <typename Kambites_>
+    void precompute(Kambites_& self) {
+      self.run();
+      if (self.small_overlap_class() < 4) {
+        LIBSEMIGROUPS_EXCEPTION(
+            "the small overlap class must be at least 4, found {}",
+            self.small_overlap_class());
+      }
+      for (auto const& w : self.presentation().rules) {
+        congruence_common::reduce(self, w);
+      }
+    }
+
     ////////////////////////////////////////////////////////////////////////
     // bind_kambites
     ////////////////////////////////////////////////////////////////////////
@@ -137,6 +162,11 @@ is not at least :math:`4`, then an exception is thrown.)pbdoc"sv;
                  "Kambites",
                  doc{.detail = extra_detail, .raises = extra_raises});
 
+      def_reduce_batch(thing,
+                       "Kambites",
+                       doc{.detail = extra_detail, .raises = extra_raises});
+      def_contains_batch(thing, "Kambites", doc{.raises = extra_raises});
+
       ////////////////////////////////////////////////////////////////////////
       // Kambites specific stuff
       ////////////////////////////////////////////////////////////////////////
@@ -175,6 +205,111 @@ at least :math:`n`.
   relations of the semigroup.
 )pbdoc");
 
+      thing.def(
+          "precompute",
+          [](Kambites_& self) -> Kambites_& {
+            precompute(self);
+            return self;
+          },
+          py::call_guard<py::gil_scoped_release>(),
+          R"pbdoc(
+:sig=(self: Kambites) -> Kambites:
+
+Compute everything required to solve the word problem.
+
+This function runs *self*, computes the :any:`small_overlap_class`, and the
+decomposition of every relation word into pieces (which are otherwise computed
+the first time they are needed by :any:`Kambites.contains` or
+:any:`Kambites.reduce`). A copy of *self* made after calling this function
+does not recompute any of these. The global interpreter lock is released while
+this function runs.
+
+:returns: *self*.
+:rtype: Kambites
+
+:raises LibsemigroupsError:
+    if :any:`small_overlap_class` is not at least :math:`4`.
+)pbdoc");
+
+      thing.def(
+          "contains_batch",
+          [](Kambites_&            self,
+             packed_letters const& letters,
+             packed_offsets const& offsets,
+             size_t                number_of_threads) {
+            using native_word_type = typename Kambites_::native_word_type;
+            auto words = unpack_words<native_word_type>(letters, offsets);
+            if (words.size() % 2 != 0) {
+              LIBSEMIGROUPS_EXCEPTION(
+                  "expected an even number of words, found {}", words.size());
+            }
+            size_t const      k = words.size() / 2;
+            py::array_t<bool> result(k);
+            bool*             out = result.mutable_data();
+            {
+              py::gil_scoped_release release;
+              precompute(self);
+              // self is not modified while the pairs are checked, unless there
+              // is only one thread, and so every other thread can copy it.
+              run_in_threads(
+                  k, number_of_threads, [&](size_t first, size_t last) {
+                    std::optional<Kambites_> copy;
+                    if (first != 0 || last != k) {
+                      copy.emplace(self);
+                    }
+                    Kambites_& kk = copy ? *copy : self;
+                    for (size_t i = first; i < last; ++i) {
+                      out[i] = congruence_common::contains(
+                          kk, words[2 * i], words[2 * i + 1]);
+                    }
+                  });
+            }
+            return result;
+          },
+          py::arg("letters"),
+          py::arg("offsets"),
+          py::arg("number_of_threads") = 1,
+          R"pbdoc(
+:sig=(self: Kambites, letters: numpy.ndarray, offsets: numpy.ndarray, number_of_threads: int = 1) -> numpy.ndarray:
+
+Check containment of many pairs of words using several threads.
+
+This function is the same as the previous one, except that
+:any:`Kambites.precompute` is called first, and the pairs are then divided
+between *number_of_threads* threads, each of which checks its pairs using its
+own copy of *self*. The global interpreter lock is released while the pairs
+are checked.
+
+This overload is registered after the previous one, and so a call with only
+*letters* and *offsets* always uses the previous overload; this one is used
+if and only if *number_of_threads* is given, either positionally or as a
+keyword argument. Both overloads return the same values.
+
+:param letters: the letters of the words.
+:type letters: numpy.ndarray
+
+:param offsets: the offsets of the words in *letters*.
+:type offsets: numpy.ndarray
+
+:param number_of_threads: the number of threads to use (defaults to ``1``).
+:type number_of_threads: int
+
+:returns: A boolean array with one entry for each pair.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError:
+  if *letters* or *offsets* is not 1-dimensional, *offsets* is not valid, or
+  the number of words is odd.
+
+:raises LibsemigroupsError:
+  if any of the letters is out of range, i.e. they do not belong to
+  ``presentation().alphabet()`` and
+  :any:`Presentation.throw_if_letter_not_in_alphabet` raises.
+
+:raises LibsemigroupsError:
+    if :any:`small_overlap_class` is not at least :math:`4`.
+)pbdoc");
+
       thing.def("ukkonen",
                 &Kambites_::ukkonen,
                 py::return_value_policy::reference_internal,
@@ -220,6 +355,12 @@ is used to determine the pieces, and decompositions of the relation words.
           "kambites",
           doc{.only_document_once = true, .raises = extra_raises, .var = "k"});
 
+      def_normal_forms_batches<Kambites_>(
+          m,
+          "Kambites",
+          "kambites",
+          doc{.only_document_once = true, .raises = extra_raises, .var = "k"});
+
       // No prefix because not in a subpackage
       m.def(
           "is_obviously_infinite",
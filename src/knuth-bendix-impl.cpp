@@ -410,11 +410,14 @@ to the re-initialisation of rules where possible.
 
       thing.def("confluent",
                 &KnuthBendixImpl<Rewriter>::confluent,
+                py::call_guard<py::gil_scoped_release>(),
                 R"pbdoc(
 :sig=(self: KnuthBendix) -> bool:
 
 Check `confluence <https://w.wiki/9DA>`_ of the current rules.
 
+The global interpreter lock is released while confluence is checked.
+
 :return: ``True`` if the :py:class:`KnuthBendix`
   instance is confluent and ``False`` if it is not.
 :rtype: bool
@@ -459,7 +462,8 @@ The semigroup is finite if the graph is acyclic, and infinite otherwise.
 
 .. seealso:: :any:`number_of_classes` and :any:`knuth_bendix.normal_forms`.
 )pbdoc",
-          py::return_value_policy::reference_internal);
+          py::return_value_policy::reference_internal,
+          py::call_guard<py::gil_scoped_release>());
 
       ////////////////////////////////////////////////////////////////////////
       // Helpers
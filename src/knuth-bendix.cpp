@@ -16,7 +16,16 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
+// C++ stl headers....
+#include <algorithm>    // for sort
+#include <cstddef>      // for size_t
+#include <cstdint>      // for int64_t, uint32_t
+#include <string>       // for string
+#include <type_traits>  // for is_same_v
+#include <vector>       // for vector
+
 // libsemigroups headers
+#include <libsemigroups/exception.hpp>  // for LIBSEMIGROUPS_EXCEPTION
 #include <libsemigroups/knuth-bendix-helpers.hpp>
 #include <libsemigroups/knuth-bendix.hpp>
 
@@ -26,14 +35,72 @@
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
-#include "cong-common.hpp"  // for def_construct_default
-#include "main.hpp"         // for init_knuth_bendix
+#include "cong-common.hpp"   // for def_construct_default
+#include "main.hpp"          // for init_knuth_bendix
+#include "packed-words.hpp"  // for pack_words
 
 namespace libsemigroups {
   namespace py = pybind11;
   using std::literals::operator""sv;
 
   namespace {
+    // Returns an estimate of the number of bytes used by kb to store its
+    // active and inactive rules, and by its rewriter to index the left-hand
+    // sides of the active rules. The rules are stored internally as strings
+    // with one byte per letter, regardless of Word. Inactive rules are kept so
+    // that they can be reused, but the lengths of their (cleared) words are
+    // not available, and so only their fixed size is included.
+    template <typename Word, typename Rewriter>
+    py::dict memory_usage(KnuthBendix<Word, Rewriter>& kb) {
+      // Every rule holds its two words, its id, and the links of the list of
+      // rules that it belongs to.
+      size_t const per_rule
+          = 2 * sizeof(std::string) + sizeof(int64_t) + 2 * sizeof(void*);
+
+      std::vector<Word> lhs;
+      size_t            letters = 0;
+      auto              rules   = kb.active_rules();
+      for (auto it = rx::begin(rules); it != rx::end(rules); ++it) {
+        auto const& rule = *it;
+        letters += rule.first.size() + rule.second.size();
+        lhs.push_back(rule.first);
+      }
+      size_t const active   = lhs.size() * per_rule + letters;
+      size_t const inactive = kb.number_of_inactive_rules() * per_rule;
+
+      size_t rewriter;
+      if constexpr (std::is_same_v<Rewriter, detail::RewriteTrie>) {
+        // The trie has one node for every distinct prefix of a left-hand
+        // side, and every node holds a target for every letter, and its
+        // parent, suffix link, height, and whether or not it is terminal.
+        std::sort(lhs.begin(), lhs.end());
+        size_t nodes = 1;
+        for (size_t i = 0; i < lhs.size(); ++i) {
+          size_t lcp = 0;
+          if (i != 0) {
+            auto const& u = lhs[i - 1];
+            auto const& v = lhs[i];
+            while (lcp < u.size() && lcp < v.size() && u[lcp] == v[lcp]) {
+              ++lcp;
+            }
+          }
+          nodes += lhs[i].size() - lcp;
+        }
+        rewriter = nodes * (kb.presentation().alphabet().size() + 4)
+                   * sizeof(uint32_t);
+      } else {
+        // Every active rule is a node in a balanced binary search tree.
+        rewriter = lhs.size() * 5 * sizeof(void*);
+      }
+
+      py::dict result;
+      result["active_rules"]   = active;
+      result["inactive_rules"] = inactive;
+      result["rewriter"]       = rewriter;
+      result["total"]          = active + inactive + rewriter;
+      return result;
+    }
+
     template <typename Word, typename Rewriter>
     void bind_knuth_bendix(py::module& m, std::string const& name) {
       using KnuthBendix_     = KnuthBendix<Word, Rewriter>;
@@ -108,6 +175,48 @@ the current rules in the :py:class:`KnuthBendix` instance.
 
       def_reduce_no_run(thing, "KnuthBendix", doc{.detail = extra_detail});
       def_reduce(thing, "KnuthBendix");
+      def_reduce_batch(thing, "KnuthBendix");
+      def_contains_batch(thing, "KnuthBendix");
+
+      // The rules of the rewriting system cannot be restored using the public
+      // API of KnuthBendix, and so only the definition of the congruence and
+      // the values of the settings are pickled. An instance that has started
+      // but not finished would lose its progress, and so it cannot be pickled.
+      thing.def(py::pickle(
+          [](KnuthBendix_ const& self) {
+            if (self.started() && !self.finished()) {
+              LIBSEMIGROUPS_EXCEPTION(
+                  "cannot pickle a KnuthBendix instance that has started but "
+                  "not finished");
+            }
+            return py::make_tuple(
+                static_cast<int>(self.kind()),
+                self.presentation(),
+                self.generating_pairs(),
+                py::make_tuple(self.max_pending_rules(),
+                               self.check_confluence_interval(),
+                               self.max_overlap(),
+                               self.max_rules(),
+                               static_cast<int>(self.overlap_policy())));
+          },
+          [](py::tuple const& state) {
+            using overlap = typename KnuthBendixImpl_::options::overlap;
+            KnuthBendix_ result(
+                static_cast<congruence_kind>(state[0].cast<int>()),
+                state[1].cast<Presentation<Word>>());
+            auto pairs = state[2].cast<std::vector<Word>>();
+            for (size_t i = 0; i + 1 < pairs.size(); i += 2) {
+              congruence_common::add_generating_pair(
+                  result, pairs[i], pairs[i + 1]);
+            }
+            auto settings = state[3].cast<py::tuple>();
+            result.max_pending_rules(settings[0].cast<size_t>())
+                .check_confluence_interval(settings[1].cast<size_t>())
+                .max_overlap(settings[2].cast<size_t>())
+                .max_rules(settings[3].cast<size_t>())
+                .overlap_policy(static_cast<overlap>(settings[4].cast<int>()));
+            return result;
+          }));
 
       thing.def(
           "active_rules",
@@ -131,6 +240,51 @@ entry.
 :rtype: collections.abc.Iterator[tuple[str, str]]
 )pbdoc");
 
+      thing.def("memory_usage",
+                &memory_usage<Word, Rewriter>,
+                R"pbdoc(
+:sig=(self: KnuthBendix) -> dict[str, int]:
+
+Returns an estimate of the memory used by the rules and the rewriter.
+
+This function returns a dictionary containing an estimate of the number of
+bytes used to store the rules of a :any:`KnuthBendix` instance, where the
+keys are:
+
+* ``"active_rules"``: the active rules, including their letters;
+* ``"inactive_rules"``: the inactive rules, which are retained so that they
+  can be reused, not including any memory used by their (cleared) words;
+* ``"rewriter"``: the data structure used by the rewriter to find the active
+  rules whose left-hand sides occur in a word. If the keyword argument
+  ``rewriter`` was ``"RewriteTrie"`` when constructing the
+  :any:`KnuthBendix` instance, then this is a trie (an Aho-Corasick automaton)
+  containing the left-hand sides, and if it was ``"RewriteFromLeft"``, then
+  this is a search tree of the active rules;
+* ``"total"``: the sum of the other values.
+
+This function does not trigger any enumeration, and can be used, for
+example, to compare the memory used by the two rewriters on the same
+presentation. The rules are copied by this function, which takes time linear
+in the total length of the active rules.
+
+:returns: The estimated number of bytes used.
+:rtype: dict[str, int]
+
+.. doctest::
+
+   >>> from libsemigroups_pybind11 import (KnuthBendix, Presentation,
+   ... presentation, congruence_kind)
+   >>> p = Presentation("abc")
+   >>> presentation.add_rule(p, "aaaa", "a")
+   >>> presentation.add_rule(p, "bb", "b")
+   >>> presentation.add_rule(p, "ab", "ba")
+   >>> kb = KnuthBendix(congruence_kind.twosided, p)
+   >>> kb.run()
+   >>> usage = kb.memory_usage()
+   >>> usage["total"] == usage["active_rules"] + usage["inactive_rules"] + usage["rewriter"]
+   True
+)pbdoc");
+
       thing.def("gilman_graph_node_labels",
                 &KnuthBendix_::gilman_graph_node_labels,
                 R"pbdoc(
@@ -163,6 +317,17 @@ unique prefixes of the left-hand sides of the rules of the rewriting system.
           "knuth_bendix",
           doc{.only_document_once = true, .var = "kb"});
 
+      def_normal_forms_batches<KnuthBendix_>(
+          m,
+          "KnuthBendix",
+          "knuth_bendix",
+          doc{.detail             = R"pbdoc(
+This function triggers a full enumeration of *kb*. If the number of classes
+is infinite, then the returned iterator never stops, but each batch is still
+finite.)pbdoc",
+              .only_document_once = true,
+              .var                = "kb"});
+
       ////////////////////////////////////////////////////////////////////////
       // Helper functions - specific to KnuthBendix
       ////////////////////////////////////////////////////////////////////////
@@ -215,6 +380,7 @@ construct *kb*. This function triggers a full enumeration of *kb*.
           "knuth_bendix_by_overlap_length",
           [](KnuthBendix_& kb) { knuth_bendix::by_overlap_length(kb); },
           py::arg("kb"),
+          py::call_guard<py::gil_scoped_release>(),
           R"pbdoc(
 :sig=(kb: KnuthBendix) -> None:
 :only-document-once:
@@ -226,6 +392,7 @@ This function runs the Knuth-Bendix algorithm on the rewriting system
 represented by a :any:`KnuthBendix` instance by considering all overlaps of a
 given length :math:`n` (according to the :any:`KnuthBendix.options.overlap`)
 before those overlaps of length :math:`n + 1`.
+The global interpreter lock is released while the algorithm runs.
 
 :param kb: the :any:`KnuthBendix` instance.
 :type kb: KnuthBendix
@@ -385,6 +552,38 @@ Copy a :any:`NormalFormRange` object.
                   return self.min(val);
                 });
       thing.def("next", [](NormalFormRange& nfr) { nfr.next(); });
+
+      thing.def(
+          "next_batch",
+          [](NormalFormRange& nfr, size_t n) {
+            std::vector<Word> words;
+            {
+              py::gil_scoped_release release;
+              for (; words.size() < n && !nfr.at_end(); nfr.next()) {
+                words.push_back(nfr.get());
+              }
+            }
+            return pack_words(words);
+          },
+          py::arg("n"),
+          R"pbdoc(
+:sig=(self: Range, n: int) -> tuple[numpy.ndarray, numpy.ndarray]:
+
+Get and consume the next (at most) *n* words of the range.
+
+This function returns the next (at most) *n* words of the range as a tuple
+``(letters, offsets)`` of flat arrays, where the *i*-th word is
+``letters[offsets[i]:offsets[i + 1]]``, and advances the range past them. If
+the words are strings, then the letters are the code points of the characters.
+Fewer than *n* words are returned only if the end of the range is reached. The
+global interpreter lock is released while the words are found.
+
+:param n: the maximum number of words.
+:type n: int
+
+:returns: A tuple of arrays containing the words.
+:rtype: tuple[numpy.ndarray, numpy.ndarray]
+)pbdoc");
     }  // bind_normal_form_range
   }    // namespace
 
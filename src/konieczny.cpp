@@ -249,6 +249,7 @@ any call to a non-const member function of the :any:`Konieczny` class.
       thing.def("contains",
                 &Konieczny_::contains,
                 py::arg("x"),
+                py::call_guard<py::gil_scoped_release>(),
                 R"pbdoc(
 :sig=(self: Konieczny, x: Element) -> bool:
 
@@ -389,6 +390,7 @@ Returns the current size.
           [](Konieczny_& self, Element const& x) ->
           typename Konieczny_::DClass& { return self.D_class_of_element(x); },
           py::arg("x"),
+          py::call_guard<py::gil_scoped_release>(),
           R"pbdoc(
 :sig=(self: Konieczny, x: Element) -> Konieczny.DClass:
 
@@ -459,6 +461,7 @@ and ``False`` if it is not.
 )pbdoc");
       thing.def("number_of_D_classes",
                 &Konieczny_::number_of_D_classes,
+                py::call_guard<py::gil_scoped_release>(),
                 R"pbdoc(
 :sig=(self: Konieczny) -> int:
 
@@ -488,6 +491,7 @@ generators.
 )pbdoc");
       thing.def("number_of_H_classes",
                 &Konieczny_::number_of_H_classes,
+                py::call_guard<py::gil_scoped_release>(),
                 R"pbdoc(
 :sig=(self: Konieczny) -> int:
 
@@ -500,6 +504,7 @@ Returns the number of :math:`\mathscr{H}`-classes.
 )pbdoc");
       thing.def("number_of_idempotents",
                 &Konieczny_::number_of_idempotents,
+                py::call_guard<py::gil_scoped_release>(),
                 R"pbdoc(
 :sig=(self: Konieczny) -> int:
 
@@ -512,6 +517,7 @@ Returns the number of idempotents.
 )pbdoc");
       thing.def("number_of_L_classes",
                 &Konieczny_::number_of_L_classes,
+                py::call_guard<py::gil_scoped_release>(),
                 R"pbdoc(
 :sig=(self: Konieczny) -> int:
 
@@ -524,6 +530,7 @@ Returns the number of :math:`\mathscr{L}`-classes.
 )pbdoc");
       thing.def("number_of_R_classes",
                 &Konieczny_::number_of_R_classes,
+                py::call_guard<py::gil_scoped_release>(),
                 R"pbdoc(
 :sig=(self: Konieczny) -> int:
 
@@ -536,6 +543,7 @@ Returns the number of :math:`\mathscr{R}`-classes.
 )pbdoc");
       thing.def("number_of_regular_D_classes",
                 &Konieczny_::number_of_regular_D_classes,
+                py::call_guard<py::gil_scoped_release>(),
                 R"pbdoc(
 :sig=(self: Konieczny) -> int:
 
@@ -548,6 +556,7 @@ Returns the number of regular :math:`\mathscr{D}`-classes.
 )pbdoc");
       thing.def("number_of_regular_elements",
                 &Konieczny_::number_of_regular_elements,
+                py::call_guard<py::gil_scoped_release>(),
                 R"pbdoc(
 :sig=(self: Konieczny) -> int:
 
@@ -560,6 +569,7 @@ Returns the number of regular elements.
 )pbdoc");
       thing.def("number_of_regular_L_classes",
                 &Konieczny_::number_of_regular_L_classes,
+                py::call_guard<py::gil_scoped_release>(),
                 R"pbdoc(
 :sig=(self: Konieczny) -> int:
 
@@ -572,6 +582,7 @@ Returns the number of regular :math:`\mathscr{L}`-classes.
 )pbdoc");
       thing.def("number_of_regular_R_classes",
                 &Konieczny_::number_of_regular_R_classes,
+                py::call_guard<py::gil_scoped_release>(),
                 R"pbdoc(
 :sig=(self: Konieczny) -> int:
 
@@ -584,12 +595,16 @@ Returns the number of regular :math:`\mathscr{R}`-classes.
 )pbdoc");
       thing.def("size",
                 &Konieczny_::size,
+                py::call_guard<py::gil_scoped_release>(),
                 R"pbdoc(
 :sig=(self: Konieczny) -> int:
 
 Returns the size.
 
-This function triggers a full enumeration.
+This function triggers a full enumeration. The global interpreter lock is
+released while the enumeration runs, as it is by every other function that
+triggers an enumeration, and so several :any:`Konieczny` instances can be
+enumerated at the same time in different Python threads.
 
 :returns: The size.
 :rtype: int
@@ -6,6 +6,8 @@
 
 """This package provides the user-facing python part of libsemigroups_pybind11"""
 
+from importlib import import_module as _import_module
+
 import libsemigroups_pybind11.aho_corasick
 import libsemigroups_pybind11.bipartition
 import libsemigroups_pybind11.blocks
@@ -18,15 +20,12 @@ import libsemigroups_pybind11.knuth_bendix
 import libsemigroups_pybind11.matrix
 import libsemigroups_pybind11.paths
 import libsemigroups_pybind11.pbr
-import libsemigroups_pybind11.sims
-import libsemigroups_pybind11.stephen
 import libsemigroups_pybind11.todd_coxeter
 import libsemigroups_pybind11.ukkonen
 import libsemigroups_pybind11.word_graph
 import libsemigroups_pybind11.words
 
 from ._version import version as __version__
-from .action import Action, LeftAction, RightAction
 from .adapters import ImageLeftAction, ImageRightAction
 from .congruence import Congruence
 from .detail.dot import _Dot as Dot
@@ -34,12 +33,9 @@ from .froidure_pin import FroidurePin
 from .is_obviously_infinite import is_obviously_infinite
 from .kambites import Kambites
 from .knuth_bendix import KnuthBendix
-from .konieczny import Konieczny
 from .matrix import Matrix, MatrixKind
 from .presentation import InversePresentation, Presentation
-from .schreier_sims import SchreierSims
-from .sims import MinimalRepOrc, RepOrc, Sims1, Sims2, SimsRefinerFaithful, SimsRefinerIdeals
-from .stephen import Stephen
+from .progress import ProgressRecord, record_progress
 from .to import to
 from .todd_coxeter import ToddCoxeter
 from .transf import Perm, PPerm, Transf
@@ -75,6 +71,7 @@ try:
         Reporter,
         ReportGuard,
         Runner,
+        SimsPruner,
         SimsStats,
         StringRange,
         ToString,
@@ -92,6 +89,7 @@ try:
         random_string,
         random_strings,
         random_word,
+        random_words,
         recursive_path_compare,
         shortlex_compare,
         side,
@@ -103,9 +101,49 @@ except ModuleNotFoundError as e:
         f"directory? {DISCLAIMER}"
     ) from e
 
+from _libsemigroups_pybind11 import LIBSEMIGROUPS_HPCOMBI_ENABLED
+
+if LIBSEMIGROUPS_HPCOMBI_ENABLED:
+    # pylint: disable=no-name-in-module
+    from _libsemigroups_pybind11 import HPCombiPerm16, HPCombiPPerm16, HPCombiTransf16
+
 # The following fools sphinx into thinking that MatrixKind + Matrix are not
 # aliases.
 Matrix.__module__ = __name__
 Matrix.__name__ = "Matrix"
 MatrixKind.__module__ = __name__
 MatrixKind.__name__ = "MatrixKind"
+
+# The following submodules, and the names they define, are only imported the
+# first time that they are used, since no other submodule depends on them, and
+# importing them all up front noticeably slows down "import
+# libsemigroups_pybind11".
+_LAZY_SUBMODULES = {"action", "konieczny", "schreier_sims", "sims", "stephen"}
+_LAZY_NAMES = {
+    "Action": "action",
+    "LeftAction": "action",
+    "RightAction": "action",
+    "Konieczny": "konieczny",
+    "SchreierSims": "schreier_sims",
+    "MinimalRepOrc": "sims",
+    "RepOrc": "sims",
+    "Sims1": "sims",
+    "Sims2": "sims",
+    "SimsRefinerFaithful": "sims",
+    "SimsRefinerIdeals": "sims",
+    "Stephen": "stephen",
+}
+
+
+def __getattr__(name: str):
+    if name in _LAZY_SUBMODULES:
+        return _import_module(f".{name}", __name__)
+    if name in _LAZY_NAMES:
+        value = getattr(_import_module(f".{_LAZY_NAMES[name]}", __name__), name)
+        globals()[name] = value
+        return value
+    raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
+
+
+def __dir__() -> list[str]:
+    return sorted({*globals(), *_LAZY_SUBMODULES, *_LAZY_NAMES})
@@ -13,7 +13,9 @@ as free functions instead.
 
 from _libsemigroups_pybind11 import (  # pylint: disable=unused-import
     aho_corasick_add_word as add_word,
+    aho_corasick_count_matches as count_matches,
     aho_corasick_dot as dot,
     aho_corasick_rm_word as rm_word,
+    aho_corasick_search_all as search_all,
     aho_corasick_traverse_word as traverse_word,
 )
@@ -10,8 +10,11 @@ contains helper functions for the :any:`Bipartition` class.
 
 from _libsemigroups_pybind11 import (  # pylint: disable=unused-import
     Bipartition,
+    bipartition_from_array as from_array,
     bipartition_one as one,
+    bipartition_product_batch as product_batch,
     bipartition_random as random,
+    bipartition_to_array as to_array,
     bipartition_underlying_partition as underlying_partition,
     bipartition_uniform_random as uniform_random,
 )
@@ -16,9 +16,13 @@ from _libsemigroups_pybind11 import (  # pylint: disable=unused-import
     bmat8_number_of_cols as number_of_cols,
     bmat8_number_of_rows as number_of_rows,
     bmat8_one as one,
+    bmat8_product_batch as product_batch,
     bmat8_random as random,
     bmat8_row_space_basis as row_space_basis,
+    bmat8_row_space_basis_batch as row_space_basis_batch,
     bmat8_row_space_size as row_space_size,
+    bmat8_row_space_size_batch as row_space_size_batch,
     bmat8_rows as rows,
     bmat8_transpose as transpose,
+    bmat8_transpose_batch as transpose_batch,
 )
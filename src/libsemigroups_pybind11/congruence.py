@@ -9,6 +9,8 @@ manipulating :any:`Congruence` objects. All such functions are contained in
 the submodule ``congruence``.
 """
 
+from datetime import timedelta as _timedelta
+
 from typing_extensions import Self as _Self
 
 from _libsemigroups_pybind11 import (
@@ -16,6 +18,7 @@ from _libsemigroups_pybind11 import (
     CongruenceWord as _CongruenceWord,
     congruence_non_trivial_classes as _congruence_non_trivial_classes,
     congruence_partition as _congruence_partition,
+    congruence_race as _congruence_race,
 )
 
 from .detail.congruence_common import CongruenceCommon as _CongruenceCommon
@@ -128,3 +131,13 @@ _register_cxx_wrapped_type(_CongruenceString, Congruence)
 
 partition = _wrap_cxx_free_fn(_congruence_partition)
 non_trivial_classes = _wrap_cxx_free_fn(_congruence_non_trivial_classes)
+
+
+@_copydoc(_congruence_race)
+def race(
+    runners: list[_Kambites | _KnuthBendix | _ToddCoxeter],
+    number_of_threads: int = 1,
+    time_limit: _timedelta | None = None,
+) -> tuple[int | None, list[tuple[str, float]]]:
+    # pylint: disable=missing-function-docstring
+    return _congruence_race([_to_cxx(x) for x in runners], number_of_threads, time_limit)
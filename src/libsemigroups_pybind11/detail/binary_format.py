@@ -0,0 +1,101 @@
+# Copyright (c) 2024 J. D. Mitchell
+#
+# Distributed under the terms of the GPL license version 3.
+#
+# The full license is in the file LICENSE, distributed with this software.
+
+"""This module implements the binary file format used by
+:any:`word_graph.save` and :any:`presentation.save`.
+
+Every file starts with a header of 64 bytes consisting of the magic bytes
+``b"\\x93LSPYBIN"``, the format version and the kind of object stored (both
+little-endian ``uint32``), and 6 little-endian ``uint64`` fields whose meaning
+depends on the kind. The header is followed by a number of flat little-endian
+arrays, each starting at an offset that is a multiple of 64 bytes, so that
+they can be memory-mapped and used in place.
+
+For a word graph with ``n`` nodes and out-degree ``m``, the fields are
+``(n, m, 0, 0, 0, 0)``, and the only array is the ``n * m`` ``uint32``
+targets, with ``2 ** 32 - 1`` representing :any:`UNDEFINED`.
+
+For a presentation, the fields are ``(word, contains_empty_word, a, k, l,
+0)`` where ``word`` is ``0`` for ``list[int]`` and ``1`` for ``str``, and the
+arrays are the alphabet (``a`` values of type ``uint32``), the offsets of the
+words in the rules (``k + 1`` values of type ``uint64``), and the letters of
+those words (``l`` values of type ``uint32``).
+"""
+
+import os
+
+import numpy as np
+
+MAGIC = b"\x93LSPYBIN"
+VERSION = 1
+WORD_GRAPH = 1
+PRESENTATION = 2
+
+_ALIGNMENT = 64
+_HEADER = np.dtype(
+    [("magic", "S8"), ("version", "<u4"), ("kind", "<u4"), ("fields", "<u8", (6,))],
+)
+_KIND_NAME = {WORD_GRAPH: "word graph", PRESENTATION: "presentation"}
+
+
+def _padding(offset: int) -> int:
+    return -offset % _ALIGNMENT
+
+
+def save(path: str | os.PathLike, kind: int, fields: list[int], arrays: list[np.ndarray]) -> None:
+    """Write a header with the given *kind* and *fields*, followed by
+    *arrays*, to the file *path*.
+    """
+    header = np.zeros(1, dtype=_HEADER)
+    header["magic"] = MAGIC
+    header["version"] = VERSION
+    header["kind"] = kind
+    header["fields"][0, : len(fields)] = fields
+    with open(path, "wb") as file:
+        file.write(header.tobytes())
+        offset = _HEADER.itemsize
+        for array in arrays:
+            file.write(b"\0" * _padding(offset))
+            offset += _padding(offset)
+            data = np.ascontiguousarray(array, dtype=array.dtype.newbyteorder("<"))
+            file.write(data.tobytes())
+            offset += data.nbytes
+
+
+def load(
+    path: str | os.PathLike, kind: int, dtypes: list[str], sizes
+) -> tuple[list[int], list[np.ndarray]]:
+    """Memory-map the file *path*, check that it contains an object of the
+    given *kind*, and return the fields of its header and read-only views
+    of its arrays. The ``i``-th array has dtype ``dtypes[i]`` and its length
+    is ``sizes(fields)[i]``.
+    """
+    if os.path.getsize(path) < _HEADER.itemsize:
+        raise ValueError(f"the file {path} is too short to contain a header")
+    data = np.memmap(path, dtype=np.uint8, mode="r")
+    header = data[: _HEADER.itemsize].view(_HEADER)[0]
+    if header["magic"] != MAGIC:
+        raise ValueError(f"the file {path} does not have the expected format")
+    if header["version"] != VERSION:
+        raise ValueError(
+            f"the file {path} has format version {header['version']}, expected {VERSION}"
+        )
+    if header["kind"] != kind:
+        raise ValueError(
+            f"expected the file {path} to contain a {_KIND_NAME[kind]}, but it contains "
+            f"a {_KIND_NAME.get(int(header['kind']), 'unknown object')}"
+        )
+    fields = [int(x) for x in header["fields"]]
+    arrays = []
+    offset = _HEADER.itemsize
+    for dtype, size in zip(dtypes, sizes(fields), strict=True):
+        offset += _padding(offset)
+        nbytes = np.dtype(dtype).itemsize * size
+        if offset + nbytes > len(data):
+            raise ValueError(f"the file {path} is truncated")
+        arrays.append(data[offset : offset + nbytes].view(dtype))
+        offset += nbytes
+    return fields, arrays
@@ -98,16 +98,20 @@ class CxxWrapper:
         If self._cxx_obj requires initialisation, then this should be
         implemented in the __getattr__ method of the derived class.
         """
-        if isinstance(getattr(self._cxx_obj, name), MethodType):
+        if name == "_cxx_obj":
+            # Only reachable if _cxx_obj has not been set, for example, while
+            # unpickling, in which case falling through would recurse forever.
+            raise AttributeError(name)
+        attr = getattr(self._cxx_obj, name)
+        if isinstance(attr, MethodType):
 
             def cxx_fn_wrapper(*args) -> Any:
                 if len(args) == 1 and isinstance(args[0], list):
-                    args = args[0]
-                    return getattr(self._cxx_obj, name)([to_cxx(x) for x in args])
-                return getattr(self._cxx_obj, name)(*(to_cxx(x) for x in args))
+                    return attr([to_cxx(x) for x in args[0]])
+                return attr(*[to_cxx(x) for x in args])
 
             return cxx_fn_wrapper
-        return getattr(self._cxx_obj, name)
+        return attr
 
     def __repr__(self: Self) -> str:
         if self._cxx_obj is not None:
@@ -121,6 +125,16 @@ class CxxWrapper:
             raise NotImplementedError(f"{type(self._cxx_obj)} has no member named __copy__")
         raise NameError("_cxx_obj has not been defined")
 
+    def __getstate__(self: Self) -> Any:
+        # Only the wrapped object is pickled, the python template parameters
+        # are recovered from its type, and any cached return values are
+        # discarded.
+        return self._cxx_obj
+
+    def __setstate__(self: Self, state: Any) -> None:
+        self._cxx_obj = state
+        self.py_template_params = self.py_template_params_from_cxx_obj()
+
     def __eq__(self: Self, that: Self) -> bool:
         if self._cxx_obj is not None:
             if hasattr(self._cxx_obj, "__eq__"):
@@ -162,20 +176,31 @@ def wrap_cxx_mem_fn(cxx_mem_fn: Pybind11Type) -> Callable:
     <cxx_mem_fn> to the returned function.
     """
 
+    name = cxx_mem_fn.__name__
+    cached_val = f"_cached_return_value_{name}"
+
+    # This function is called for every method call on a CxxWrapper, and so
+    # it avoids anything that could fall through to CxxWrapper.__getattr__,
+    # which is comparatively expensive.
     def cxx_mem_fn_wrapper(self, *args):
-        # TODO(1) move the first if-clause into to_cxx?
-        if len(args) == 1 and isinstance(args[0], list):
-            args = [[to_cxx(x) for x in args[0]]]
-        result = getattr(to_cxx(self), cxx_mem_fn.__name__)(*(to_cxx(x) for x in args))
-        if result is to_cxx(self):
+        cxx_obj = self._cxx_obj
+        if args:
+            # TODO(1) move the first if-clause into to_cxx?
+            if len(args) == 1 and isinstance(args[0], list):
+                args = ([to_cxx(x) for x in args[0]],)
+            else:
+                args = [to_cxx(x) for x in args]
+        result = getattr(cxx_obj, name)(*args)
+        if result is cxx_obj:
             return self
-        if type(result) in _CXX_WRAPPED_TYPE_TO_PY_TYPE:
-            cached_val = f"_cached_return_value_{cxx_mem_fn.__name__}"
+        py_type = _CXX_WRAPPED_TYPE_TO_PY_TYPE.get(type(result))
+        if py_type is not None:
             # TODO(1) use args too in cached_val?
-            if hasattr(self, cached_val) and result is to_cxx(getattr(self, cached_val)):
-                return getattr(self, cached_val)
-            result = _CXX_WRAPPED_TYPE_TO_PY_TYPE[type(result)](result)
-            setattr(self, cached_val, result)
+            cached = self.__dict__.get(cached_val)
+            if cached is not None and result is to_cxx(cached):
+                return cached
+            result = py_type(result)
+            self.__dict__[cached_val] = result
             return result
 
         return result
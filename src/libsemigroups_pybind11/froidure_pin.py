@@ -17,6 +17,9 @@ from typing import TypeVar as _TypeVar
 
 from typing_extensions import Self as _Self
 
+from _libsemigroups_pybind11 import (
+    LIBSEMIGROUPS_HPCOMBI_ENABLED as _LIBSEMIGROUPS_HPCOMBI_ENABLED,
+)
 from _libsemigroups_pybind11 import (
     PBR as _PBR,
     Bipartition as _Bipartition,
@@ -70,15 +73,20 @@ from _libsemigroups_pybind11 import (
     Transf1 as _Transf1,
     Transf2 as _Transf2,
     Transf4 as _Transf4,
+    WordGraph as _WordGraph,
     froidure_pin_current_minimal_factorisation as _froidure_pin_current_minimal_factorisation,
     froidure_pin_current_normal_forms as _froidure_pin_current_normal_forms,
     froidure_pin_current_position as _froidure_pin_current_position,
+    froidure_pin_current_positions as _froidure_pin_current_positions,
     froidure_pin_current_rules as _froidure_pin_current_rules,
+    froidure_pin_enumerate_parallel as _froidure_pin_enumerate_parallel,
     froidure_pin_equal_to as _froidure_pin_equal_to,
     froidure_pin_factorisation as _froidure_pin_factorisation,
+    froidure_pin_factorisations as _froidure_pin_factorisations,
     froidure_pin_minimal_factorisation as _froidure_pin_minimal_factorisation,
     froidure_pin_normal_forms as _froidure_pin_normal_forms,
     froidure_pin_position as _froidure_pin_position,
+    froidure_pin_positions as _froidure_pin_positions,
     froidure_pin_product_by_reduction as _froidure_pin_product_by_reduction,
     froidure_pin_rules as _froidure_pin_rules,
     froidure_pin_to_element as _froidure_pin_to_element,
@@ -229,6 +237,27 @@ _register_cxx_wrapped_type(_FroidurePinKEString, FroidurePin)
 _register_cxx_wrapped_type(_FroidurePinKEWord, FroidurePin)
 _register_cxx_wrapped_type(_FroidurePinTCE, FroidurePin)
 
+if _LIBSEMIGROUPS_HPCOMBI_ENABLED:
+    # pylint: disable=no-name-in-module,protected-access
+    from _libsemigroups_pybind11 import (
+        FroidurePinHPCombiPerm16 as _FroidurePinHPCombiPerm16,
+        FroidurePinHPCombiPPerm16 as _FroidurePinHPCombiPPerm16,
+        FroidurePinHPCombiTransf16 as _FroidurePinHPCombiTransf16,
+        HPCombiPerm16 as _HPCombiPerm16,
+        HPCombiPPerm16 as _HPCombiPPerm16,
+        HPCombiTransf16 as _HPCombiTransf16,
+    )
+
+    for _py_type, _fp_type in (
+        (_HPCombiPerm16, _FroidurePinHPCombiPerm16),
+        (_HPCombiPPerm16, _FroidurePinHPCombiPPerm16),
+        (_HPCombiTransf16, _FroidurePinHPCombiTransf16),
+    ):
+        FroidurePin._py_template_params_to_cxx_type[(_py_type,)] = _fp_type
+        FroidurePin._cxx_type_to_py_template_params[_fp_type] = (_py_type,)
+        FroidurePin._all_wrapped_cxx_types.add(_fp_type)
+        _register_cxx_wrapped_type(_fp_type, FroidurePin)
+
 ########################################################################
 # Helpers -- from froidure-pin.cpp
 ########################################################################
@@ -239,12 +268,23 @@ _register_cxx_wrapped_type(_FroidurePinTCE, FroidurePin)
 current_minimal_factorisation = _wrap_cxx_free_fn(_froidure_pin_current_minimal_factorisation)
 current_normal_forms = _wrap_cxx_free_fn(_froidure_pin_current_normal_forms)
 current_position = _wrap_cxx_free_fn(_froidure_pin_current_position)
+current_positions = _wrap_cxx_free_fn(_froidure_pin_current_positions)
 current_rules = _wrap_cxx_free_fn(_froidure_pin_current_rules)
 equal_to = _wrap_cxx_free_fn(_froidure_pin_equal_to)
 factorisation = _wrap_cxx_free_fn(_froidure_pin_factorisation)
+factorisations = _wrap_cxx_free_fn(_froidure_pin_factorisations)
 minimal_factorisation = _wrap_cxx_free_fn(_froidure_pin_minimal_factorisation)
 normal_forms = _wrap_cxx_free_fn(_froidure_pin_normal_forms)
 position = _wrap_cxx_free_fn(_froidure_pin_position)
+positions = _wrap_cxx_free_fn(_froidure_pin_positions)
 product_by_reduction = _wrap_cxx_free_fn(_froidure_pin_product_by_reduction)
 rules = _wrap_cxx_free_fn(_froidure_pin_rules)
 to_element = _wrap_cxx_free_fn(_froidure_pin_to_element)
+
+
+@_copydoc(_froidure_pin_enumerate_parallel)
+def enumerate_parallel(  # pylint: disable=missing-function-docstring
+    gens: list, number_of_threads: int = 1
+) -> tuple[list, _WordGraph]:
+    elements, wg = _froidure_pin_enumerate_parallel([_to_cxx(x) for x in gens], number_of_threads)
+    return [_to_py(x) for x in elements], wg
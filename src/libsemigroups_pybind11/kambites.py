@@ -17,6 +17,7 @@ from _libsemigroups_pybind11 import (
     congruence_kind as _congruence_kind,
     kambites_non_trivial_classes as _kambites_non_trivial_classes,
     kambites_normal_forms as _kambites_normal_forms,
+    kambites_normal_forms_batches as _kambites_normal_forms_batches,
     kambites_partition as _kambites_partition,
 )
 
@@ -73,3 +74,4 @@ _register_cxx_wrapped_type(_KambitesString, Kambites)
 partition = _wrap_cxx_free_fn(_kambites_partition)
 non_trivial_classes = _wrap_cxx_free_fn(_kambites_non_trivial_classes)
 normal_forms = _wrap_cxx_free_fn(_kambites_normal_forms)
+normal_forms_batches = _wrap_cxx_free_fn(_kambites_normal_forms_batches)
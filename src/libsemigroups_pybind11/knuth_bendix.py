@@ -19,6 +19,7 @@ from _libsemigroups_pybind11 import (
     knuth_bendix_is_reduced as _knuth_bendix_is_reduced,
     knuth_bendix_non_trivial_classes as _knuth_bendix_non_trivial_classes,
     knuth_bendix_normal_forms as _knuth_bendix_normal_forms,
+    knuth_bendix_normal_forms_batches as _knuth_bendix_normal_forms_batches,
     knuth_bendix_partition as _knuth_bendix_partition,
     knuth_bendix_redundant_rule as _knuth_bendix_redundant_rule,
 )
@@ -108,5 +109,6 @@ by_overlap_length = _wrap_cxx_free_fn(_knuth_bendix_by_overlap_length)
 is_reduced = _wrap_cxx_free_fn(_knuth_bendix_is_reduced)
 non_trivial_classes = _wrap_cxx_free_fn(_knuth_bendix_non_trivial_classes)
 normal_forms = _wrap_cxx_free_fn(_knuth_bendix_normal_forms)
+normal_forms_batches = _wrap_cxx_free_fn(_knuth_bendix_normal_forms_batches)
 partition = _wrap_cxx_free_fn(_knuth_bendix_partition)
 redundant_rule = _wrap_cxx_free_fn(_knuth_bendix_redundant_rule)
@@ -23,7 +23,26 @@ from _libsemigroups_pybind11 import (
     NTPMat as _NTPMat,
     PositiveInfinity as _PositiveInfinity,
     ProjMaxPlusMat as _ProjMaxPlusMat,
+    matrix_closure_BMat as _closure_BMat,
+    matrix_closure_MaxPlusMat as _closure_MaxPlusMat,
+    matrix_closure_MaxPlusTruncMat as _closure_MaxPlusTruncMat,
+    matrix_closure_MinPlusMat as _closure_MinPlusMat,
+    matrix_closure_MinPlusTruncMat as _closure_MinPlusTruncMat,
     matrix_period as _period,
+    matrix_pow_batch_BMat as _pow_batch_BMat,
+    matrix_pow_batch_IntMat as _pow_batch_IntMat,
+    matrix_pow_batch_MaxPlusMat as _pow_batch_MaxPlusMat,
+    matrix_pow_batch_MaxPlusTruncMat as _pow_batch_MaxPlusTruncMat,
+    matrix_pow_batch_MinPlusMat as _pow_batch_MinPlusMat,
+    matrix_pow_batch_MinPlusTruncMat as _pow_batch_MinPlusTruncMat,
+    matrix_pow_batch_NTPMat as _pow_batch_NTPMat,
+    matrix_product_batch_BMat as _product_batch_BMat,
+    matrix_product_batch_IntMat as _product_batch_IntMat,
+    matrix_product_batch_MaxPlusMat as _product_batch_MaxPlusMat,
+    matrix_product_batch_MaxPlusTruncMat as _product_batch_MaxPlusTruncMat,
+    matrix_product_batch_MinPlusMat as _product_batch_MinPlusMat,
+    matrix_product_batch_MinPlusTruncMat as _product_batch_MinPlusTruncMat,
+    matrix_product_batch_NTPMat as _product_batch_NTPMat,
     matrix_row_basis as _row_basis,
     matrix_row_space_size as _row_space_size,
     matrix_threshold as _threshold,
@@ -194,3 +213,177 @@ row_space_size = _wrap_cxx_free_fn(_row_space_size)
 period = _wrap_cxx_free_fn(_period)
 row_basis = _wrap_cxx_free_fn(_row_basis)
 threshold = _wrap_cxx_free_fn(_threshold)
+
+
+########################################################################
+# Batched helper functions
+########################################################################
+
+_BATCH_FNS = {
+    "product_batch": {
+        MatrixKind.Boolean: _product_batch_BMat,
+        MatrixKind.Integer: _product_batch_IntMat,
+        MatrixKind.MaxPlus: _product_batch_MaxPlusMat,
+        MatrixKind.MinPlus: _product_batch_MinPlusMat,
+        MatrixKind.MaxPlusTrunc: _product_batch_MaxPlusTruncMat,
+        MatrixKind.MinPlusTrunc: _product_batch_MinPlusTruncMat,
+        MatrixKind.NTP: _product_batch_NTPMat,
+    },
+    "pow_batch": {
+        MatrixKind.Boolean: _pow_batch_BMat,
+        MatrixKind.Integer: _pow_batch_IntMat,
+        MatrixKind.MaxPlus: _pow_batch_MaxPlusMat,
+        MatrixKind.MinPlus: _pow_batch_MinPlusMat,
+        MatrixKind.MaxPlusTrunc: _pow_batch_MaxPlusTruncMat,
+        MatrixKind.MinPlusTrunc: _pow_batch_MinPlusTruncMat,
+        MatrixKind.NTP: _pow_batch_NTPMat,
+    },
+    "closure": {
+        MatrixKind.Boolean: _closure_BMat,
+        MatrixKind.MaxPlus: _closure_MaxPlusMat,
+        MatrixKind.MinPlus: _closure_MinPlusMat,
+        MatrixKind.MaxPlusTrunc: _closure_MaxPlusTruncMat,
+        MatrixKind.MinPlusTrunc: _closure_MinPlusTruncMat,
+    },
+}
+
+
+def _batch_fn(name: str, kind: MatrixKind):
+    if not isinstance(kind, MatrixKind):
+        raise TypeError("the 1st argument must be a MatrixKind")
+    fn = _BATCH_FNS[name].get(kind)
+    if fn is None:
+        raise TypeError(f"{name} is not defined for matrices of kind {kind}")
+    return fn
+
+
+def product_batch(kind: MatrixKind, a, b, *args):
+    """
+    Returns the products of two batches of square matrices.
+
+    The batches *a* and *b* are numpy arrays of shape ``(k, n, n)`` and
+    dtype ``int64``, whose entries are interpreted as the entries of
+    :math:`k` matrices of kind *kind*. The entries :any:`POSITIVE_INFINITY`
+    and :any:`NEGATIVE_INFINITY` are represented by the largest and smallest
+    ``int64`` values, respectively. The products are computed without holding
+    the GIL, and without constructing any :any:`Matrix` objects.
+
+    :param kind: specifies the underlying semiring.
+    :type kind: MatrixKind
+
+    :param a: the left hand factors.
+    :type a: numpy.ndarray
+
+    :param b: the right hand factors.
+    :type b: numpy.ndarray
+
+    :param args:
+      the threshold if *kind* is :any:`MatrixKind.MaxPlusTrunc` or
+      :any:`MatrixKind.MinPlusTrunc`, and the threshold and period if *kind* is
+      :any:`MatrixKind.NTP`.
+
+    :returns:
+      An array of shape ``(k, n, n)`` whose ``i``-th entry is the product of
+      ``a[i]`` and ``b[i]``.
+    :rtype: numpy.ndarray
+
+    :raises TypeError: if *kind* is :any:`MatrixKind.ProjMaxPlus`.
+
+    :raises LibsemigroupsError:
+      if *a* and *b* do not have the same shape ``(k, n, n)``.
+
+    :raises LibsemigroupsError:
+      if any entry of *a* or *b* does not belong to the underlying semiring.
+
+    .. doctest::
+
+      >>> import numpy as np
+      >>> from libsemigroups_pybind11 import MatrixKind, matrix
+      >>> a = np.array([[[0, 1], [0, 0]], [[1, 0], [1, 1]]])
+      >>> matrix.product_batch(MatrixKind.Boolean, a, a).tolist()
+      [[[0, 0], [0, 0]], [[1, 0], [1, 1]]]
+    """
+    return _batch_fn("product_batch", kind)(a, b, *args)
+
+
+def pow_batch(kind: MatrixKind, a, e: int, *args):
+    """
+    Returns the powers of a batch of square matrices.
+
+    The batch *a* is a numpy array of shape ``(k, n, n)`` and dtype ``int64``
+    with the same format as in :any:`product_batch`. The powers are computed
+    without holding the GIL.
+
+    :param kind: specifies the underlying semiring.
+    :type kind: MatrixKind
+
+    :param a: the matrices.
+    :type a: numpy.ndarray
+
+    :param e: the exponent.
+    :type e: int
+
+    :param args:
+      the threshold and period, as in :any:`product_batch`.
+
+    :returns:
+      An array of shape ``(k, n, n)`` whose ``i``-th entry is ``a[i] ** e``.
+    :rtype: numpy.ndarray
+
+    :raises TypeError: if *kind* is :any:`MatrixKind.ProjMaxPlus`.
+
+    :raises LibsemigroupsError: if *a* does not have shape ``(k, n, n)``.
+
+    :raises LibsemigroupsError:
+      if any entry of *a* does not belong to the underlying semiring.
+    """
+    return _batch_fn("pow_batch", kind)(a, e, *args)
+
+
+def closure(kind: MatrixKind, a, *args):
+    r"""
+    Returns the reflexive transitive closures of a batch of square matrices.
+
+    The closure of a matrix :math:`A` is :math:`I + A + A ^ 2 + \cdots`
+    where :math:`I` is the identity matrix; this is, for example, the
+    reflexive transitive closure of a relation for boolean matrices, and the
+    lengths of longest (respectively shortest) paths for max-plus
+    (respectively min-plus) matrices. The batch *a* is a numpy array of shape
+    ``(k, n, n)`` and dtype ``int64`` with the same format as in
+    :any:`product_batch`. The closures are computed by repeated squaring
+    without holding the GIL.
+
+    :param kind:
+      specifies the underlying semiring, which must be one of
+      :any:`MatrixKind.Boolean`, :any:`MatrixKind.MaxPlus`,
+      :any:`MatrixKind.MinPlus`, :any:`MatrixKind.MaxPlusTrunc`, or
+      :any:`MatrixKind.MinPlusTrunc`.
+    :type kind: MatrixKind
+
+    :param a: the matrices.
+    :type a: numpy.ndarray
+
+    :param args:
+      the threshold if *kind* is :any:`MatrixKind.MaxPlusTrunc` or
+      :any:`MatrixKind.MinPlusTrunc`.
+
+    :returns: An array of shape ``(k, n, n)`` containing the closures.
+    :rtype: numpy.ndarray
+
+    :raises TypeError: if *kind* is not one of the kinds listed above.
+
+    :raises LibsemigroupsError: if *a* does not have shape ``(k, n, n)``.
+
+    :raises LibsemigroupsError:
+      if the closure of some matrix in *a* does not exist (for example, a
+      max-plus matrix with a cycle of positive weight).
+
+    .. doctest::
+
+      >>> import numpy as np
+      >>> from libsemigroups_pybind11 import MatrixKind, matrix
+      >>> a = np.array([[[0, 1, 0], [0, 0, 1], [0, 0, 0]]])
+      >>> matrix.closure(MatrixKind.Boolean, a).tolist()
+      [[[1, 1, 1], [0, 1, 1], [0, 0, 1]]]
+    """
+    return _batch_fn("closure", kind)(a, *args)
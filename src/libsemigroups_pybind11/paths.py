@@ -12,6 +12,7 @@ from _libsemigroups_pybind11 import (  # pylint: disable=no-name-in-module,unuse
     paths_algorithm as algorithm,
     paths_number_of_paths as number_of_paths,
     paths_number_of_paths_algorithm as number_of_paths_algorithm,
+    paths_number_of_paths_all as number_of_paths_all,
 )
 
 # The following fools sphinx into thinking that "algorithm" is not an
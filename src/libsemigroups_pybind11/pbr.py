@@ -8,4 +8,9 @@
 contains helper functions for the :any:`PBR` class.
 """
 
-from _libsemigroups_pybind11 import pbr_one as one  # pylint: disable=unused-import
+from _libsemigroups_pybind11 import (  # pylint: disable=unused-import
+    pbr_from_array as from_array,
+    pbr_one as one,
+    pbr_product_batch as product_batch,
+    pbr_to_array as to_array,
+)
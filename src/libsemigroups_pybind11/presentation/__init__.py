@@ -6,6 +6,9 @@
 
 """The full API for :any:`Presentation` helper functions is given below."""
 
+import os as _os
+
+import numpy as _np
 from typing_extensions import Self as _Self
 
 from _libsemigroups_pybind11 import (
@@ -18,14 +21,17 @@ from _libsemigroups_pybind11 import (
     presentation_add_inverse_rules as _add_inverse_rules,
     presentation_add_rule as _add_rule,
     presentation_add_rules as _add_rules,
+    presentation_add_rules_packed as _add_rules_packed,
     presentation_add_zero_rules as _add_zero_rules,
     presentation_are_rules_sorted as _are_rules_sorted,
     presentation_balance as _balance,
     presentation_change_alphabet as _change_alphabet,
     presentation_contains_rule as _contains_rule,
     presentation_first_unused_letter as _first_unused_letter,
+    presentation_from_packed as _from_packed,
     presentation_greedy_reduce_length as _greedy_reduce_length,
     presentation_greedy_reduce_length_and_number_of_gens as _greedy_reduce_length_and_num_of_gens,
+    presentation_greedy_reduce_length_with_timings as _greedy_reduce_length_with_timings,
     presentation_index_rule as _index_rule,
     presentation_is_normalized as _is_normalized,
     presentation_is_rule as _is_rule,
@@ -52,8 +58,10 @@ from _libsemigroups_pybind11 import (
     presentation_strongly_compress as _strongly_compress,
     presentation_throw_if_bad_inverses as _throw_if_bad_inverses,
     presentation_to_gap_string as _to_gap_string,
+    presentation_to_packed as _to_packed,
     presentation_try_detect_inverses as _try_detect_inverses,
 )
+from libsemigroups_pybind11.detail import binary_format as _binary_format
 from libsemigroups_pybind11.detail.cxx_wrapper import (
     CxxWrapper as _CxxWrapper,
     copy_cxx_mem_fns as _copy_cxx_mem_fns,
@@ -231,13 +239,16 @@ add_identity_rules = _wrap_cxx_free_fn(_add_identity_rules)
 add_inverse_rules = _wrap_cxx_free_fn(_add_inverse_rules)
 add_rule = _wrap_cxx_free_fn(_add_rule)
 add_rules = _wrap_cxx_free_fn(_add_rules)
+add_rules_packed = _wrap_cxx_free_fn(_add_rules_packed)
 add_zero_rules = _wrap_cxx_free_fn(_add_zero_rules)
 are_rules_sorted = _wrap_cxx_free_fn(_are_rules_sorted)
 change_alphabet = _wrap_cxx_free_fn(_change_alphabet)
 contains_rule = _wrap_cxx_free_fn(_contains_rule)
 first_unused_letter = _wrap_cxx_free_fn(_first_unused_letter)
+from_packed = _wrap_cxx_free_fn(_from_packed)
 greedy_reduce_length = _wrap_cxx_free_fn(_greedy_reduce_length)
 greedy_reduce_length_and_number_of_gens = _wrap_cxx_free_fn(_greedy_reduce_length_and_num_of_gens)
+greedy_reduce_length_with_timings = _wrap_cxx_free_fn(_greedy_reduce_length_with_timings)
 is_strongly_compressible = _wrap_cxx_free_fn(_is_strongly_compressible)
 length = _wrap_cxx_free_fn(_length)
 longest_rule = _wrap_cxx_free_fn(_longest_rule)
@@ -261,9 +272,72 @@ sort_rules = _wrap_cxx_free_fn(_sort_rules)
 strongly_compress = _wrap_cxx_free_fn(_strongly_compress)
 throw_if_bad_inverses = _wrap_cxx_free_fn(_throw_if_bad_inverses)
 to_gap_string = _wrap_cxx_free_fn(_to_gap_string)
+to_packed = _wrap_cxx_free_fn(_to_packed)
 balance = _wrap_cxx_free_fn(_balance)
 add_cyclic_conjugates = _wrap_cxx_free_fn(_add_cyclic_conjugates)
 index_rule = _wrap_cxx_free_fn(_index_rule)
 is_normalized = _wrap_cxx_free_fn(_is_normalized)
 is_rule = _wrap_cxx_free_fn(_is_rule)
 try_detect_inverses = _wrap_cxx_free_fn(_try_detect_inverses)
+
+
+def save(p: Presentation, path: str | _os.PathLike) -> None:
+    """Save a presentation to a file.
+
+    This function writes the alphabet, rules and value of
+    :any:`Presentation.contains_empty_word` of *p* to the file *path* in the
+    binary format described in :any:`load`, overwriting *path* if it exists.
+
+    :param p: the presentation.
+    :type p: Presentation
+
+    :param path: the path of the file.
+    :type path: str | os.PathLike
+    """
+    letters, offsets = to_packed(p)
+    alphabet = p.alphabet()
+    is_str = isinstance(alphabet, str)
+    if is_str:
+        alphabet = [ord(x) for x in alphabet]
+    _binary_format.save(
+        path,
+        _binary_format.PRESENTATION,
+        [int(is_str), int(p.contains_empty_word()), len(alphabet), len(offsets) - 1, len(letters)],
+        [_np.array(alphabet, dtype=_np.uint32), offsets, letters],
+    )
+
+
+def load(path: str | _os.PathLike) -> Presentation:
+    """Load a presentation from a file.
+
+    This function returns the presentation saved in the file *path* by
+    :any:`save`, with the same type of words as the saved presentation. The
+    file consists of a 64-byte header, containing a version number and the
+    sizes of the arrays that follow, and flat arrays containing the alphabet,
+    and the letters and offsets of the rules, in the format described in
+    :any:`add_rules_packed`. The file is memory-mapped, and the rules are
+    copied directly from the mapped arrays into the returned presentation,
+    without creating any Python objects for the individual rules.
+
+    :param path: the path of a file written by :any:`save`.
+    :type path: str | os.PathLike
+
+    :returns: The presentation.
+    :rtype: Presentation
+
+    :raises ValueError:
+        if *path* does not contain a presentation in the format written by
+        :any:`save`, or was written using a different version of the format.
+    """
+    fields, (alphabet, offsets, letters) = _binary_format.load(
+        path,
+        _binary_format.PRESENTATION,
+        ["<u4", "<u8", "<u4"],
+        lambda f: [f[2], f[3] + 1, f[4]],
+    )
+    alphabet = alphabet.tolist()
+    if fields[0] == 1:
+        alphabet = "".join(chr(x) for x in alphabet)
+    p = from_packed(alphabet, letters, offsets)
+    p.contains_empty_word(bool(fields[1]))
+    return p
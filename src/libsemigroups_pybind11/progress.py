@@ -0,0 +1,197 @@
+# Copyright (c) 2025 J. D. Mitchell
+#
+# Distributed under the terms of the GPL license version 3.
+#
+# The full license is in the file LICENSE, distributed with this software.
+
+"""This module contains :any:`record_progress` for recording the progress of a
+:any:`Runner` as a sequence of :any:`ProgressRecord` objects, rather than as
+the text printed when reporting is enabled by a :any:`ReportGuard`.
+"""
+
+import threading
+import time
+from collections.abc import Callable
+from datetime import timedelta
+from typing import NamedTuple
+
+from _libsemigroups_pybind11 import Runner as _Runner
+
+from .detail.cxx_wrapper import to_cxx as _to_cxx
+from .froidure_pin import FroidurePin as _FroidurePin
+from .knuth_bendix import KnuthBendix as _KnuthBendix
+from .todd_coxeter import ToddCoxeter as _ToddCoxeter
+
+
+class ProgressRecord(NamedTuple):
+    """A single sample of the progress of a :any:`Runner`, as returned by
+    :any:`record_progress`.
+
+    The values in :any:`stats` depend on the type of the runner:
+
+    * for a :any:`ToddCoxeter` the keys are ``"nodes_active"`` and
+      ``"large_collapses"``;
+    * for a :any:`KnuthBendix` the keys are ``"rules_active"``,
+      ``"rules_inactive"`` and ``"rules_total"``;
+    * for a :any:`FroidurePin` the keys are ``"elements"`` and ``"rules"``;
+    * for any other runner, :any:`stats` is empty.
+    """
+
+    time: float
+    """The number of seconds between the start of :any:`record_progress` and
+    the sample being taken."""
+
+    state: str
+    """The name of the :any:`Runner.state` of the runner, such as
+    ``"running_to_finish"`` or ``"not_running"``."""
+
+    stats: dict[str, int]
+    """The statistics sampled from the runner."""
+
+
+def _stats(runner) -> dict[str, int]:
+    # These accessors are not safe to call while runner is running in another
+    # thread, see the warning in the doc of record_progress.
+    if isinstance(runner, _ToddCoxeter):
+        return {
+            "nodes_active": runner.number_of_nodes_active(),
+            "large_collapses": runner.number_of_large_collapses(),
+        }
+    if isinstance(runner, _KnuthBendix):
+        return {
+            "rules_active": runner.number_of_active_rules(),
+            "rules_inactive": runner.number_of_inactive_rules(),
+            "rules_total": runner.total_rules(),
+        }
+    if isinstance(runner, _FroidurePin):
+        return {
+            "elements": runner.current_size(),
+            "rules": runner.current_number_of_rules(),
+        }
+    return {}
+
+
+def record_progress(
+    runner: _Runner,
+    every: timedelta = timedelta(milliseconds=100),
+    callback: Callable[[ProgressRecord], None] | None = None,
+    time_limit: timedelta | None = None,
+) -> list[ProgressRecord]:
+    """Run *runner* and sample its progress at regular intervals.
+
+    This function runs *runner* (using :any:`Runner.run` or, if *time_limit*
+    is not ``None``, :any:`Runner.run_for`) in another thread, and, roughly
+    every *every*, records a :any:`ProgressRecord` containing the elapsed
+    time, the state of *runner*, and some statistics about its progress. A
+    final record is taken when *runner* stops. If *callback* is not ``None``,
+    then it is called with each record as soon as it is taken, for example,
+    to plot the progress of *runner* as it runs.
+
+    The records are typed values, and so can be used to analyse the
+    throughput of *runner* without parsing the output produced when reporting
+    is enabled. Nothing is printed by this function, regardless of whether or
+    not reporting is enabled.
+
+    .. warning::
+
+      The statistics are read in the calling thread while *runner* is being
+      modified by :any:`Runner.run` in another thread, using the same
+      accessors as when *runner* is not running (such as
+      :any:`KnuthBendix.number_of_active_rules` or
+      :any:`FroidurePin.current_size`). None of these accessors is atomic or
+      synchronised with :any:`Runner.run`, and so every sample, other than the
+      last one, is a data race in the sense of the C++ memory model. This is a
+      known limitation of this function: the sampled values can be stale or
+      inconsistent with each other (for example, ``"rules_total"`` can be less
+      than ``"rules_active"`` plus ``"rules_inactive"``), and should only be
+      used to monitor *runner*, not to make decisions. The last record is
+      taken after *runner* has stopped, and so its statistics are exact.
+
+    If the calling thread is interrupted (for example, by pressing
+    ``Ctrl-C``) then *runner* is killed, and the exception is re-raised once it
+    has stopped.
+
+    :param runner: the runner.
+    :type runner: Runner
+
+    :param every:
+      the time between samples (defaults to 100 milliseconds).
+    :type every: datetime.timedelta
+
+    :param callback:
+      a function called with every record (defaults to ``None``).
+    :type callback: collections.abc.Callable[[ProgressRecord], None] | None
+
+    :param time_limit:
+      the maximum amount of time to run *runner* for, or ``None`` for no
+      limit (defaults to ``None``).
+    :type time_limit: datetime.timedelta | None
+
+    :returns: The records in the order that they were taken.
+    :rtype: list[ProgressRecord]
+
+    :raises ValueError: if *every* is not positive.
+
+    :raises LibsemigroupsError: if running *runner* raises.
+
+    .. doctest::
+
+        >>> from libsemigroups_pybind11 import (
+        ...     congruence_kind,
+        ...     Presentation,
+        ...     presentation,
+        ...     record_progress,
+        ...     ToddCoxeter,
+        ... )
+        >>> p = Presentation([0, 1])
+        >>> presentation.add_rule(p, [0, 0, 0], [0])
+        >>> presentation.add_rule(p, [1, 1], [1])
+        >>> presentation.add_rule(p, [0, 1, 0, 1], [0])
+        >>> tc = ToddCoxeter(congruence_kind.twosided, p)
+        >>> records = record_progress(tc)
+        >>> records[-1].stats["nodes_active"] == tc.number_of_classes() + 1
+        True
+    """
+    if every <= timedelta(0):
+        raise ValueError(f"expected the 2nd argument (every) to be positive, found {every}")
+
+    cxx_runner = _to_cxx(runner)
+    errors = []
+
+    def run() -> None:
+        try:
+            if time_limit is None:
+                cxx_runner.run()
+            else:
+                cxx_runner.run_for(time_limit)
+        except Exception as e:  # pylint: disable=broad-exception-caught
+            errors.append(e)
+
+    records = []
+    start = time.perf_counter()
+
+    def sample() -> None:
+        record = ProgressRecord(
+            time.perf_counter() - start, cxx_runner.current_state().name, _stats(runner)
+        )
+        records.append(record)
+        if callback is not None:
+            callback(record)
+
+    thread = threading.Thread(target=run, daemon=True)
+    thread.start()
+    try:
+        while True:
+            thread.join(every.total_seconds())
+            if not thread.is_alive():
+                break
+            sample()
+    except BaseException:
+        cxx_runner.kill()
+        thread.join()
+        raise
+    sample()
+
+    if errors:
+        raise errors[0]
+    return records
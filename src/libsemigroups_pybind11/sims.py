@@ -16,12 +16,18 @@ from _libsemigroups_pybind11 import (
     Sims2 as _Sims2,
     SimsRefinerFaithful as _SimsRefinerFaithful,
     SimsRefinerIdeals as _SimsRefinerIdeals,
+    sims_congruence_lattice as _congruence_lattice,
+    sims_contains_pair_pruner as _contains_pair_pruner,
     sims_is_maximal_right_congruence as _is_maximal_right_congruence,
     sims_is_right_congruence as _is_right_congruence,
     sims_is_right_congruence_of_dual as _is_right_congruence_of_dual,
     sims_is_two_sided_congruence as _is_two_sided_congruence,
+    sims_max_nodes_pruner as _max_nodes_pruner,
+    sims_number_of_components_pruner as _number_of_components_pruner,
     sims_poset as _poset,
+    sims_refiner_pruner as _refiner_pruner,
     sims_right_generating_pairs as _right_generating_pairs,
+    sims_transitive_pruner as _transitive_pruner,
     sims_two_sided_generating_pairs as _two_sided_generating_pairs,
 )
 
@@ -293,3 +299,9 @@ is_right_congruence_of_dual = _wrap_cxx_free_fn(_is_right_congruence_of_dual)
 is_two_sided_congruence = _wrap_cxx_free_fn(_is_two_sided_congruence)
 is_maximal_right_congruence = _wrap_cxx_free_fn(_is_maximal_right_congruence)
 poset = _wrap_cxx_free_fn(_poset)
+congruence_lattice = _wrap_cxx_free_fn(_congruence_lattice)
+contains_pair_pruner = _wrap_cxx_free_fn(_contains_pair_pruner)
+max_nodes_pruner = _wrap_cxx_free_fn(_max_nodes_pruner)
+number_of_components_pruner = _wrap_cxx_free_fn(_number_of_components_pruner)
+refiner_pruner = _wrap_cxx_free_fn(_refiner_pruner)
+transitive_pruner = _wrap_cxx_free_fn(_transitive_pruner)
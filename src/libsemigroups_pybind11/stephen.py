@@ -18,8 +18,10 @@ from _libsemigroups_pybind11 import (
     StephenInversePresentationWord as _StephenInversePresentationWord,
     StephenPresentationWord as _StephenPresentationWord,
     stephen_accepts as _stephen_accepts,
+    stephen_accepts_batch as _stephen_accepts_batch,
     stephen_dot as _stephen_dot,
     stephen_is_left_factor as _stephen_is_left_factor,
+    stephen_is_left_factor_batch as _stephen_is_left_factor_batch,
     stephen_left_factors as _stephen_left_factors,
     stephen_number_of_left_factors as _stephen_number_of_left_factors,
     stephen_number_of_words_accepted as _stephen_number_of_words_accepted,
@@ -97,9 +99,100 @@ _register_cxx_wrapped_type(_StephenInversePresentationWord, Stephen)
 ########################################################################
 
 accepts = _wrap_cxx_free_fn(_stephen_accepts)
+accepts_batch = _wrap_cxx_free_fn(_stephen_accepts_batch)
 dot = _wrap_cxx_free_fn(_stephen_dot)
 is_left_factor = _wrap_cxx_free_fn(_stephen_is_left_factor)
+is_left_factor_batch = _wrap_cxx_free_fn(_stephen_is_left_factor_batch)
 left_factors = _wrap_cxx_free_fn(_stephen_left_factors)
 number_of_left_factors = _wrap_cxx_free_fn(_stephen_number_of_left_factors)
 number_of_words_accepted = _wrap_cxx_free_fn(_stephen_number_of_words_accepted)
 words_accepted = _wrap_cxx_free_fn(_stephen_words_accepted)
+
+
+class PrefixCache:  # pylint: disable=too-few-public-methods
+    """A cache of :any:`Stephen` instances for the prefixes of a word.
+
+    A :any:`PrefixCache` returns a :any:`Stephen` instance, which has been run,
+    for every word *w* that it is called with. The instances for all of the
+    prefixes of the last such word are kept, and the instance for *w* is
+    obtained from the one for the longest prefix of *w* that is kept, by
+    copying it, and appending one letter at a time using
+    :py:meth:`Stephen.__imul__`. So, when the words share long prefixes, as
+    consecutive words in short-lex or lexicographic order do, the word graph of
+    every prefix shared by several words is only computed once.
+
+    The instances returned by a :any:`PrefixCache` belong to the cache, and
+    they must not be modified (by :any:`Stephen.set_word`, for example); use
+    :any:`Stephen.copy` to obtain an instance that can be modified.
+
+    .. doctest::
+
+        >>> from libsemigroups_pybind11 import (Presentation, presentation,
+        ... stephen)
+        >>> p = Presentation([0, 1])
+        >>> presentation.add_rule(p, [0, 0, 0], [0])
+        >>> presentation.add_rule(p, [1, 1, 1], [1])
+        >>> presentation.add_rule(p, [0, 1, 0, 1], [0, 0])
+        >>> cache = stephen.PrefixCache(p)
+        >>> stephen.accepts(cache([0, 1, 0, 1]), [0, 0])
+        True
+        >>> s = cache([0, 1, 0])
+        >>> cache([0, 1, 0, 0]).word()
+        [0, 1, 0, 0]
+        >>> cache([0, 1, 0]) is s
+        True
+    """
+
+    def __init__(self: _Self, p: _Presentation | _InversePresentation) -> None:
+        """Construct from a presentation.
+
+        :param p: the presentation.
+        :type p: Presentation | InversePresentation
+        """
+        self._presentation = p
+        self._word: list[int] = []
+        self._prefixes: list[Stephen] = []
+        self._letters: dict[int, Stephen] = {}
+
+    def __call__(self: _Self, w: list[int]) -> Stephen:
+        """Get a :any:`Stephen` instance for a word.
+
+        This function returns a :any:`Stephen` instance, which has been run,
+        with :any:`Stephen.word` equal to *w*.
+
+        :param w: the word.
+        :type w: list[int]
+
+        :returns: A :any:`Stephen` instance belonging to the cache.
+        :rtype: Stephen
+
+        :raises LibsemigroupsError:
+          if any letter of *w* is not a letter of the presentation used to
+          construct the cache.
+
+        .. warning::
+            Termination of the Stephen algorithm is undecidable in general, and
+            this function may never terminate.
+        """
+        w = list(w)
+        if len(w) == 0:
+            s = Stephen(self._presentation).set_word(w)
+            s.run()
+            return s
+        k = 0
+        while k < min(len(w), len(self._word)) and w[k] == self._word[k]:
+            k += 1
+        del self._word[k:]
+        del self._prefixes[k:]
+        for a in w[k:]:
+            if a not in self._letters:
+                self._letters[a] = Stephen(self._presentation).set_word([a])
+            if self._prefixes:
+                s = self._prefixes[-1].copy()
+                s *= self._letters[a]
+            else:
+                s = self._letters[a].copy()
+            s.run()
+            self._word.append(a)
+            self._prefixes.append(s)
+        return self._prefixes[-1]
@@ -26,7 +26,9 @@ from _libsemigroups_pybind11 import (
     to_knuth_bendix_word_RewriteTrie as _to_knuth_bendix_word_RewriteTrie,
     to_presentation as _to_presentation,
     to_presentation_string as _to_presentation_string,
+    to_presentation_string_consume as _to_presentation_string_consume,
     to_presentation_word as _to_presentation_word,
+    to_presentation_word_consume as _to_presentation_word_consume,
     to_todd_coxeter as _to_todd_coxeter,
     to_todd_coxeter_string as _to_todd_coxeter_string,
     to_todd_coxeter_word as _to_todd_coxeter_word,
@@ -83,11 +85,20 @@ _RETURN_TYPE_TO_CONVERTER_FUNCTION = {
     (_ToddCoxeter, list[int]): _to_todd_coxeter_word,
 }
 
+# The converters used when consume=True, these leave their first argument in
+# the state of a default constructed object.
+_RETURN_TYPE_TO_CONSUMING_CONVERTER_FUNCTION = {
+    (_Presentation, str): _to_presentation_string_consume,
+    (_Presentation, list[int]): _to_presentation_word_consume,
+}
+
 _VALID_TYPES = (_nice_name(x) for x in _RETURN_TYPE_TO_CONVERTER_FUNCTION)
 _VALID_TYPES_STRING = "\n    * " + "\n    * ".join(_VALID_TYPES) + "\n"
+_VALID_CONSUMING_TYPES = (_nice_name(x) for x in _RETURN_TYPE_TO_CONSUMING_CONVERTER_FUNCTION)
+_VALID_CONSUMING_TYPES_STRING = "\n    * " + "\n    * ".join(_VALID_CONSUMING_TYPES) + "\n"
 
 
-def to(*args, rtype: tuple):
+def to(*args, rtype: tuple, consume: bool = False):
     """Convert from one type of `libsemigroups` object to another
 
     This function converts the the arguments specified in *args* to object of
@@ -96,9 +107,25 @@ def to(*args, rtype: tuple):
     :param args: the objects to convert.
     :param rtype: the type of object to convert to.
     :type rtype: tuple
+    :param consume:
+        whether or not the first argument can be consumed by the conversion
+        (defaults to ``False``).
+    :type consume: bool
 
     :returns: an object of type *rtype*.
 
+    :raises TypeError:
+        if *consume* is ``True`` and conversions to *rtype* cannot consume
+        their argument.
+
+    If *consume* is ``True``, then the data of the first argument is moved
+    into the returned object, where possible, rather than copied, and the
+    first argument is left empty afterwards. This avoids holding two copies
+    of a large object in memory at the same time, when the original is no
+    longer required. At present, only conversions from a :any:`Presentation`
+    to a :any:`Presentation` support *consume*; see
+    :ref:`consuming-a-presentation` for details.
+
     .. seealso::
 
         See the following pages for a detailed description of the various use
@@ -139,6 +166,15 @@ def to(*args, rtype: tuple):
 
     """
     cxx_args = [_to_cxx(arg) for arg in args]
+    if consume:
+        if rtype not in _RETURN_TYPE_TO_CONSUMING_CONVERTER_FUNCTION:
+            raise TypeError(
+                "expected the first keyword argument to be one of the following when "
+                f"consume=True:{_VALID_CONSUMING_TYPES_STRING}"
+                f"but found: {_nice_name(rtype)}"
+            )
+        constructor = rtype[0]
+        return constructor(_RETURN_TYPE_TO_CONSUMING_CONVERTER_FUNCTION[rtype](*cxx_args))
     if rtype not in _RETURN_TYPE_TO_CONVERTER_FUNCTION:
         raise TypeError(
             "expected the first keyword argument to be one of:"
@@ -14,7 +14,7 @@ from typing import Any as _Any
 
 from typing_extensions import Self
 
-from _libsemigroups_pybind11 import (
+from _libsemigroups_pybind11 import (  # pylint: disable=unused-import
     Perm1 as _Perm1,
     Perm2 as _Perm2,
     Perm4 as _Perm4,
@@ -27,9 +27,13 @@ from _libsemigroups_pybind11 import (
     Undefined as _Undefined,
     transf_domain as _transf_domain,
     transf_image as _transf_image,
+    transf_image_batch as image_batch,
     transf_inverse as _transf_inverse,
+    transf_inverse_batch as inverse_batch,
     transf_left_one as _transf_left_one,
     transf_one as _transf_one,
+    transf_product_batch as product_batch,
+    transf_rank_batch as rank_batch,
     transf_right_one as _transf_right_one,
 )
 
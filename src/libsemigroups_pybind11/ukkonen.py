@@ -11,6 +11,8 @@ contains helper functions for the :any:`Ukkonen` class.
 from _libsemigroups_pybind11 import (  # pylint: disable=unused-import
     ukkonen_add_word as add_word,
     ukkonen_add_words as add_words,
+    ukkonen_add_words_batch as add_words_batch,
+    ukkonen_compact_arrays as compact_arrays,
     ukkonen_dot as dot,
     ukkonen_is_piece as is_piece,
     ukkonen_is_subword as is_subword,
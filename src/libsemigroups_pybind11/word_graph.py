@@ -10,11 +10,29 @@ manipulating :any:`WordGraph` objects. All such functions
 are contained in the subpackage ``word_graph``.
 """
 
+import os as _os
+from collections.abc import (
+    Iterable as _Iterable,
+    Iterator as _Iterator,
+    MutableMapping as _MutableMapping,
+    MutableSet as _MutableSet,
+)
+from typing import Any as _Any
+
+import numpy as _np
+
 from _libsemigroups_pybind11 import (  # pylint: disable=unused-import
+    WordGraph as _WordGraph,
     word_graph_add_cycle as add_cycle,
     word_graph_adjacency_matrix as adjacency_matrix,
+    word_graph_canonical_form as canonical_form,
+    word_graph_canonical_form_batch as canonical_form_batch,
+    word_graph_canonical_key as _word_graph_canonical_key,
+    word_graph_canonical_keys as _word_graph_canonical_keys,
     word_graph_dot as dot,
     word_graph_equal_to as equal_to,
+    word_graph_fingerprint as fingerprint,
+    word_graph_fingerprint_batch as fingerprint_batch,
     word_graph_follow_path as follow_path,
     word_graph_is_acyclic as is_acyclic,
     word_graph_is_compatible as is_compatible,
@@ -28,5 +46,344 @@ from _libsemigroups_pybind11 import (  # pylint: disable=unused-import
     word_graph_random_acyclic as random_acyclic,
     word_graph_spanning_tree as spanning_tree,
     word_graph_standardize as standardize,
+    word_graph_strongly_connected_components as strongly_connected_components,
     word_graph_topological_sort as topological_sort,
+    word_graph_write as _word_graph_write,
 )
+
+from .detail import binary_format as _binary_format
+
+
+def save(wg: _WordGraph, path: str | _os.PathLike) -> None:
+    """Save a word graph to a file.
+
+    This function writes the targets of *wg* to the file *path* in the binary
+    format described in :any:`load`, overwriting *path* if it exists.
+
+    :param wg: the word graph.
+    :type wg: WordGraph
+
+    :param path: the path of the file.
+    :type path: str | os.PathLike
+    """
+    _binary_format.save(
+        path,
+        _binary_format.WORD_GRAPH,
+        [wg.number_of_nodes(), wg.out_degree()],
+        [_np.asarray(wg).reshape(-1)],
+    )
+
+
+def load_targets(path: str | _os.PathLike) -> _np.ndarray:
+    """Memory-map the targets of a word graph saved in a file.
+
+    This function returns a read-only ``numpy.ndarray`` of shape
+    ``(number_of_nodes, out_degree)`` and dtype ``uint32``, with the same
+    entries as ``numpy.asarray(load(path))``. The array is a view of the file
+    *path* mapped into memory, and so it is returned without reading the file,
+    and the pages of the file that are accessed are shared (via the page cache)
+    by every process that maps the same file.
+
+    :param path: the path of a file written by :any:`save`.
+    :type path: str | os.PathLike
+
+    :returns: The targets of the word graph.
+    :rtype: numpy.ndarray
+
+    :raises ValueError:
+        if *path* does not contain a word graph in the format written by
+        :any:`save`, or was written using a different version of the format.
+    """
+    fields, (targets,) = _binary_format.load(
+        path, _binary_format.WORD_GRAPH, ["<u4"], lambda f: [f[0] * f[1]]
+    )
+    return targets.reshape(fields[0], fields[1])
+
+
+def load(path: str | _os.PathLike) -> _WordGraph:
+    """Load a word graph from a file.
+
+    This function returns the word graph saved in the file *path* by
+    :any:`save`. The file consists of a 64-byte header, containing a version
+    number, the number of nodes and the out-degree, followed by the targets of
+    the word graph as a flat array of ``uint32``. The file is memory-mapped,
+    as in :any:`load_targets`, and the targets are copied into the returned
+    word graph in a single pass, without creating any Python objects.
+
+    :param path: the path of a file written by :any:`save`.
+    :type path: str | os.PathLike
+
+    :returns: The word graph.
+    :rtype: WordGraph
+
+    :raises ValueError: if :any:`load_targets` does.
+    """
+    return _WordGraph(load_targets(path))
+
+
+def write(
+    wg: _WordGraph,
+    file,
+    file_format: str = "dot",
+    nodes=None,
+    components=None,
+) -> None:
+    """Write a word graph to a file in DOT, GraphML, or edge list format.
+
+    This function writes *wg* to *file* without constructing a :any:`Dot`
+    object, and so it can be used for word graphs (such as the
+    :any:`FroidurePin.right_cayley_graph` of a large semigroup, or the
+    :any:`Stephen.word_graph` of a :any:`Stephen` instance) that are too
+    large for :any:`dot`. The output is produced in chunks of about 1 MB,
+    without holding the GIL, and each chunk is written to *file* as soon as
+    it is complete, so the memory used does not depend on the size of *wg*.
+
+    The value of *file_format* determines what is written:
+
+    * ``"dot"``: the same DOT_ source code as ``str(dot(wg))``;
+    * ``"graphml"``: a GraphML document, where the node ``s`` has id ``ns``
+      and every edge has an integer ``label`` attribute;
+    * ``"edges"``: for every edge, its source, label, and target as
+      little-endian ``uint32``, which can be read back with
+      ``numpy.fromfile(path, dtype="<u4").reshape(-1, 3)``.
+
+    If *nodes* or *components* is not ``None``, then only the subgraph of *wg*
+    induced on the given nodes, or on the nodes in the strongly connected
+    components with the given indices (as returned by
+    :any:`strongly_connected_components`), is written. If both are given, the
+    union of the two sets of nodes is used.
+
+    :param wg: the word graph.
+    :type wg: WordGraph
+
+    :param file:
+      the path of the file, which is overwritten if it exists, or a binary
+      file object, such as an ``io.BufferedWriter``.
+    :type file: str | os.PathLike | io.BufferedIOBase
+
+    :param file_format:
+      the format, one of ``"dot"``, ``"graphml"``, or ``"edges"`` (defaults to
+      ``"dot"``).
+    :type file_format: str
+
+    :param nodes: the nodes to write, or ``None`` (defaults to ``None``).
+    :type nodes: list[int] | numpy.ndarray | None
+
+    :param components:
+      the indices of the strongly connected components whose nodes should be
+      written, or ``None`` (defaults to ``None``).
+    :type components: list[int] | numpy.ndarray | None
+
+    :raises LibsemigroupsError:
+      if *file_format* is not one of the values listed above, or *nodes*
+      contains a value greater than or equal to
+      :any:`WordGraph.number_of_nodes`.
+
+    .. doctest::
+
+        >>> import io
+        >>> from libsemigroups_pybind11 import WordGraph, word_graph
+        >>> wg = WordGraph(3, [[0, 1], [1, 0], [2, 2]])
+        >>> f = io.BytesIO()
+        >>> word_graph.write(wg, f)
+        >>> f.getvalue().decode() == str(word_graph.dot(wg))
+        True
+    """
+    if components is not None:
+        scc = strongly_connected_components(wg)
+        in_components = _np.flatnonzero(_np.isin(scc, _np.asarray(components)))
+        if nodes is None:
+            nodes = in_components
+        else:
+            nodes = _np.union1d(_np.asarray(nodes, dtype=_np.uint32), in_components)
+    if nodes is not None:
+        nodes = _np.asarray(nodes, dtype=_np.uint32).reshape(-1)
+    _word_graph_write(wg, file, file_format, nodes)
+
+
+class _CanonicalKey:  # pylint: disable=too-few-public-methods
+    """A canonical form together with its fingerprint, which is used as its
+    hash, so that keys are only compared when their fingerprints are equal.
+    """
+
+    __slots__ = ("canonical", "fingerprint")
+
+    def __init__(self, canonical: _WordGraph, fingerprint_: int) -> None:
+        self.canonical = canonical
+        self.fingerprint = fingerprint_
+
+    def __hash__(self) -> int:
+        return hash(self.fingerprint)
+
+    def __eq__(self, other) -> bool:
+        return self.fingerprint == other.fingerprint and self.canonical == other.canonical
+
+
+def _canonical_keys(graphs: list[_WordGraph], number_of_threads: int) -> list[_CanonicalKey]:
+    return [_CanonicalKey(c, fp) for c, fp in _word_graph_canonical_keys(graphs, number_of_threads)]
+
+
+class CanonicalDict(_MutableMapping):
+    """A dictionary whose keys are word graphs up to isomorphism.
+
+    A :any:`CanonicalDict` is a dictionary where two word graphs are the same
+    key if they have equal :any:`canonical_form`, i.e. if their subgraphs
+    reachable from ``0`` are isomorphic via an isomorphism mapping ``0`` to
+    ``0``. Keys are hashed by their :any:`fingerprint`, and their canonical
+    forms are only compared if their fingerprints are equal, so that merging
+    *k* word graphs into a :any:`CanonicalDict` requires *k* canonical forms
+    and fingerprints (which are computed without holding the GIL by
+    :any:`CanonicalDict.update_batch`), rather than a quadratic number of comparisons.
+
+    The keys returned when iterating over a :any:`CanonicalDict` are the
+    canonical forms of the word graphs used to insert them.
+
+    .. doctest::
+
+        >>> from libsemigroups_pybind11 import WordGraph, word_graph
+        >>> d = word_graph.CanonicalDict()
+        >>> d[WordGraph(3, [[2, 0], [1, 1], [1, 0]])] = "x"
+        >>> d[WordGraph(3, [[1, 0], [2, 0], [2, 2]])]
+        'x'
+        >>> len(d)
+        1
+    """
+
+    def __init__(self, items: _Iterable | None = None) -> None:
+        self._data: dict[_CanonicalKey, tuple[_WordGraph, _Any]] = {}
+        if items is not None:
+            self.update(items)
+
+    @staticmethod
+    def _key(wg: _WordGraph) -> _CanonicalKey:
+        return _CanonicalKey(*_word_graph_canonical_key(wg))
+
+    def __getitem__(self, wg: _WordGraph) -> _Any:
+        return self._data[self._key(wg)][1]
+
+    def __setitem__(self, wg: _WordGraph, value: _Any) -> None:
+        key = self._key(wg)
+        self._data[key] = (key.canonical, value)
+
+    def __delitem__(self, wg: _WordGraph) -> None:
+        del self._data[self._key(wg)]
+
+    def __contains__(self, wg) -> bool:
+        return isinstance(wg, _WordGraph) and self._key(wg) in self._data
+
+    def __iter__(self) -> _Iterator[_WordGraph]:
+        return (canonical for canonical, _ in self._data.values())
+
+    def __len__(self) -> int:
+        return len(self._data)
+
+    def __repr__(self) -> str:
+        return f"<CanonicalDict with {len(self)} word graph(s)>"
+
+    def update_batch(
+        self,
+        graphs: list[_WordGraph],
+        values: list | None = None,
+        number_of_threads: int = 1,
+    ) -> None:
+        """Insert many word graphs.
+
+        This function is equivalent to ``self[graphs[i]] = values[i]`` for
+        every ``i`` in increasing order, but the canonical forms and
+        fingerprints of *graphs* are computed without holding the GIL using
+        *number_of_threads* threads.
+
+        :param graphs: the word graphs.
+        :type graphs: list[WordGraph]
+
+        :param values:
+          the values, or ``None`` to use ``None`` for every value (defaults to
+          ``None``).
+        :type values: list | None
+
+        :param number_of_threads: the number of threads to use (default: ``1``).
+        :type number_of_threads: int
+
+        :raises ValueError: if *values* and *graphs* have different lengths.
+
+        :raises LibsemigroupsError: if *graphs* contains ``None``.
+        """
+        if values is None:
+            values = [None] * len(graphs)
+        elif len(values) != len(graphs):
+            raise ValueError(
+                f"expected the 1st and 2nd arguments to have the same length, found {len(graphs)} "
+                f"and {len(values)}"
+            )
+        for key, value in zip(_canonical_keys(graphs, number_of_threads), values, strict=True):
+            self._data[key] = (key.canonical, value)
+
+
+class CanonicalSet(_MutableSet):
+    """A set of word graphs up to isomorphism.
+
+    A :any:`CanonicalSet` is a set where two word graphs are the same element
+    if they have equal :any:`canonical_form`, in the same way as the keys of a
+    :any:`CanonicalDict`. The elements returned when iterating over a
+    :any:`CanonicalSet` are canonical forms.
+
+    .. doctest::
+
+        >>> from libsemigroups_pybind11 import WordGraph, word_graph
+        >>> s = word_graph.CanonicalSet(
+        ...     [WordGraph(3, [[2, 0], [1, 1], [1, 0]]), WordGraph(3, [[1, 0], [2, 0], [2, 2]])]
+        ... )
+        >>> len(s)
+        1
+    """
+
+    def __init__(self, graphs: _Iterable[_WordGraph] | None = None, number_of_threads: int = 1):
+        self._dict = CanonicalDict()
+        if graphs is not None:
+            self.update_batch(list(graphs), number_of_threads)
+
+    def __contains__(self, wg) -> bool:
+        return wg in self._dict
+
+    def __iter__(self) -> _Iterator[_WordGraph]:
+        return iter(self._dict)
+
+    def __len__(self) -> int:
+        return len(self._dict)
+
+    def __repr__(self) -> str:
+        return f"<CanonicalSet with {len(self)} word graph(s)>"
+
+    def add(self, value: _WordGraph) -> None:
+        """Add a word graph.
+
+        :param value: the word graph.
+        :type value: WordGraph
+        """
+        self._dict[value] = None
+
+    def discard(self, value: _WordGraph) -> None:
+        """Remove a word graph, if it belongs to the set.
+
+        :param value: the word graph.
+        :type value: WordGraph
+        """
+        if value in self._dict:
+            del self._dict[value]
+
+    def update_batch(self, graphs: list[_WordGraph], number_of_threads: int = 1) -> None:
+        """Add many word graphs.
+
+        This function adds every word graph in *graphs*, where the canonical
+        forms and fingerprints of *graphs* are computed as in
+        :any:`CanonicalDict.update_batch`.
+
+        :param graphs: the word graphs.
+        :type graphs: list[WordGraph]
+
+        :param number_of_threads: the number of threads to use (default: ``1``).
+        :type number_of_threads: int
+
+        :raises LibsemigroupsError: if *graphs* contains ``None``.
+        """
+        self._dict.update_batch(graphs, None, number_of_threads)
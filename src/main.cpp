@@ -92,6 +92,7 @@ namespace libsemigroups {
     init_matrix(m);
     init_pbr(m);
     init_transf(m);
+    init_hpcombi(m);  // Must be after init_transf
 
     // Must come before paths
     init_words(m);
@@ -138,7 +139,6 @@ namespace libsemigroups {
     init_to_froidure_pin(m);
     init_to_knuth_bendix(m);
     init_to_present(m);
-    init_to_present(m);
     init_to_todd_coxeter(m);
   }
 }  // namespace libsemigroups
@@ -49,6 +49,7 @@ namespace libsemigroups {
   void init_froidure_pin(py::module&);
   void init_froidure_pin_base(py::module&);
   void init_gabow(py::module&);
+  void init_hpcombi(py::module&);
   void init_imagerightaction(py::module&);
   void init_inverse_present(py::module&);
   void init_kambites(py::module&);
@@ -72,7 +73,6 @@ namespace libsemigroups {
   void init_to_froidure_pin(py::module&);
   void init_to_knuth_bendix(py::module&);
   void init_to_present(py::module&);
-  void init_to_present(py::module&);
   void init_to_todd_coxeter(py::module&);
   void init_todd_coxeter(py::module&);
   void init_transf(py::module&);
@@ -19,8 +19,9 @@
 // C++ stl headers....
 #include <cstddef>        // for size_t
 #include <cstdint>        // for int64_t
+#include <limits>         // for numeric_limits
 #include <memory>         // for allocator, make_unique, unique_ptr
-#include <string>         // for char_traits, operator==, operator+
+#include <string>         // for char_traits, operator+, to_string
 #include <unordered_map>  // for operator==, unordered_map
 #include <utility>        // for make_pair, pair
 #include <vector>         // for vector
@@ -34,6 +35,7 @@
 #include <libsemigroups/detail/string.hpp>  // for string_format, to_string
 
 // pybind11....
+#include <pybind11/numpy.h>      // for array_t
 #include <pybind11/operators.h>  // for self, self_t, operator!=, operator*
 #include <pybind11/pybind11.h>   // for init, class_, module
 #include <pybind11/stl.h>
@@ -956,6 +958,219 @@ the ntp matrix *x* using its underlying semiring.
 :only-document-once:
 )pbdoc");
     }
+
+    ////////////////////////////////////////////////////////////////////////
+    // Batched products, powers, and closures
+    ////////////////////////////////////////////////////////////////////////
+
+    // A batch of k square n x n matrices is passed to and from Python as a
+    // numpy array of shape (k, n, n) with dtype int64. The entries
+    // POSITIVE_INFINITY and NEGATIVE_INFINITY are represented by the
+    // largest and smallest int64 values, respectively.
+    using matrix_batch
+        = py::array_t<int64_t, py::array::c_style | py::array::forcecast>;
+
+    template <typename Mat>
+    typename Mat::scalar_type from_batch_entry(int64_t val) {
+      using scalar_type = typename Mat::scalar_type;
+      if constexpr (!IsBMat<Mat> && !IsIntMat<Mat>) {
+        if (val == std::numeric_limits<int64_t>::max()) {
+          return static_cast<scalar_type>(POSITIVE_INFINITY);
+        } else if (val == std::numeric_limits<int64_t>::min()) {
+          return static_cast<scalar_type>(NEGATIVE_INFINITY);
+        }
+      }
+      return static_cast<scalar_type>(val);
+    }
+
+    template <typename Mat>
+    int64_t to_batch_entry(typename Mat::scalar_type val) {
+      using scalar_type = typename Mat::scalar_type;
+      if constexpr (!IsBMat<Mat> && !IsIntMat<Mat>) {
+        if (val == static_cast<scalar_type>(POSITIVE_INFINITY)) {
+          return std::numeric_limits<int64_t>::max();
+        } else if (val == static_cast<scalar_type>(NEGATIVE_INFINITY)) {
+          return std::numeric_limits<int64_t>::min();
+        }
+      }
+      return static_cast<int64_t>(val);
+    }
+
+    // Returns the dimension n of the matrices in the (k, n, n) array a.
+    inline size_t batch_dimension(matrix_batch const& a, char const* name) {
+      if (a.ndim() != 3 || a.shape(1) != a.shape(2)) {
+        std::string shape;
+        for (py::ssize_t i = 0; i < a.ndim(); ++i) {
+          shape += (i == 0 ? "" : ", ") + std::to_string(a.shape(i));
+        }
+        if (a.ndim() == 1) {
+          shape += ",";
+        }
+        LIBSEMIGROUPS_EXCEPTION("expected the argument \"{}\" to have shape "
+                                "(k, n, n), found an array with shape ({})",
+                                name,
+                                shape);
+      }
+      return a.shape(1);
+    }
+
+    inline matrix_batch make_batch(size_t k, size_t n) {
+      auto const kk = static_cast<py::ssize_t>(k);
+      auto const nn = static_cast<py::ssize_t>(n);
+      return matrix_batch(std::vector<py::ssize_t>({kk, nn, nn}));
+    }
+
+    // Must be called without the GIL, reads the i-th matrix in the batch
+    // "in" into x, which must already have the correct dimensions.
+    template <typename Mat>
+    void load_batch_matrix(Mat& x, int64_t const* in, size_t i) {
+      size_t const n = x.number_of_rows();
+      in += i * n * n;
+      for (size_t r = 0; r < n; ++r) {
+        for (size_t c = 0; c < n; ++c) {
+          auto val = from_batch_entry<Mat>(in[r * n + c]);
+          matrix::throw_if_bad_entry(x, val);
+          x(r, c) = val;
+        }
+      }
+    }
+
+    template <typename Mat>
+    void store_batch_matrix(Mat const& x, int64_t* out, size_t i) {
+      size_t const n = x.number_of_rows();
+      out += i * n * n;
+      for (size_t r = 0; r < n; ++r) {
+        for (size_t c = 0; c < n; ++c) {
+          out[r * n + c] = to_batch_entry<Mat>(x(r, c));
+        }
+      }
+    }
+
+    template <typename Mat>
+    Mat make_batch_matrix(size_t n) {
+      return Mat(n, n);
+    }
+
+    template <typename Mat>
+    Mat make_batch_matrix(size_t n, size_t threshold) {
+      return Mat(semiring<typename Mat::semiring_type>(threshold), n, n);
+    }
+
+    template <typename Mat>
+    Mat make_batch_matrix(size_t n, size_t threshold, size_t period) {
+      return Mat(
+          semiring<typename Mat::semiring_type>(threshold, period), n, n);
+    }
+
+    // Replaces x by its reflexive transitive closure I + x + x ^ 2 + ...,
+    // which is only defined when addition in the semiring is idempotent.
+    // The closure is the limit of the sequence (I + x) ^ (2 ^ i), which is
+    // reached after at most log2(n) + 1 squarings if it exists and the
+    // semiring is not truncated. Over a truncated semiring the sequence is
+    // increasing in a finite set, and so always stabilises.
+    template <typename Mat>
+    void closure_inplace(Mat& x, Mat& tmp) {
+      constexpr bool truncated
+          = IsMaxPlusTruncMat<Mat> || IsMinPlusTruncMat<Mat>;
+
+      x += x.one();
+      size_t limit = 1;
+      for (size_t n = x.number_of_rows(); n > 1; n = (n + 1) / 2) {
+        limit++;
+      }
+      for (size_t i = 0; truncated || i < limit; ++i) {
+        tmp.product_inplace_no_checks(x, x);
+        if (tmp == x) {
+          return;
+        }
+        std::swap(x, tmp);
+      }
+      LIBSEMIGROUPS_EXCEPTION(
+          "the closure of a matrix in the batch does not exist, the sequence "
+          "of its powers does not stabilise");
+    }
+
+    template <typename Mat, typename... SemiringParams>
+    void def_matrix_batch(py::module& m, std::string const& py_type) {
+      m.def(
+          fmt::format("matrix_product_batch_{}", py_type).c_str(),
+          [](matrix_batch const& a,
+             matrix_batch const& b,
+             SemiringParams... params) {
+            size_t const n = batch_dimension(a, "a");
+            if (b.ndim() != 3 || a.shape(0) != b.shape(0)
+                || a.shape(1) != b.shape(1) || a.shape(2) != b.shape(2)) {
+              LIBSEMIGROUPS_EXCEPTION(
+                  "expected the arguments \"a\" and \"b\" to have the same "
+                  "shape, found arrays of sizes {} and {}",
+                  a.size(),
+                  b.size());
+            }
+            size_t const   k      = a.shape(0);
+            matrix_batch   result = make_batch(k, n);
+            int64_t const* in1    = a.data();
+            int64_t const* in2    = b.data();
+            int64_t*       out    = result.mutable_data();
+            {
+              py::gil_scoped_release release;
+              Mat x  = make_batch_matrix<Mat>(n, params...);
+              Mat y  = make_batch_matrix<Mat>(n, params...);
+              Mat xy = make_batch_matrix<Mat>(n, params...);
+              for (size_t i = 0; i < k; ++i) {
+                load_batch_matrix(x, in1, i);
+                load_batch_matrix(y, in2, i);
+                xy.product_inplace_no_checks(x, y);
+                store_batch_matrix(xy, out, i);
+              }
+            }
+            return result;
+          });
+
+      m.def(
+          fmt::format("matrix_pow_batch_{}", py_type).c_str(),
+          [](matrix_batch const& a, size_t e, SemiringParams... params) {
+            size_t const   n      = batch_dimension(a, "a");
+            size_t const   k      = a.shape(0);
+            matrix_batch   result = make_batch(k, n);
+            int64_t const* in     = a.data();
+            int64_t*       out    = result.mutable_data();
+            {
+              py::gil_scoped_release release;
+              Mat x = make_batch_matrix<Mat>(n, params...);
+              for (size_t i = 0; i < k; ++i) {
+                load_batch_matrix(x, in, i);
+                store_batch_matrix(
+                    matrix::pow(x, static_cast<typename Mat::scalar_type>(e)),
+                    out,
+                    i);
+              }
+            }
+            return result;
+          });
+
+      if constexpr (IsBMat<Mat> || IsMaxPlusMat<Mat> || IsMinPlusMat<Mat>
+                    || IsMaxPlusTruncMat<Mat> || IsMinPlusTruncMat<Mat>) {
+        m.def(fmt::format("matrix_closure_{}", py_type).c_str(),
+              [](matrix_batch const& a, SemiringParams... params) {
+                size_t const   n      = batch_dimension(a, "a");
+                size_t const   k      = a.shape(0);
+                matrix_batch   result = make_batch(k, n);
+                int64_t const* in     = a.data();
+                int64_t*       out    = result.mutable_data();
+                {
+                  py::gil_scoped_release release;
+                  Mat x   = make_batch_matrix<Mat>(n, params...);
+                  Mat tmp = make_batch_matrix<Mat>(n, params...);
+                  for (size_t i = 0; i < k; ++i) {
+                    load_batch_matrix(x, in, i);
+                    closure_inplace(x, tmp);
+                    store_batch_matrix(x, out, i);
+                  }
+                }
+                return result;
+              });
+      }
+    }
   }  // namespace
 
   void init_matrix(py::module& m) {
@@ -968,6 +1183,17 @@ the ntp matrix *x* using its underlying semiring.
     bind_matrix_trunc_semiring<MinPlusTruncMat<0, 0, 0, int64_t>>(m);
     bind_ntp_matrix<NTPMat<0, 0, 0, 0, int64_t>>(m);
 
+    def_matrix_batch<BMat<>>(m, "BMat");
+    def_matrix_batch<IntMat<0, 0, int64_t>>(m, "IntMat");
+    def_matrix_batch<MaxPlusMat<0, 0, int64_t>>(m, "MaxPlusMat");
+    def_matrix_batch<MinPlusMat<0, 0, int64_t>>(m, "MinPlusMat");
+    def_matrix_batch<MaxPlusTruncMat<0, 0, 0, int64_t>, size_t>(
+        m, "MaxPlusTruncMat");
+    def_matrix_batch<MinPlusTruncMat<0, 0, 0, int64_t>, size_t>(
+        m, "MinPlusTruncMat");
+    def_matrix_batch<NTPMat<0, 0, 0, 0, int64_t>, size_t, size_t>(m,
+                                                                   "NTPMat");
+
     m.def(
         "matrix_row_space_size",
         [](BMat<> const& x) { return matrix::row_space_size(x); },
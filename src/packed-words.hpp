@@ -0,0 +1,151 @@
+//
+// libsemigroups_pybind11 - python bindings for the C++ library libsemigroups
+// Copyright (C) 2024 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRC_PACKED_WORDS_HPP_
+#define SRC_PACKED_WORDS_HPP_
+
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint32_t, uint64_t
+#include <string>       // for string
+#include <type_traits>  // for is_same_v
+#include <vector>       // for vector
+
+#include <pybind11/numpy.h>     // for array_t
+#include <pybind11/pybind11.h>  // for tuple, make_tuple
+
+#include <libsemigroups/exception.hpp>  // for LIBSEMIGROUPS_EXCEPTION
+
+namespace libsemigroups {
+  namespace py = pybind11;
+
+  // Words can be passed to and from Python in bulk as a pair of flat numpy
+  // arrays (letters, offsets), where the i-th word is
+  // letters[offsets[i]:offsets[i + 1]]. There is one more offset than there
+  // are words, the first offset is 0, and the last offset is len(letters).
+  // The letters of a str are the code points of its characters.
+  using packed_letters
+      = py::array_t<uint32_t, py::array::c_style | py::array::forcecast>;
+  using packed_offsets
+      = py::array_t<uint64_t, py::array::c_style | py::array::forcecast>;
+
+  namespace detail {
+    inline uint32_t to_packed_letter(char c) {
+      return static_cast<unsigned char>(c);
+    }
+
+    template <typename Letter>
+    uint32_t to_packed_letter(Letter x) {
+      return static_cast<uint32_t>(x);
+    }
+  }  // namespace detail
+
+  // Must be called while holding the GIL, throws if (letters, offsets) does
+  // not have the format described above, and returns the number of words.
+  inline size_t throw_if_bad_packed_words(packed_letters const& letters,
+                                          packed_offsets const& offsets) {
+    if (letters.ndim() != 1 || offsets.ndim() != 1) {
+      LIBSEMIGROUPS_EXCEPTION("expected 1-dimensional arrays of letters and "
+                              "offsets, found {}- and {}-dimensional arrays",
+                              letters.ndim(),
+                              offsets.ndim());
+    }
+    if (offsets.size() == 0) {
+      LIBSEMIGROUPS_EXCEPTION(
+          "expected the array of offsets to be non-empty, found size 0");
+    }
+    auto         o = offsets.unchecked<1>();
+    size_t const n = offsets.size() - 1;
+
+    if (o(0) != 0 || o(n) != static_cast<uint64_t>(letters.size())) {
+      LIBSEMIGROUPS_EXCEPTION(
+          "expected the first and last offsets to be 0 and {} (the number of "
+          "letters), found {} and {}",
+          letters.size(),
+          o(0),
+          o(n));
+    }
+    for (size_t i = 0; i < n; ++i) {
+      if (o(i + 1) < o(i)) {
+        LIBSEMIGROUPS_EXCEPTION("expected the offsets to be non-decreasing, "
+                                "found offsets[{}] = {} > offsets[{}] = {}",
+                                i,
+                                o(i),
+                                i + 1,
+                                o(i + 1));
+      }
+    }
+    return n;
+  }
+
+  // Must be called while holding the GIL. Every offset is validated before
+  // any letter is read.
+  template <typename Word>
+  std::vector<Word> unpack_words(packed_letters const& letters,
+                                 packed_offsets const& offsets) {
+    using letter_type = typename Word::value_type;
+
+    size_t const n = throw_if_bad_packed_words(letters, offsets);
+    auto         l = letters.unchecked<1>();
+    auto         o = offsets.unchecked<1>();
+
+    if constexpr (std::is_same_v<letter_type, char>) {
+      for (py::ssize_t j = 0; j < letters.size(); ++j) {
+        if (l(j) > 255) {
+          LIBSEMIGROUPS_EXCEPTION("expected the letters of a str to be in the "
+                                  "range [0, 256), found {} in position {}",
+                                  l(j),
+                                  j);
+        }
+      }
+    }
+
+    std::vector<Word> result(n);
+    for (size_t i = 0; i < n; ++i) {
+      result[i].reserve(o(i + 1) - o(i));
+      for (uint64_t j = o(i); j < o(i + 1); ++j) {
+        result[i].push_back(static_cast<letter_type>(l(j)));
+      }
+    }
+    return result;
+  }
+
+  // Must be called while holding the GIL, returns the tuple (letters, offsets).
+  template <typename Word>
+  py::tuple pack_words(std::vector<Word> const& words) {
+    size_t num_letters = 0;
+    for (auto const& w : words) {
+      num_letters += w.size();
+    }
+    py::array_t<uint32_t> letters(num_letters);
+    py::array_t<uint64_t> offsets(words.size() + 1);
+
+    auto   l = letters.mutable_unchecked<1>();
+    auto   o = offsets.mutable_unchecked<1>();
+    size_t k = 0;
+    o(0)     = 0;
+    for (size_t i = 0; i < words.size(); ++i) {
+      for (auto x : words[i]) {
+        l(k++) = detail::to_packed_letter(x);
+      }
+      o(i + 1) = k;
+    }
+    return py::make_tuple(letters, offsets);
+  }
+}  // namespace libsemigroups
+
+#endif  // SRC_PACKED_WORDS_HPP_
@@ -17,28 +17,199 @@
 //
 
 // C++ stl headers....
-#include <cstddef>  // for uint32_t
-#include <cstdint>  // for uint64_t
+#include <algorithm>    // for copy
+#include <atomic>       // for atomic
+#include <cstddef>      // for uint32_t
+#include <cstdint>      // for uint64_t
+#include <type_traits>  // for is_same_v
+#include <utility>      // for swap
+#include <vector>       // for vector
 
 // libsemigroups....
 #include <libsemigroups/constants.hpp>   // for operator!=, operator==
 #include <libsemigroups/order.hpp>       // for order
 #include <libsemigroups/paths.hpp>       // for Paths
+#include <libsemigroups/types.hpp>       // for word_type
 #include <libsemigroups/word-graph.hpp>  // for WordGraph, word_graph
 
 // pybind11....
+#include <pybind11/numpy.h>      // for array_t
 #include <pybind11/operators.h>  // for self, self_t, operator!=, operator*
 #include <pybind11/pybind11.h>   // for class_, make_iterator, init, enum_
 #include <pybind11/stl.h>        // for conversion of C++ to py types
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_paths
+#include "main.hpp"          // for init_paths
+#include "packed-words.hpp"  // for pack_words
+#include "threads.hpp"       // for run_in_threads
 
 namespace libsemigroups {
   namespace py    = pybind11;
   using node_type = uint32_t;
   using size_type = typename WordGraph<node_type>::size_type;
 
+  namespace {
+    // Adds y to x, and returns false if this overflows.
+    bool add_to(uint64_t& x, uint64_t y) {
+      x += y;
+      return x >= y;
+    }
+
+    bool is_zero(uint64_t x) {
+      return x == 0;
+    }
+
+    // Python integers don't overflow, but require the GIL.
+    bool add_to(py::object& x, py::object const& y) {
+      x = x + y;
+      return true;
+    }
+
+    bool is_zero(py::object const& x) {
+      return x.equal(py::int_(0));
+    }
+
+    template <typename Int>
+    Int make_int(uint64_t x) {
+      if constexpr (std::is_same_v<Int, py::object>) {
+        return py::int_(x);
+      } else {
+        return x;
+      }
+    }
+
+    // Counts the paths with every source node in wg, and length in the range
+    // [min, max), using one dynamic programming sweep for all sources. If
+    // max is POSITIVE_INFINITY, then the nodes from which there are
+    // infinitely many paths are those from which a cycle can be reached, and
+    // infinite[v] is set to true for these nodes. Returns false if the
+    // number of paths can't be represented by an Int, and result is only
+    // meaningful if true is returned. If Int is py::object, then this must be
+    // called with the GIL held and number_of_threads = 1.
+    template <typename Int>
+    bool number_of_paths_all(WordGraph<node_type> const& wg,
+                             size_t                      min,
+                             size_t                      max,
+                             size_t                      number_of_threads,
+                             std::vector<Int>&           result,
+                             std::vector<bool>&          infinite) {
+      size_t const n = wg.number_of_nodes();
+      size_t const m = wg.out_degree();
+      Int const    one  = make_int<Int>(1);
+      Int const    zero = make_int<Int>(0);
+
+      infinite.assign(n, false);
+      std::vector<Int> prev, next(n, zero);
+
+      if (max == static_cast<size_t>(POSITIVE_INFINITY)) {
+        // Process the nodes in reverse topological order (Kahn's algorithm on
+        // the reversed word graph), so that total[v] = 1 + sum of total[u]
+        // over the targets u of v. Nodes never processed can reach a cycle.
+        std::vector<size_t> num_out(n, 0), in_offsets(n + 1, 0);
+        for (node_type v = 0; v < n; ++v) {
+          for (size_t a = 0; a < m; ++a) {
+            node_type u = wg.target_no_checks(v, a);
+            if (u != UNDEFINED) {
+              num_out[v]++;
+              in_offsets[u + 1]++;
+            }
+          }
+        }
+        for (size_t v = 0; v < n; ++v) {
+          in_offsets[v + 1] += in_offsets[v];
+        }
+        std::vector<node_type> in_nodes(in_offsets[n]);
+        std::vector<size_t>    pos(in_offsets.begin(), in_offsets.end() - 1);
+        for (node_type v = 0; v < n; ++v) {
+          for (size_t a = 0; a < m; ++a) {
+            node_type u = wg.target_no_checks(v, a);
+            if (u != UNDEFINED) {
+              in_nodes[pos[u]++] = v;
+            }
+          }
+        }
+        std::vector<node_type> queue;
+        for (node_type v = 0; v < n; ++v) {
+          if (num_out[v] == 0) {
+            queue.push_back(v);
+          }
+        }
+        prev.assign(n, zero);
+        for (size_t i = 0; i < queue.size(); ++i) {
+          node_type v = queue[i];
+          prev[v]     = one;
+          for (size_t a = 0; a < m; ++a) {
+            node_type u = wg.target_no_checks(v, a);
+            if (u != UNDEFINED && !add_to(prev[v], prev[u])) {
+              return false;
+            }
+          }
+          for (size_t j = in_offsets[v]; j < in_offsets[v + 1]; ++j) {
+            if (--num_out[in_nodes[j]] == 0) {
+              queue.push_back(in_nodes[j]);
+            }
+          }
+        }
+        for (node_type v = 0; v < n; ++v) {
+          infinite[v] = num_out[v] != 0;
+        }
+        // The number of paths of length at least min with source v is the
+        // sum of total[u] over the paths of length min from v to u.
+        max = min + 1;
+      } else {
+        prev.assign(n, one);
+      }
+      result.assign(n, zero);
+      if (min == 0 && max != 0) {
+        result = prev;
+      }
+
+      // prev[v] is the number of paths of length l from v (or, if max was
+      // POSITIVE_INFINITY, the sum of total[u] over such paths).
+      for (size_t l = 1; l < max; ++l) {
+        std::atomic<bool> overflow(false);
+        std::atomic<bool> nonzero(false);
+        run_in_threads(n, number_of_threads, [&](size_t first, size_t last) {
+          bool local_nonzero = false;
+          for (size_t v = first; v < last; ++v) {
+            next[v] = zero;
+            if (infinite[v]) {
+              continue;
+            }
+            for (size_t a = 0; a < m; ++a) {
+              node_type u = wg.target_no_checks(v, a);
+              if (u != UNDEFINED && !add_to(next[v], prev[u])) {
+                overflow = true;
+                return;
+              }
+            }
+            local_nonzero |= !is_zero(next[v]);
+          }
+          if (local_nonzero) {
+            nonzero = true;
+          }
+        });
+        if (overflow) {
+          return false;
+        }
+        std::swap(prev, next);
+        if (l >= min) {
+          for (size_t v = 0; v < n; ++v) {
+            if (!add_to(result[v], prev[v])) {
+              return false;
+            }
+          }
+        }
+        if (!nonzero) {
+          // There are no paths of length l, and so none of any greater
+          // length either.
+          break;
+        }
+      }
+      return true;
+    }
+  }  // namespace
+
   void init_paths(py::module& m) {
     ////////////////////////////////////////////////////////////////////////
     // Paths
@@ -94,6 +265,55 @@ Copy a :any:`Paths` object.
       return py::make_iterator(rx::begin(p), rx::end(p));
     });
 
+    thing1.def(
+        "take",
+        [](Paths_& p, size_t n) {
+          p.throw_if_source_undefined();
+          std::vector<word_type> words;
+          {
+            py::gil_scoped_release release;
+            for (size_t i = 0; i < n && !p.at_end(); ++i) {
+              words.push_back(p.get());
+              p.next();
+            }
+          }
+          return pack_words(words);
+        },
+        py::arg("n"),
+        R"pbdoc(
+:sig=(self: Paths, n: int) -> tuple[numpy.ndarray, numpy.ndarray]:
+
+Get the next paths in the range as packed arrays.
+
+This function returns the next (at most) *n* paths in the range, and advances
+*self* past them, so that repeated calls to this function return consecutive
+chunks of the range. The paths are returned as a pair of arrays
+``(letters, offsets)``, so that the ``i``-th path is
+``letters[offsets[i]:offsets[i + 1]]``. The paths are computed without holding
+the GIL, and this is much faster than iterating through *self* one path at a
+time.
+
+:param n: the maximum number of paths to return.
+:type n: int
+
+:returns:
+  A tuple containing an array of ``numpy.uint32`` letters, and an array of
+  ``numpy.uint64`` offsets, with one more offset than there are paths.
+:rtype: tuple[numpy.ndarray, numpy.ndarray]
+
+:raises LibsemigroupsError: if ``source() == UNDEFINED``.
+
+.. doctest::
+
+   >>> from libsemigroups_pybind11 import Paths, WordGraph
+   >>> p = Paths(WordGraph(2, [[1, 0], [0]])).source(0).max(3)
+   >>> letters, offsets = p.take(4)
+   >>> [letters[offsets[i]:offsets[i + 1]].tolist() for i in range(4)]
+   [[], [0], [1], [0, 0]]
+   >>> p.get()
+   [1, 0]
+)pbdoc");
+
     thing1.def(
         "init",
         [](Paths_& self, WordGraph<node_type> const& wg) -> Paths_& {
@@ -564,6 +784,104 @@ ending at the given target node with length in the range ``[min, max)``.
   is the out-degree of the word graph.
 )pbdoc");
 
+    m.def(
+        "paths_number_of_paths_all",
+        [](WordGraph<node_type> const& wg,
+           size_t                      min,
+           int_or_constant<size_t>     max,
+           size_t                      number_of_threads) -> py::object {
+          size_t const      mx = to_int<size_t>(max);
+          size_t const      n  = wg.number_of_nodes();
+          std::vector<bool> infinite;
+          std::vector<uint64_t> counts;
+          bool                  fits;
+          {
+            py::gil_scoped_release release;
+            fits = number_of_paths_all(
+                wg, min, mx, number_of_threads, counts, infinite);
+          }
+          bool any_infinite = false;
+          for (size_t v = 0; v < n; ++v) {
+            any_infinite |= infinite[v];
+          }
+          if (fits && !any_infinite) {
+            py::array_t<uint64_t> result(n);
+            std::copy(counts.begin(), counts.end(), result.mutable_data());
+            return std::move(result);
+          }
+          std::vector<py::object> big;
+          if (!fits) {
+            number_of_paths_all(wg, min, mx, 1, big, infinite);
+          }
+          py::list result(n);
+          for (size_t v = 0; v < n; ++v) {
+            if (infinite[v]) {
+              result[v] = py::cast(POSITIVE_INFINITY);
+            } else if (fits) {
+              result[v] = py::int_(counts[v]);
+            } else {
+              result[v] = big[v];
+            }
+          }
+          return py::module_::import("numpy").attr("array")(
+              result, py::arg("dtype") = "object");
+        },
+        py::arg("wg"),
+        py::arg("min")               = 0,
+        py::arg("max")               = POSITIVE_INFINITY,
+        py::arg("number_of_threads") = 1,
+        R"pbdoc(
+:sig=(wg: WordGraph, min: int = 0, max: int | PositiveInfinity = POSITIVE_INFINITY, number_of_threads: int = 1) -> numpy.ndarray:
+
+Returns the number of paths with every source node and length in a given
+range.
+
+This function returns an array whose ``v``-th entry is the number of paths in
+the word graph *wg* with source ``v`` and length in the range
+``[min, max)``, i.e. the value of ``number_of_paths(wg, v, min, max)`` for
+every node ``v``. The counts for all source nodes are computed at once by a
+single dynamic programming sweep over *wg*, which is run without holding the
+GIL, and in parallel using *number_of_threads* threads, and so this is much
+faster than calling :any:`number_of_paths` for every node.
+
+If every count is finite and less than ``2 ** 64``, then the returned array has
+``dtype`` ``numpy.uint64``. Otherwise, the ``dtype`` of the returned array is
+``object``, and its entries are ``int`` or :any:`POSITIVE_INFINITY`. Unlike
+:any:`number_of_paths`, the counts are always correct, even if they exceed
+``2 ** 64``.
+
+:param wg: the word graph.
+:type wg: WordGraph
+
+:param min: the minimum length of paths to count (default: ``0``).
+:type min: int
+
+:param max:
+  one more than the maximum length of paths to count (default:
+  :any:`POSITIVE_INFINITY`).
+:type max: int | PositiveInfinity
+
+:param number_of_threads: the number of threads to use (default: ``1``).
+:type number_of_threads: int
+
+:returns: The numbers of paths.
+:rtype: numpy.ndarray
+
+:complexity:
+  At worst :math:`O(nmk)` where :math:`n` is the number of nodes, :math:`m` is
+  the out-degree of the word graph, and :math:`k` is *max* (or *min* if
+  *max* is :any:`POSITIVE_INFINITY`).
+
+.. doctest::
+
+   >>> from libsemigroups_pybind11 import WordGraph, paths, POSITIVE_INFINITY
+   >>> wg = WordGraph(4, [[0, 1], [1, 0], [2]])
+   >>> paths.number_of_paths_all(wg, 0, 10)
+   array([1023, 1023,   10,    1], dtype=uint64)
+   >>> paths.number_of_paths_all(wg)
+   array([+∞, +∞, +∞, 1], dtype=object)
+)pbdoc");
+
     m.def(
         "paths_number_of_paths",
         [](WordGraph<node_type> const& wg, node_type source) {
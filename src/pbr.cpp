@@ -16,11 +16,18 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
+// C++ stl headers....
+#include <algorithm>  // for fill
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint32_t
+#include <vector>     // for vector
+
 // libsemigroups headers
 #include <libsemigroups/exception.hpp>
 #include <libsemigroups/pbr.hpp>
 
 // pybind11....
+#include <pybind11/numpy.h>  // for array_t
 #include <pybind11/operators.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -31,6 +38,48 @@
 namespace libsemigroups {
 
   namespace py = pybind11;
+
+  namespace {
+    // A collection of k PBRs of degree n is stored as a boolean numpy array
+    // of shape (k, 2n, 2n), whose i-th entry is the adjacency matrix of the
+    // i-th PBR.
+    using pbr_array
+        = py::array_t<bool, py::array::c_style | py::array::forcecast>;
+
+    size_t pbr_array_degree(pbr_array const& a) {
+      if (a.ndim() != 3 || a.shape(1) != a.shape(2) || a.shape(1) % 2 != 0) {
+        LIBSEMIGROUPS_EXCEPTION("expected an array of shape (k, 2n, 2n), "
+                                "found an array with {} dimensions and size {}",
+                                a.ndim(),
+                                a.size());
+      }
+      return a.shape(1) / 2;
+    }
+
+    // Replaces the adjacencies of x, which must have degree n, by those in
+    // the adjacency matrix in. The adjacency lists of x are cleared rather
+    // than replaced, so that their memory is reused.
+    void load_pbr(PBR& x, bool const* in, size_t n) {
+      for (size_t u = 0; u < 2 * n; ++u, in += 2 * n) {
+        x[u].clear();
+        for (size_t v = 0; v < 2 * n; ++v) {
+          if (in[v]) {
+            x[u].push_back(v);
+          }
+        }
+      }
+    }
+
+    void store_pbr(PBR const& x, bool* out, size_t n) {
+      std::fill(out, out + 4 * n * n, false);
+      for (size_t u = 0; u < 2 * n; ++u, out += 2 * n) {
+        for (auto v : x[u]) {
+          out[v] = true;
+        }
+      }
+    }
+  }  // namespace
+
   void init_pbr(py::module& m) {
     py::class_<PBR> thing(m,
                           "PBR",
@@ -281,6 +330,145 @@ value is adjacent to its negative. Equivalently, ``i`` is adjacent
 
 :returns: The identity.
 :rtype: PBR
+)pbdoc");
+
+    ////////////////////////////////////////////////////////////////////////
+    // Arrays of PBRs
+    ////////////////////////////////////////////////////////////////////////
+
+    m.def(
+        "pbr_to_array",
+        [](std::vector<PBR> const& xs) {
+          size_t const n = xs.empty() ? 0 : xs[0].degree();
+          auto const   nn = static_cast<py::ssize_t>(2 * n);
+          pbr_array    result(std::vector<py::ssize_t>(
+              {static_cast<py::ssize_t>(xs.size()), nn, nn}));
+          bool* out = result.mutable_data();
+          for (size_t i = 0; i < xs.size(); ++i, out += 4 * n * n) {
+            if (xs[i].degree() != n) {
+              LIBSEMIGROUPS_EXCEPTION("expected every PBR to have degree {}, "
+                                      "found degree {} in position {}",
+                                      n,
+                                      xs[i].degree(),
+                                      i);
+            }
+            store_pbr(xs[i], out, n);
+          }
+          return result;
+        },
+        py::arg("xs"),
+        R"pbdoc(
+:sig=(xs: list[PBR]) -> numpy.ndarray:
+
+Returns a flat array containing the adjacency matrices of some PBRs.
+
+This function returns a boolean numpy array of shape ``(k, 2n, 2n)`` whose
+``(i, u, v)``-th entry is ``True`` if and only if ``u`` is adjacent to ``v``
+in ``xs[i]``, where ``k`` is ``len(xs)`` and ``n`` is the degree of the PBRs
+in *xs*. Such arrays store the PBRs contiguously, and can be used with
+:any:`product_batch`.
+
+:param xs: the PBRs.
+:type xs: list[PBR]
+
+:returns: The array of adjacency matrices.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError: if the PBRs in *xs* do not all have the same degree.
+)pbdoc");
+
+    m.def(
+        "pbr_from_array",
+        [](pbr_array const& a) {
+          size_t const     n  = pbr_array_degree(a);
+          bool const*      in = a.data();
+          std::vector<PBR> result(a.shape(0), PBR(n));
+          for (auto& x : result) {
+            load_pbr(x, in, n);
+            in += 4 * n * n;
+          }
+          return result;
+        },
+        py::arg("a"),
+        R"pbdoc(
+:sig=(a: numpy.ndarray) -> list[PBR]:
+
+Returns the PBRs whose adjacency matrices are the entries of an array.
+
+This function is the inverse of :any:`to_array`.
+
+:param a: a boolean array of shape ``(k, 2n, 2n)``.
+:type a: numpy.ndarray
+
+:returns: The list of PBRs.
+:rtype: list[PBR]
+
+:raises LibsemigroupsError: if *a* does not have shape ``(k, 2n, 2n)``.
+)pbdoc");
+
+    // The GIL is not released by pbr_product_batch, because PBR's
+    // product_inplace uses static temporary storage indexed by thread_id,
+    // which is always 0 when called from Python.
+    m.def(
+        "pbr_product_batch",
+        [](pbr_array const& a, pbr_array const& b) {
+          size_t const n = pbr_array_degree(a);
+          if (b.ndim() != 3 || a.shape(0) != b.shape(0)
+              || a.shape(1) != b.shape(1) || a.shape(2) != b.shape(2)) {
+            LIBSEMIGROUPS_EXCEPTION(
+                "expected the arguments to have the same shape, found "
+                "arrays of sizes {} and {}",
+                a.size(),
+                b.size());
+          }
+          pbr_array result(std::vector<py::ssize_t>(
+              {a.shape(0), a.shape(1), a.shape(2)}));
+          bool const* in1 = a.data();
+          bool const* in2 = b.data();
+          bool*       out = result.mutable_data();
+          PBR         x(n), y(n), xy(n);
+          for (py::ssize_t i = 0; i < a.shape(0); ++i) {
+            load_pbr(x, in1 + i * 4 * n * n, n);
+            load_pbr(y, in2 + i * 4 * n * n, n);
+            xy.product_inplace(x, y);
+            store_pbr(xy, out + i * 4 * n * n, n);
+          }
+          return result;
+        },
+        py::arg("a"),
+        py::arg("b"),
+        R"pbdoc(
+:sig=(a: numpy.ndarray, b: numpy.ndarray) -> numpy.ndarray:
+
+Returns the products of two arrays of PBRs.
+
+The arrays *a* and *b* must have the same shape ``(k, 2n, 2n)``, and contain
+the adjacency matrices of PBRs of degree ``n`` as returned by
+:any:`to_array`. The same three :any:`PBR` objects are reused for every
+product, so that no memory is allocated per product once their adjacency
+lists have grown large enough.
+
+:param a: the left hand factors.
+:type a: numpy.ndarray
+
+:param b: the right hand factors.
+:type b: numpy.ndarray
+
+:returns:
+  An array of shape ``(k, 2n, 2n)`` whose ``i``-th entry is the adjacency
+  matrix of the product of the PBRs defined by ``a[i]`` and ``b[i]``.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError: if *a* and *b* do not have the same shape.
+
+.. doctest::
+
+   >>> from libsemigroups_pybind11 import PBR, pbr
+   >>> x = PBR([[1], [0]])
+   >>> y = PBR([[0, 1], [1]])
+   >>> a, b = pbr.to_array([x, y]), pbr.to_array([y, x])
+   >>> pbr.from_array(pbr.product_batch(a, b)) == [x * y, y * x]
+   True
 )pbdoc");
   }  // init_pbr
 
@@ -18,9 +18,15 @@
 
 // C std headers....
 #include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t
 
 // C++ stl headers....
-#include <string>  // for string, basic_string, oper...
+#include <chrono>    // for steady_clock, duration
+#include <iterator>  // for make_move_iterator
+#include <string>    // for string, basic_string, oper...
+#include <tuple>     // for tuple
+#include <utility>   // for move
+#include <vector>    // for vector
 
 // libsemigroups....
 #include <libsemigroups/constants.hpp>     // for operator==, UNDEFINED
@@ -35,17 +41,53 @@
 #include <pybind11/detail/common.h>  // for const_, overload_cast, ove...
 #include <pybind11/detail/descr.h>   // for operator+
 #include <pybind11/functional.h>     // for std::function conversion
+#include <pybind11/numpy.h>          // for array_t
 #include <pybind11/pybind11.h>       // for class_, init, module
 #include <pybind11/pytypes.h>        // for sequence, str_attr_accessor
 #include <pybind11/stl.h>            // for std::vector conversion
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_present
+#include "main.hpp"          // for init_present
+#include "packed-words.hpp"  // for packed_letters, pack_words, unpack_words
 
 namespace libsemigroups {
   namespace py = pybind11;
 
   namespace {
+    // Returns the rules stored in the packed words (letters, offsets), after
+    // checking, in a single pass over letters, that every letter belongs to
+    // the alphabet of p, and that the number of words is even. Must be called
+    // while holding the GIL.
+    template <typename Word>
+    std::vector<Word> unpack_rules(Presentation<Word> const& p,
+                                   packed_letters const&     letters,
+                                   packed_offsets const&     offsets) {
+      size_t const n = throw_if_bad_packed_words(letters, offsets);
+      if (n % 2 != 0) {
+        LIBSEMIGROUPS_EXCEPTION(
+            "expected an even number of words, found {}", n);
+      }
+      std::vector<bool> in_alphabet;
+      for (auto x : p.alphabet()) {
+        uint32_t const y = detail::to_packed_letter(x);
+        if (y >= in_alphabet.size()) {
+          in_alphabet.resize(y + 1, false);
+        }
+        in_alphabet[y] = true;
+      }
+      auto l = letters.unchecked<1>();
+      for (py::ssize_t i = 0; i < letters.size(); ++i) {
+        if (l(i) >= in_alphabet.size() || !in_alphabet[l(i)]) {
+          LIBSEMIGROUPS_EXCEPTION("invalid letter {} at index {} of the array "
+                                  "of letters, expected a letter of the "
+                                  "alphabet of the presentation",
+                                  l(i),
+                                  i);
+        }
+      }
+      return unpack_words<Word>(letters, offsets);
+    }
+
     template <typename Word>
     void bind_present(py::module& m, std::string const& name) {
       using Presentation_ = Presentation<Word>;
@@ -96,6 +138,18 @@ Copy a :any:`Presentation` object.
 )pbdoc");
       thing.def("__copy__",
                 [](Presentation_ const& that) { return Presentation_(that); });
+      thing.def(py::pickle(
+          [](Presentation_ const& self) {
+            return py::make_tuple(
+                self.alphabet(), self.rules, self.contains_empty_word());
+          },
+          [](py::tuple const& state) {
+            Presentation_ result;
+            result.alphabet(state[0].cast<Word>());
+            result.rules = state[1].cast<std::vector<Word>>();
+            result.contains_empty_word(state[2].cast<bool>());
+            return result;
+          }));
       thing.def(
           "alphabet",
           [](Presentation_ const& self) { return self.alphabet(); },
@@ -545,6 +599,113 @@ first :math:`n-1` rules will still be added to *p*.
 :raises LibsemigroupsError:
   if any rule contains any letters not belonging to
   ``p.alphabet()``.)pbdoc");
+      m.def(
+          "presentation_add_rules_packed",
+          [](Presentation_&        p,
+             packed_letters const& letters,
+             packed_offsets const& offsets) {
+            auto rules = unpack_rules(p, letters, offsets);
+            p.rules.insert(p.rules.end(),
+                           std::make_move_iterator(rules.begin()),
+                           std::make_move_iterator(rules.end()));
+          },
+          py::arg("p"),
+          py::arg("letters"),
+          py::arg("offsets"),
+          R"pbdoc(
+:sig=(p: Presentation, letters: numpy.ndarray, offsets: numpy.ndarray) -> None:
+:only-document-once:
+Add many rules stored in flat arrays to *p*.
+
+This function adds the rules ``u_0 = v_0, u_1 = v_1, ...`` to *p* where the
+words ``u_0, v_0, u_1, v_1, ...`` are stored in a pair of flat arrays: the
+*i*-th word is ``letters[offsets[i]:offsets[i + 1]]``. There is one more offset
+than there are words, the first offset is ``0`` and the last is
+``len(letters)``. If the words of *p* are strings, then the letters are the
+code points of the characters. A ``bytes`` object can be used as the array of
+letters by passing ``numpy.frombuffer(b, dtype=numpy.uint8)``.
+
+Every letter is validated, in a single pass over *letters*, before any rule is
+added, so *p* is not modified if this function throws. No Python objects are
+created for the individual words.
+
+:param p: the presentation to add rules to.
+:type p: Presentation
+
+:param letters: the letters of the words.
+:type letters: numpy.ndarray
+
+:param offsets: the offsets of the words in *letters*.
+:type offsets: numpy.ndarray
+
+:raises LibsemigroupsError:
+  if *letters* or *offsets* is not 1-dimensional, or *offsets* is not as
+  described above.
+
+:raises LibsemigroupsError: if the number of words is odd.
+
+:raises LibsemigroupsError:
+  if any letter does not belong to ``p.alphabet()``.
+)pbdoc");
+      m.def(
+          "presentation_from_packed",
+          [](Word const&           alphabet,
+             packed_letters const& letters,
+             packed_offsets const& offsets) {
+            Presentation_ p;
+            p.alphabet(alphabet);
+            p.rules = unpack_rules(p, letters, offsets);
+            return p;
+          },
+          py::arg("alphabet"),
+          py::arg("letters"),
+          py::arg("offsets"),
+          R"pbdoc(
+:sig=(alphabet: Word, letters: numpy.ndarray, offsets: numpy.ndarray) -> Presentation:
+:only-document-once:
+Construct a presentation from an alphabet and rules stored in flat arrays.
+
+This function returns the :any:`Presentation` with alphabet *alphabet* and
+whose rules are stored in *letters* and *offsets* as described in
+:any:`add_rules_packed`. The type of the words of the presentation is the
+type of *alphabet*.
+
+:param alphabet: the alphabet of the presentation.
+:type alphabet: :ref:`Word<pseudo_word_type_helper>`
+
+:param letters: the letters of the words.
+:type letters: numpy.ndarray
+
+:param offsets: the offsets of the words in *letters*.
+:type offsets: numpy.ndarray
+
+:returns: The presentation.
+:rtype: Presentation
+
+:raises LibsemigroupsError: if there are duplicate letters in *alphabet*.
+
+:raises LibsemigroupsError: if :any:`add_rules_packed` does.
+)pbdoc");
+      m.def(
+          "presentation_to_packed",
+          [](Presentation_ const& p) { return pack_words(p.rules); },
+          py::arg("p"),
+          R"pbdoc(
+:sig=(p: Presentation) -> tuple[numpy.ndarray, numpy.ndarray]:
+:only-document-once:
+Return the rules of a presentation stored in flat arrays.
+
+This function returns a tuple ``(letters, offsets)`` of arrays with dtypes
+``uint32`` and ``uint64`` containing the words in ``p.rules``, in the format
+described in :any:`add_rules_packed`. No Python objects are created for the
+individual words.
+
+:param p: the presentation.
+:type p: Presentation
+
+:returns: The letters and offsets of the rules of *p*.
+:rtype: tuple[numpy.ndarray, numpy.ndarray]
+)pbdoc");
       m.def("presentation_add_zero_rules",
             &presentation::add_zero_rules<Word>,
             py::arg("p"),
@@ -703,6 +864,71 @@ was in after the previous iteration.
 :param p: the presentation.
 :type p: Presentation
 
+:raises LibsemigroupsError:
+  if :any:`longest_subword_reducing_length` or :any:`replace_word` does.
+)pbdoc");
+      m.def(
+          "presentation_greedy_reduce_length_with_timings",
+          [](Presentation_& p, bool reduce_number_of_gens) {
+            using clock = std::chrono::steady_clock;
+            std::vector<std::tuple<Word, size_t, size_t, double>> result;
+            py::gil_scoped_release release;
+            size_t        best = presentation::length(p) + p.alphabet().size();
+            Presentation_ prev;
+            while (true) {
+              auto const start = clock::now();
+              auto const w = presentation::longest_subword_reducing_length(p);
+              if (w.empty()) {
+                break;
+              }
+              if (reduce_number_of_gens) {
+                prev = p;
+              }
+              presentation::replace_word_with_new_generator(p, w);
+              size_t const length = presentation::length(p);
+              size_t const next   = length + p.alphabet().size();
+              if (reduce_number_of_gens && next >= best) {
+                p = std::move(prev);
+                break;
+              }
+              best = next;
+              std::chrono::duration<double> const secs = clock::now() - start;
+              result.emplace_back(
+                  w, length, p.alphabet().size(), secs.count());
+            }
+            return result;
+          },
+          py::arg("p"),
+          py::arg("reduce_number_of_gens") = false,
+          R"pbdoc(
+:sig=(p: Presentation, reduce_number_of_gens: bool = False) -> list[tuple[Word, int, int, float]]:
+:only-document-once:
+Greedily reduce the length of the presentation, and return the time taken by
+each step.
+
+If *reduce_number_of_gens* is ``False``, then this function modifies *p* in
+the same way as :any:`greedy_reduce_length`, and otherwise in the same way as
+:any:`greedy_reduce_length_and_number_of_gens`. The whole reduction runs
+without holding the GIL, and without converting the intermediate presentations
+to Python objects.
+
+The returned list contains one tuple ``(w, length, number_of_gens, seconds)``
+for every word ``w`` replaced by a new generator, where ``length`` and
+``number_of_gens`` are the :any:`presentation.length` and the size of the
+alphabet of *p* after replacing ``w``, and ``seconds`` is the time taken to
+find and replace ``w``.
+
+:param p: the presentation.
+:type p: Presentation
+
+:param reduce_number_of_gens:
+  whether or not to stop once the sum of the length and number of generators
+  does not decrease (defaults to ``False``).
+:type reduce_number_of_gens: bool
+
+:returns: The steps of the reduction.
+:rtype: list[tuple[:ref:`Word<pseudo_word_type_helper>`, int, int, float]]
+
 :raises LibsemigroupsError:
   if :any:`longest_subword_reducing_length` or :any:`replace_word` does.
 )pbdoc");
@@ -1568,6 +1794,25 @@ Copy a :any:`InversePresentation` object.
       thing.def("__copy__", [](InversePresentation_ const& that) {
         return InversePresentation_(that);
       });
+      thing.def(py::pickle(
+          [](InversePresentation_ const& self) {
+            return py::make_tuple(self.alphabet(),
+                                  self.rules,
+                                  self.contains_empty_word(),
+                                  self.inverses());
+          },
+          [](py::tuple const& state) {
+            Presentation<Word> p;
+            p.alphabet(state[0].cast<Word>());
+            p.rules = state[1].cast<std::vector<Word>>();
+            p.contains_empty_word(state[2].cast<bool>());
+            InversePresentation_ result(p);
+            auto                 inverses = state[3].cast<Word>();
+            if (!inverses.empty()) {
+              result.inverses(inverses);
+            }
+            return result;
+          }));
 
       thing.def("inverse",
                 &InversePresentation_::inverse,
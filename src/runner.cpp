@@ -17,6 +17,9 @@
 //
 
 // C++ headers
+#include <chrono>       // for nanoseconds, high_resolution_clock
+#include <cstddef>      // for size_t
+#include <functional>   // for function
 #include <type_traits>  // for std::is_same_v
 
 // libsemigroups headers
@@ -73,6 +76,43 @@ namespace libsemigroups {
     to_system(high_resolution_clock::time_point const& tp) {
       return to_system_impl(tp);
     }
+
+    // Run <self> until it finishes or a signal handler raises an exception, in
+    // which case the exception is rethrown once the runner has stopped. The
+    // predicate passed to run_until is called very frequently by some
+    // runners, and so the clock is only consulted every 64-th call, and the
+    // GIL is only reacquired (to call PyErr_CheckSignals) at most once every
+    // <interval>.
+    void run_until_interrupted(Runner&                  self,
+                               std::chrono::nanoseconds interval) {
+      bool   interrupted = false;
+      size_t count       = 0;
+      auto   last_check  = high_resolution_clock::now();
+
+      std::function<bool()> func = [&]() {
+        if (interrupted) {
+          return true;
+        }
+        if (++count % 64 != 0) {
+          return false;
+        }
+        auto now = high_resolution_clock::now();
+        if (now - last_check < interval) {
+          return false;
+        }
+        last_check = now;
+        py::gil_scoped_acquire acquire;
+        interrupted = (PyErr_CheckSignals() != 0);
+        return interrupted;
+      };
+      {
+        py::gil_scoped_release release;
+        self.run_until(func);
+      }
+      if (interrupted) {
+        throw py::error_already_set();
+      }
+    }
   }  // namespace
 
   void init_reporter(py::module& m) {
@@ -474,11 +514,19 @@ been newly default constructed.
 .. seealso::  :any:`Runner()`
 )pbdoc",
         py::return_value_policy::reference_internal);
+    // The GIL is released by run, run_for, and run_until so that other Python
+    // threads can make progress (and, for example, call kill) while the
+    // algorithm is running. The predicate passed to run_until reacquires the
+    // GIL whenever it is called.
     thing.def("run",
               &Runner::run,
+              py::call_guard<py::gil_scoped_release>(),
               R"pbdoc(
 Run until finished. Run the main algorithm implemented by a derived
 class of :any:`Runner`.
+
+The global interpreter lock is released while this function runs, and so other
+Python threads are not blocked by a long running call to this function.
 )pbdoc");
     thing.def(
         "run_for",
@@ -486,6 +534,7 @@ class of :any:`Runner`.
           return self.run_for(t);
         },
         py::arg("t"),
+        py::call_guard<py::gil_scoped_release>(),
         R"pbdoc(
 Run for a specified amount of time.
 
@@ -493,6 +542,8 @@ For this to work it is necessary to periodically check if :any:`timed_out()`
 returns ``True``, and to stop if it is, in the :any:`run()` member function of
 any derived class of :any:`Runner`.
 
+The global interpreter lock is released while this function runs.
+
 :param t: the time to run for.
 :type t: datetime.timedelta
 
@@ -500,14 +551,49 @@ any derived class of :any:`Runner`.
     thing.def("run_until",
               (void(Runner::*)(std::function<bool()>&)) & Runner::run_until,
               py::arg("func"),
+              py::call_guard<py::gil_scoped_release>(),
               R"pbdoc(
 Run until a nullary predicate returns true or finished.
 
+The global interpreter lock is released while this function runs, and is
+reacquired every time that *func* is called.
+
 :param func:
    a nullary function that will be used to determine when to stop running.
 
 :type func:
    collections.abc.Callable[[], bool]
+)pbdoc");
+    thing.def("run_until_interrupted",
+              &run_until_interrupted,
+              py::arg("check_every")
+              = std::chrono::nanoseconds(std::chrono::milliseconds(100)),
+              R"pbdoc(
+:sig=(self: Runner, check_every: datetime.timedelta = datetime.timedelta(milliseconds=100)) -> None:
+
+Run until finished or interrupted by a signal.
+
+This function runs the main algorithm implemented by a derived class of
+:any:`Runner` in the same way as :any:`run`, but roughly every *check_every*
+it checks whether or not a signal (such as ``SIGINT`` from pressing
+``Ctrl-C``) has been received. If a signal has been received, and the handler
+for that signal raises an exception, then the runner stops and the exception
+(for example, a :any:`KeyboardInterrupt`) is raised. In this case
+:any:`stopped_by_predicate` returns ``True``, and the runner can be resumed by
+calling any of :any:`run`, :any:`run_for`, :any:`run_until`, or
+:any:`run_until_interrupted` again.
+
+The global interpreter lock is released while this function runs, except
+when checking for signals.
+
+:param check_every:
+  the minimum amount of time between checks for signals (defaults to 100
+  milliseconds).
+:type check_every: datetime.timedelta
+
+.. note::
+  Signals are only handled in the main Python thread. To stop a runner that is
+  running in another thread use :any:`kill`.
 )pbdoc");
     thing.def("timed_out",
               &Runner::timed_out,
@@ -20,22 +20,61 @@
 // TODO(0) Check types
 
 // C++ stl headers....
-#include <memory>  // for allocator, make_unique, unique_ptr
+#include <algorithm>  // for copy
+#include <cstddef>    // for size_t
+#include <memory>     // for allocator, make_unique, unique_ptr
+#include <utility>    // for swap
+#include <vector>     // for vector
 
 // libsemigroups headers
 #include <libsemigroups/libsemigroups.hpp>
 #include <libsemigroups/schreier-sims.hpp>
 
 // pybind11....
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_schreier_sims
+#include "main.hpp"     // for init_schreier_sims
+#include "threads.hpp"  // for run_in_threads
 
 namespace libsemigroups {
   namespace py = pybind11;
 
   namespace {
+    // Returns true if the permutation with images x[0], ..., x[n - 1] belongs
+    // to the group generated by the finished SchreierSims object S. The
+    // member function SchreierSims::sift uses some scratch storage in S, and
+    // so can't be called in several threads at once, this function only uses
+    // the const accessors of S and the storage in tmp, which must have length
+    // 2 * n.
+    template <typename SchreierSims_, typename Point>
+    bool sifts_to_one(SchreierSims_ const& S,
+                      Point const*         x,
+                      size_t               n,
+                      std::vector<Point>&  tmp) {
+      Point* y = tmp.data();
+      Point* z = tmp.data() + n;
+      std::copy(x, x + n, y);
+      for (size_t depth = 0; depth < S.base_size(); ++depth) {
+        Point const beta = y[S.base(depth)];
+        if (!S.orbit_lookup(depth, beta)) {
+          return false;
+        }
+        auto const& u = S.inverse_transversal_element(depth, beta);
+        for (size_t i = 0; i < n; ++i) {
+          z[i] = u[y[i]];
+        }
+        std::swap(y, z);
+      }
+      for (size_t i = 0; i < n; ++i) {
+        if (y[i] != i) {
+          return false;
+        }
+      }
+      return true;
+    }
+
     template <size_t N, typename Point, typename Element>
     void bind_schreier_sims(py::module& m, std::string const& name) {
       using SchreierSims_ = SchreierSims<N, Point, Element>;
@@ -182,6 +221,94 @@ Test membership of an element.
 :returns: ``True`` if *element* is a contained in the :any:`SchreierSims`
       instance, and ``False`` otherwise.
 :rtype: bool
+)pbdoc");
+      thing.def(
+          "contains_many",
+          [](SchreierSims_&                                 S,
+             py::array_t<Point, py::array::c_style> const& a,
+             size_t number_of_threads) {
+            if (a.ndim() != 2) {
+              LIBSEMIGROUPS_EXCEPTION("expected a 2-dimensional array, found "
+                                      "a {}-dimensional array",
+                                      a.ndim());
+            }
+            size_t const k = a.shape(0);
+            size_t const n = a.shape(1);
+            if (S.number_of_generators() != 0
+                && n != S.generator(0).degree()) {
+              LIBSEMIGROUPS_EXCEPTION("expected an array with {} columns (the "
+                                      "degree of the generators), found {}",
+                                      S.generator(0).degree(),
+                                      n);
+            }
+            Point const* x = a.data();
+            for (size_t i = 0; i < k * n; ++i) {
+              if (x[i] >= n) {
+                LIBSEMIGROUPS_EXCEPTION("expected the entries of row {} to be "
+                                        "in the range [0, {}), found {}",
+                                        i / n,
+                                        n,
+                                        x[i]);
+              }
+            }
+            S.run();
+            py::array_t<bool> result(k);
+            bool*             out = result.mutable_data();
+            {
+              py::gil_scoped_release release;
+              run_in_threads(
+                  k, number_of_threads, [&](size_t first, size_t last) {
+                    std::vector<Point> tmp(2 * n);
+                    for (size_t i = first; i < last; ++i) {
+                      out[i] = sifts_to_one(S, x + i * n, n, tmp);
+                    }
+                  });
+            }
+            return result;
+          },
+          py::arg("a"),
+          py::arg("number_of_threads") = 1,
+          R"pbdoc(
+:sig=(self: SchreierSims, a: numpy.ndarray, number_of_threads: int = 1) -> numpy.ndarray:
+
+Test membership of many permutations.
+
+This function runs the Schreier-Sims algorithm (if it hasn't been run
+already), and then tests the membership of each of the permutations in *a*,
+where the images of the points ``0``, ``1``, ..., ``n - 1`` under the
+``i``-th permutation are ``a[i]``. The permutations are sifted through the
+stabiliser chain without holding the GIL using *number_of_threads* threads.
+Rows of *a* that are not permutations are not contained in the group.
+
+:param a:
+  a 2-dimensional array with one row per permutation, and unsigned integer
+  entries (``numpy.uint8`` for :any:`Perm` of degree at most ``255`` and
+  ``numpy.uint16`` otherwise).
+:type a: numpy.ndarray
+
+:param number_of_threads: the number of threads to use (default: ``1``).
+:type number_of_threads: int
+
+:returns:
+  An array of ``bool`` whose ``i``-th entry is ``True`` if the ``i``-th
+  permutation is contained in *self*.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError:
+  if *a* is not 2-dimensional, or the number of columns of *a* is not the
+  degree of the generators, or any entry of *a* is out of bounds.
+
+.. doctest:: python
+
+    >>> import numpy as np
+    >>> from libsemigroups_pybind11 import SchreierSims, Perm
+    >>> p1 = Perm([1, 2, 0] + list(range(3, 255)))
+    >>> S = SchreierSims([p1])
+    >>> a = np.array([list(range(255)),
+    ...               [2, 0, 1] + list(range(3, 255)),
+    ...               [1, 0, 2] + list(range(3, 255))], dtype=np.uint8)
+    >>> S.contains_many(a)
+    array([ True,  True, False])
 )pbdoc");
       thing.def("currently_contains",
                 &SchreierSims_::currently_contains,
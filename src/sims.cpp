@@ -18,9 +18,26 @@
 
 // C++ stl headers....
 #include <pybind11/detail/common.h>
-#include <vector>  // for vector
+#include <algorithm>           // for min, none_of, sort, stable_sort
+#include <array>               // for array
+#include <atomic>              // for atomic
+#include <condition_variable>  // for condition_variable
+#include <deque>               // for deque
+#include <exception>           // for exception_ptr, current_exception
+#include <functional>          // for function
+#include <iterator>            // for next
+#include <memory>              // for make_shared, shared_ptr, weak_ptr
+#include <mutex>               // for mutex, lock_guard, unique_lock
+#include <numeric>             // for iota
+#include <string>              // for string, to_string
+#include <thread>              // for thread
+#include <type_traits>         // for is_same_v
+#include <unordered_map>       // for unordered_map
+#include <utility>             // for move, make_pair
+#include <vector>              // for vector
 
 // libsemigroups....
+#include <libsemigroups/gabow.hpp>         // for Gabow
 #include <libsemigroups/presentation.hpp>  // for Presentation
 #include <libsemigroups/rx/ranges.hpp>  // for rx::begin, rx::end, rx::transform
 #include <libsemigroups/sims.hpp>       // for Sims1, Sims2, ....
@@ -29,11 +46,14 @@
 
 // pybind11....
 #include <pybind11/functional.h>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_sims
+#include "main.hpp"          // for init_sims
+#include "packed-words.hpp"  // for pack_words
+#include "threads.hpp"       // for run_in_threads
 
 namespace libsemigroups {
   namespace py          = pybind11;
@@ -41,6 +61,154 @@ namespace libsemigroups {
   using word_graph_type = WordGraph<node_type>;
   using size_type       = typename word_graph_type::size_type;
 
+  //////////////////////////////////////////////////////////////////////////////
+  // SimsPruner
+  //////////////////////////////////////////////////////////////////////////////
+
+  namespace {
+    // A pruner implemented entirely in C++, so that the search in Sims1 or
+    // Sims2 can call it without acquiring the GIL.
+    struct SimsPruner {
+      std::function<bool(word_graph_type const&)> func;
+      std::string                                 description;
+
+      bool operator()(word_graph_type const& wg) const {
+        return func(wg);
+      }
+    };
+
+    std::string word_repr(word_type const& w) {
+      std::string result = "[";
+      for (size_t i = 0; i < w.size(); ++i) {
+        result += (i == 0 ? "" : ", ") + std::to_string(w[i]);
+      }
+      return result + "]";
+    }
+
+    // The nodes of the word graphs in the search are created as targets of
+    // edges from existing nodes, and so the nodes that are currently used are
+    // 0, ..., m - 1 where m is the number of nodes reachable from 0.
+    size_t number_of_active_nodes(word_graph_type const& wg) {
+      if (wg.number_of_nodes() == 0) {
+        return 0;
+      }
+      return word_graph::number_of_nodes_reachable_from(wg, 0);
+    }
+
+    bool is_complete_on_active_nodes(word_graph_type const& wg, size_t m) {
+      for (node_type s = 0; s < m; ++s) {
+        for (size_t a = 0; a < wg.out_degree(); ++a) {
+          if (wg.target_no_checks(s, a) == UNDEFINED) {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+    // The nodes that are not active have no edges, and so each forms its own
+    // strongly connected component.
+    size_t number_of_active_components(word_graph_type const& wg, size_t m) {
+      Gabow<node_type> gabow(wg);
+      return gabow.number_of_components() - (wg.number_of_nodes() - m);
+    }
+
+    SimsPruner max_nodes_pruner(size_t n) {
+      return SimsPruner{
+          [n](word_graph_type const& wg) {
+            return number_of_active_nodes(wg) <= n;
+          },
+          fmt::format("max_nodes_pruner({})", n)};
+    }
+
+    SimsPruner contains_pair_pruner(word_type const& u, word_type const& v) {
+      return SimsPruner{
+          [u, v](word_graph_type const& wg) {
+            if (wg.number_of_nodes() == 0) {
+              return true;
+            }
+            node_type const root = 0;
+            auto            x    = word_graph::follow_path_no_checks(
+                wg, root, u.cbegin(), u.cend());
+            auto y = word_graph::follow_path_no_checks(
+                wg, root, v.cbegin(), v.cend());
+            return x == UNDEFINED || y == UNDEFINED || x == y;
+          },
+          fmt::format(
+              "contains_pair_pruner({}, {})", word_repr(u), word_repr(v))};
+    }
+
+    SimsPruner number_of_components_pruner(size_t min, size_t max) {
+      if (min > max) {
+        LIBSEMIGROUPS_EXCEPTION("the 1st argument (min) must be at most the "
+                                "2nd argument (max), found {} > {}",
+                                min,
+                                max);
+      }
+      return SimsPruner{
+          [min, max](word_graph_type const& wg) {
+            size_t const m = number_of_active_nodes(wg);
+            if (!is_complete_on_active_nodes(wg, m)) {
+              return true;
+            }
+            size_t const c = number_of_active_components(wg, m);
+            return min <= c && c <= max;
+          },
+          fmt::format("number_of_components_pruner({}, {})", min, max)};
+    }
+
+    // Refiners modify some scratch data when they are called, and Sims1 and
+    // Sims2 call the same pruner from every thread of the search at once. So
+    // every thread calls its own copy of the refiner, made from a shared
+    // prototype the first time that the thread calls the pruner. The copies
+    // are stored in a thread_local map keyed by the address of the prototype,
+    // and a copy is only used while its prototype is alive, so that a reused
+    // address never matches a stale copy.
+    template <typename Refiner>
+    SimsPruner refiner_pruner(Refiner const& refiner,
+                              std::string_view name) {
+      auto prototype = std::make_shared<Refiner const>(refiner);
+      return SimsPruner{
+          [prototype](word_graph_type const& wg) {
+            thread_local std::unordered_map<
+                Refiner const*,
+                std::pair<std::weak_ptr<Refiner const>, Refiner>>
+                copies;
+            auto it = copies.find(prototype.get());
+            if (it == copies.end() || it->second.first.expired()) {
+              for (auto jt = copies.begin(); jt != copies.end();) {
+                jt = jt->second.first.expired() ? copies.erase(jt)
+                                                : std::next(jt);
+              }
+              it = copies
+                       .insert_or_assign(prototype.get(),
+                                         std::make_pair(
+                                             std::weak_ptr<Refiner const>(
+                                                 prototype),
+                                             Refiner(*prototype)))
+                       .first;
+            }
+            return it->second.second(wg);
+          },
+          fmt::format("refiner_pruner({})", name)};
+    }
+
+    SimsPruner combine_pruners(SimsPruner const& x,
+                               SimsPruner const& y,
+                               bool              is_and) {
+      auto f = x.func;
+      auto g = y.func;
+      if (is_and) {
+        return SimsPruner{
+            [f, g](word_graph_type const& wg) { return f(wg) && g(wg); },
+            fmt::format("({} & {})", x.description, y.description)};
+      }
+      return SimsPruner{
+          [f, g](word_graph_type const& wg) { return f(wg) || g(wg); },
+          fmt::format("({} | {})", x.description, y.description)};
+    }
+  }  // namespace
+
   //////////////////////////////////////////////////////////////////////////////
   // SimsSettings
   //////////////////////////////////////////////////////////////////////////////
@@ -309,6 +477,33 @@ Add a pruner to the search tree.
 :returns: The first argument *self*.
 :rtype: {0}
 
+.. warning::
+    When running the Sims low-index backtrack with multiple threads, each added
+    pruner must be guaranteed thread safe. Failing to do so could cause bad
+    things to happen.
+)pbdoc",
+                    doc_type)
+            .c_str());
+
+    // This overload must be defined before the one for arbitrary callables,
+    // since SimsPruner objects are also callable from Python.
+    ss.def(
+        "add_pruner",
+        [](SimsSettings_& self, SimsPruner const& func) -> Subclass& {
+          return self.add_pruner(func);
+        },
+        py::arg("pruner"),
+        fmt::format(R"pbdoc(
+:sig=(self: {0}, pruner: collections.abc.Callable[[WordGraph], bool]) -> {0}:
+:only-document-once:
+Add a pruner to the search tree.
+
+:param pruner: a pruner function.
+:type pruner: collections.abc.Callable[[WordGraph], bool]
+
+:returns: The first argument *self*.
+:rtype: {0}
+
 .. warning::
     When running the Sims low-index backtrack with multiple threads, each added
     pruner must be guaranteed thread safe. Failing to do so could cause bad
@@ -482,9 +677,10 @@ Clear the set of excluded words.
                     doc_type)
             .c_str());
 
-    ss.def("stats",
-           &SimsSettings_::stats,
-           R"pbdoc(
+    ss.def(
+        "stats",
+        [](SimsSettings_ const& self) { return SimsStats(self.stats()); },
+        R"pbdoc(
 Get the current stats object.
 
 This function returns the current stats object. The value returned by this
@@ -492,6 +688,11 @@ function is a :any:`SimsStats` object which contains some statistics related to
 the current :any:`Sims1` or :any:`Sims2` instance and any part of the depth
 first search already conducted.
 
+The returned object is a snapshot, made using atomic loads of the counters
+that the search updates, and so this function can be called from another
+Python thread while the search is running (the functions that run the search
+release the global interpreter lock), for example, to monitor its progress.
+
 :returns: The :any:`SimsStats` object containing the current stats.
 :rtype: SimsStats
 )pbdoc");
@@ -611,6 +812,127 @@ This function re-initializes a :any:`{0}` instance to be in the same state as
   // Sims1 and Sims2 common functions
   //////////////////////////////////////////////////////////////////////////////
 
+  namespace {
+    // The state shared by the thread running the search in Sims1/2.batches,
+    // and the Python iterator it returns. The search pushes the targets of
+    // each word graph found onto the queue, waiting while the queue is full,
+    // and stops once cancelled is set. The search also has a pruner that
+    // prunes everything once cancelled is set, so that it stops promptly
+    // even if it does not find any more word graphs. The value of cancelled
+    // is only changed while holding mtx, but it is atomic so that the pruner
+    // can read it without locking.
+    struct SimsBatchQueue {
+      std::mutex                         mtx;
+      std::condition_variable            cv;
+      std::deque<std::vector<node_type>> queue;
+      size_t                             capacity  = 0;
+      bool                               done      = false;
+      std::atomic<bool>                  cancelled{false};
+      std::exception_ptr                 error;
+      std::thread                        worker;
+
+      ~SimsBatchQueue() {
+        {
+          std::lock_guard<std::mutex> lock(mtx);
+          cancelled = true;
+        }
+        cv.notify_all();
+        if (worker.joinable()) {
+          // The search may call pruners defined in Python.
+          if (PyGILState_Check()) {
+            py::gil_scoped_release release;
+            worker.join();
+          } else {
+            worker.join();
+          }
+        }
+      }
+    };
+
+    // Returns the targets of the nodes 0, ..., m - 1 of wg, where m is the
+    // number of nodes with defined targets, which are the first m nodes for
+    // the word graphs found by Sims1 and Sims2.
+    std::vector<node_type> active_targets(word_graph_type const& wg) {
+      std::vector<node_type> result;
+      for (node_type s = 0; s < wg.number_of_nodes(); ++s) {
+        if (wg.out_degree() != 0 && wg.target_no_checks(s, 0) == UNDEFINED) {
+          break;
+        }
+        for (size_t a = 0; a < wg.out_degree(); ++a) {
+          result.push_back(wg.target_no_checks(s, a));
+        }
+      }
+      return result;
+    }
+
+    template <typename Thing>
+    py::object sims_batches(Thing const& self, size_t n, size_t batch_size) {
+      if (n == 0) {
+        LIBSEMIGROUPS_EXCEPTION(
+            "the 1st argument (number of classes) must be non-zero");
+      } else if (batch_size == 0) {
+        LIBSEMIGROUPS_EXCEPTION(
+            "the 2nd argument (batch size) must be non-zero");
+      } else if (self.presentation().alphabet().empty()
+                 && self.presentation().rules.empty()) {
+        LIBSEMIGROUPS_EXCEPTION(
+            "the presentation must not have 0 generators and 0 relations");
+      }
+      auto q      = std::make_shared<SimsBatchQueue>();
+      q->capacity = 4 * batch_size;
+      // The worker only holds a raw pointer, since q is destroyed (and the
+      // worker joined) when the last copy of the Python iterator is.
+      q->worker = std::thread([q = q.get(), sims = Thing(self), n]() mutable {
+        try {
+          sims.add_pruner(
+              [q](word_graph_type const&) { return !q->cancelled; });
+          sims.find_if(n, [q](word_graph_type const& wg) {
+            auto                         targets = active_targets(wg);
+            std::unique_lock<std::mutex> lock(q->mtx);
+            q->cv.wait(lock, [q] {
+              return q->cancelled || q->queue.size() < q->capacity;
+            });
+            if (!q->cancelled) {
+              q->queue.push_back(std::move(targets));
+            }
+            q->cv.notify_all();
+            return q->cancelled;
+          });
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(q->mtx);
+          q->error = std::current_exception();
+        }
+        std::lock_guard<std::mutex> lock(q->mtx);
+        q->done = true;
+        q->cv.notify_all();
+      });
+
+      py::cpp_function next_batch([q, batch_size]() -> py::object {
+        std::vector<std::vector<node_type>> batch;
+        {
+          py::gil_scoped_release       release;
+          std::unique_lock<std::mutex> lock(q->mtx);
+          q->cv.wait(lock,
+                     [&] { return q->done || q->queue.size() >= batch_size; });
+          while (batch.size() < batch_size && !q->queue.empty()) {
+            batch.push_back(std::move(q->queue.front()));
+            q->queue.pop_front();
+          }
+          q->cv.notify_all();
+          if (batch.empty() && q->error) {
+            std::rethrow_exception(q->error);
+          }
+        }
+        if (batch.empty()) {
+          return py::none();
+        }
+        return pack_words(batch);
+      });
+      return py::module_::import("builtins").attr("iter")(next_batch,
+                                                          py::none());
+    }
+  }  // namespace
+
   template <typename Thing, typename ThingBase>
   void def_sims_common(py::class_<Thing, ThingBase>& thing,
                        std::string_view              doc_type) {
@@ -681,6 +1003,7 @@ constructed from the presentation *p*.
     thing.def("number_of_congruences",
               &Thing::number_of_congruences,
               py::arg("n"),
+              py::call_guard<py::gil_scoped_release>(),
               fmt::format(R"pbdoc(
 :sig=(self: {0}, n: int) -> int:
 
@@ -694,6 +1017,8 @@ This function exists to:
 * allow for the computation of the number of congruence to be performed using
   :py:meth:`~{0}.number_of_threads` in parallel.
 
+The global interpreter lock is released while the congruences are counted.
+
 :param n: the maximum number of congruence classes.
 :type n: int
 
@@ -714,6 +1039,7 @@ This function exists to:
               &Thing::for_each,
               py::arg("n"),
               py::arg("pred"),
+              py::call_guard<py::gil_scoped_release>(),
               fmt::format(R"pbdoc(
 :sig=(self: {0}, n: int, pred: collections.abc.Callable[[WordGraph], None]) -> None:
 
@@ -749,6 +1075,7 @@ most *n* classes. This function exists to:
               &Thing::find_if,
               py::arg("n"),
               py::arg("pred"),
+              py::call_guard<py::gil_scoped_release>(),
               fmt::format(R"pbdoc(
 :sig=(self: {0}, n: int, pred: collections.abc.Callable[[WordGraph], bool]) -> WordGraph:
 
@@ -835,12 +1162,252 @@ time being.
 )pbdoc",
                     doc_type)
             .c_str());
+
+    thing.def("batches",
+              &sims_batches<Thing>,
+              py::arg("n"),
+              py::arg("batch_size") = 1024,
+              fmt::format(R"pbdoc(
+:sig=(self: {0}, n: int, batch_size: int = 1024) -> collections.abc.Iterator[tuple[numpy.ndarray, numpy.ndarray]]:
+
+Returns an iterator yielding the congruences of index at most *n* in batches.
+
+This function returns an iterator yielding the same congruences as
+:py:meth:`~{0}.iterator`, but in batches of (at most) *batch_size* congruences,
+and without calling back into Python for every congruence found. The search is
+run (using :py:meth:`~{0}.number_of_threads` threads) in the background, on a
+copy of *self*, and the word graphs found are stored in a queue, which is
+drained by the returned iterator. The global interpreter lock is not held by
+the search, or while waiting for the next batch.
+
+Each batch is a tuple ``(targets, offsets)`` of flat arrays with dtypes
+``uint32`` and ``uint64``, where
+``targets[offsets[i]:offsets[i + 1]].reshape(-1, k)`` is the table of targets
+of the nodes of the *i*-th word graph in the batch that have defined targets,
+``k`` is the number of generators of :py:meth:`~{0}.presentation`, and
+undefined targets are ``2 ** 32 - 1``. If the search uses more than one thread,
+then the order of the congruences is not deterministic.
+
+If the returned iterator is discarded before it is exhausted, then the search
+stops the next time a congruence is found.
+
+:param n: the maximum number of classes in a congruence.
+:type n: int
+
+:param batch_size: the maximum number of congruences in a batch (defaults to ``1024``).
+:type batch_size: int
+
+:returns: An iterator yielding batches of congruences.
+:rtype: collections.abc.Iterator[tuple[numpy.ndarray, numpy.ndarray]]
+
+:raises LibsemigroupsError: if *n* or *batch_size* is ``0``.
+
+:raises LibsemigroupsError:
+    if :py:meth:`~{0}.presentation()` has 0-generators and 0-relations (i.e.
+    it has not been initialised).
+)pbdoc",
+                          doc_type)
+                  .c_str());
   }
 
   //////////////////////////////////////////////////////////////////////////////
   // RepOrc and MinimalRepOrc common functions
   //////////////////////////////////////////////////////////////////////////////
 
+  namespace {
+    // Runs a RepOrc search for each number of nodes d in [min, max], with at
+    // most number_of_searches searches running at the same time, each search
+    // using the settings of self. Idle threads take the smallest d not yet
+    // searched. If minimal is true, then the search for d is abandoned once
+    // some d' < d is successful and the word graph with fewest nodes is
+    // returned. Otherwise every search is abandoned once any is successful.
+    template <typename Thing>
+    word_graph_type concurrent_rep_orc(Thing const& self,
+                                       size_t       min,
+                                       size_t       max,
+                                       size_t       number_of_searches,
+                                       bool         minimal) {
+      if (number_of_searches == 0) {
+        LIBSEMIGROUPS_EXCEPTION(
+            "the 1st argument (number of searches) must be non-zero");
+      }
+      size_t const        none = max + 1;
+      std::atomic<size_t> next(min);
+      std::atomic<size_t> best(none);
+      std::mutex          mtx;
+      word_graph_type     result;
+      std::exception_ptr  error;
+
+      auto search = [&]() {
+        for (size_t d = next++; d <= max && d < best; d = next++) {
+          try {
+            RepOrc ro;
+            ro.init(static_cast<SimsSettings<Thing> const&>(self));
+            ro.min_nodes(d).max_nodes(d).target_size(self.target_size());
+            ro.add_pruner([&best, d, minimal, none](word_graph_type const&) {
+              return minimal ? d < best : best == none;
+            });
+            auto wg = ro.word_graph();
+            if (wg.number_of_nodes() != 0) {
+              std::lock_guard<std::mutex> lock(mtx);
+              if (d < best) {
+                best   = d;
+                result = std::move(wg);
+              }
+            }
+          } catch (...) {
+            std::lock_guard<std::mutex> lock(mtx);
+            error = std::current_exception();
+            best  = 0;
+          }
+        }
+      };
+
+      std::vector<std::thread> threads;
+      size_t const             n = std::min(number_of_searches, max - min + 1);
+      for (size_t i = 1; i < n; ++i) {
+        threads.emplace_back(search);
+      }
+      search();
+      for (auto& t : threads) {
+        t.join();
+      }
+      if (error) {
+        std::rethrow_exception(error);
+      }
+      return result;
+    }
+  }  // namespace
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Congruence lattices
+  //////////////////////////////////////////////////////////////////////////////
+
+  namespace {
+    // Returns a copy of the word graph wg found by Sims1 or Sims2 with only
+    // its nodes 0, ..., m - 1 that have defined targets.
+    word_graph_type trimmed_word_graph(word_graph_type const& wg) {
+      auto const      targets = active_targets(wg);
+      size_t const    k       = wg.out_degree();
+      size_t const    m       = (k == 0 ? 1 : targets.size() / k);
+      word_graph_type result(m, k);
+      for (node_type s = 0; s < m; ++s) {
+        for (size_t a = 0; a < k; ++a) {
+          result.target_no_checks(s, a, targets[s * k + a]);
+        }
+      }
+      return result;
+    }
+
+    // Returns true if the right congruence defined by x is contained in that
+    // defined by y, i.e. if mapping 0 in x to 0 in y extends to a
+    // homomorphism of word graphs. Every node of x must be reachable from 0,
+    // and phi and queue are scratch storage, reused between calls.
+    bool is_contained_in(word_graph_type const&  x,
+                         word_graph_type const&  y,
+                         std::vector<node_type>& phi,
+                         std::vector<node_type>& queue) {
+      phi.assign(x.number_of_nodes(), UNDEFINED);
+      phi[0] = 0;
+      queue.assign(1, 0);
+      for (size_t i = 0; i < queue.size(); ++i) {
+        node_type const s = queue[i];
+        for (size_t a = 0; a < x.out_degree(); ++a) {
+          node_type const tx = x.target_no_checks(s, a);
+          if (tx == UNDEFINED) {
+            continue;
+          }
+          node_type const ty = y.target_no_checks(phi[s], a);
+          if (ty == UNDEFINED) {
+            return false;
+          } else if (phi[tx] == UNDEFINED) {
+            phi[tx] = ty;
+            queue.push_back(tx);
+          } else if (phi[tx] != ty) {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+    // Returns the congruences with at most n classes found by sims, and the
+    // covering relation of the lattice they form as an array of pairs (i, j)
+    // such that the i-th congruence is covered by the j-th. A congruence j
+    // containing i has fewer classes unless i == j, and so for each i the
+    // congruences containing i are considered in decreasing order of the
+    // number of classes. Such a congruence j covers i if and only if it
+    // contains no cover of i found so far.
+    template <typename Thing>
+    py::tuple sims_congruence_lattice(Thing const& sims,
+                                      size_t       n,
+                                      size_t       number_of_threads) {
+      if (n == 0) {
+        LIBSEMIGROUPS_EXCEPTION(
+            "the 2nd argument (number of classes) must be non-zero");
+      } else if (sims.presentation().alphabet().empty()
+                 && sims.presentation().rules.empty()) {
+        LIBSEMIGROUPS_EXCEPTION(
+            "the presentation must not have 0 generators and 0 relations");
+      }
+      std::vector<word_graph_type>       graphs;
+      std::vector<std::array<size_t, 2>> covers;
+      {
+        py::gil_scoped_release release;
+        std::mutex             mtx;
+        sims.for_each(n, [&graphs, &mtx](word_graph_type const& wg) {
+          auto                        g = trimmed_word_graph(wg);
+          std::lock_guard<std::mutex> lock(mtx);
+          graphs.push_back(std::move(g));
+        });
+
+        std::vector<size_t> order(graphs.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](size_t i, size_t j) {
+          return graphs[i].number_of_nodes() > graphs[j].number_of_nodes();
+        });
+
+        run_in_threads(
+            graphs.size(), number_of_threads, [&](size_t first, size_t last) {
+              std::vector<node_type>             phi, queue;
+              std::vector<size_t>                found;
+              std::vector<std::array<size_t, 2>> local;
+              for (size_t i = first; i < last; ++i) {
+                auto const& x = graphs[i];
+                found.clear();
+                for (size_t j : order) {
+                  auto const& y = graphs[j];
+                  if (y.number_of_nodes() >= x.number_of_nodes()
+                      || !is_contained_in(x, y, phi, queue)) {
+                    continue;
+                  }
+                  bool const is_cover = std::none_of(
+                      found.cbegin(), found.cend(), [&](size_t c) {
+                        return is_contained_in(graphs[c], y, phi, queue);
+                      });
+                  if (is_cover) {
+                    found.push_back(j);
+                    local.push_back({i, j});
+                  }
+                }
+              }
+              std::lock_guard<std::mutex> lock(mtx);
+              covers.insert(covers.end(), local.cbegin(), local.cend());
+            });
+        std::sort(covers.begin(), covers.end());
+      }
+
+      py::array_t<uint32_t> result(std::vector<py::ssize_t>(
+          {static_cast<py::ssize_t>(covers.size()), 2}));
+      auto r = result.mutable_unchecked<2>();
+      for (size_t i = 0; i < covers.size(); ++i) {
+        r(i, 0) = covers[i][0];
+        r(i, 1) = covers[i][1];
+      }
+      return py::make_tuple(py::cast(std::move(graphs)), result);
+    }
+  }  // namespace
+
   template <typename Thing, typename ThingBase>
   void def_reporc_common(py::class_<Thing, ThingBase>& thing,
                          std::string_view              doc_type) {
@@ -862,6 +1429,63 @@ returned by the function :py:meth:`~{0}.word_graph`.
                     doc_type)
             .c_str());
 
+    thing.def(
+        "concurrent_word_graph",
+        [](Thing const& self, size_t number_of_searches) {
+          if constexpr (std::is_same_v<Thing, RepOrc>) {
+            if (self.min_nodes() > self.max_nodes()) {
+              return word_graph_type();
+            }
+            return concurrent_rep_orc(self,
+                                      self.min_nodes(),
+                                      self.max_nodes(),
+                                      number_of_searches,
+                                      false);
+          } else {
+            size_t const max = self.presentation().contains_empty_word()
+                                   ? self.target_size()
+                                   : self.target_size() + 1;
+            return concurrent_rep_orc(
+                self, 1, max, number_of_searches, true);
+          }
+        },
+        py::arg("number_of_searches"),
+        py::call_guard<py::gil_scoped_release>(),
+        fmt::format(R"pbdoc(
+:sig=(self: {0}, number_of_searches: int) -> WordGraph:
+
+Get the word graph, using several searches at once.
+
+This function returns a word graph with the same properties as the one
+returned by :py:meth:`~{0}.word_graph`, but instead of searching for word graphs
+with every possible number of nodes in one search, it runs a separate search
+for each possible number of nodes, with at most *number_of_searches* of these
+searches running concurrently (each using :py:meth:`~{0}.number_of_threads`
+threads). Whenever a search finishes, the search for the smallest number of
+nodes not yet considered is started. {1}
+
+The global interpreter lock is released while the searches are running.
+
+:param number_of_searches: the maximum number of concurrent searches.
+:type number_of_searches: int
+
+:returns: A value of type :any:`WordGraph`.
+:rtype: WordGraph
+
+:raises LibsemigroupsError: if *number_of_searches* is ``0``.
+)pbdoc",
+                    doc_type,
+                    std::is_same_v<Thing, RepOrc>
+                        ? "As soon as any search succeeds, all of the other "
+                          "searches are abandoned. Hence the word graph "
+                          "returned might not be the same as the one returned "
+                          "by :py:meth:`~RepOrc.word_graph`."
+                        : "As soon as a search succeeds, all of the searches "
+                          "for larger numbers of nodes are abandoned, and the "
+                          "word graph returned has the minimum possible "
+                          "number of nodes.")
+            .c_str());
+
     thing.def(
         "target_size",
         [](Thing& self, size_t val) -> Thing& { return self.target_size(val); },
@@ -1328,6 +1952,94 @@ will result in a word graph defining a Rees congruence. Otherwise returns
 :rtype: bool
 )pbdoc");
 
+    ////////////////////////////////////////////////////////////////////////////
+    // SimsPruner
+    ////////////////////////////////////////////////////////////////////////////
+
+    py::class_<SimsPruner> sp(m,
+                              "SimsPruner",
+                              R"pbdoc(
+A pruner implemented in C++.
+
+Instances of this class are pruners, i.e. functions that take a word graph and
+return a boolean, which can be added to :any:`Sims1`, :any:`Sims2`,
+:any:`RepOrc` and :any:`MinimalRepOrc` objects using the ``add_pruner``
+member functions. Unlike pruners defined in Python, calling an instance of this
+class from the low-index backtrack does not require the global interpreter lock,
+and so it does not prevent the search from running in parallel when
+``number_of_threads`` is greater than ``1``.
+
+Instances of this class are constructed using the functions
+:any:`sims.max_nodes_pruner`, :any:`sims.contains_pair_pruner`,
+:any:`sims.transitive_pruner`, :any:`sims.number_of_components_pruner` and
+:any:`sims.refiner_pruner`, and can be combined using ``&`` (a word graph is
+accepted if it is accepted by both pruners) and ``|`` (a word graph is accepted
+if it is accepted by either pruner).
+
+.. doctest::
+
+    >>> from libsemigroups_pybind11 import Presentation, Sims1, presentation, sims
+    >>> p = Presentation([0, 1])
+    >>> p.contains_empty_word(True)
+    <monoid presentation with 2 letters, 0 rules, and length 0>
+    >>> presentation.add_rule(p, [0, 1], [1, 0])
+    >>> pruner = sims.transitive_pruner() & sims.max_nodes_pruner(3)
+    >>> pruner
+    <SimsPruner (transitive_pruner() & max_nodes_pruner(3))>
+    >>> s = Sims1(p)
+    >>> n = s.number_of_congruences(4)
+    >>> s.add_pruner(pruner).number_of_congruences(4) < n
+    True
+)pbdoc");
+
+    sp.def("__repr__", [](SimsPruner const& self) {
+      return fmt::format("<SimsPruner {}>", self.description);
+    });
+
+    sp.def("__copy__", [](SimsPruner const& self) { return SimsPruner(self); });
+
+    sp.def(
+        "copy",
+        [](SimsPruner const& self) { return SimsPruner(self); },
+        R"pbdoc(
+Copy a :any:`SimsPruner` object.
+
+:returns: A copy.
+:rtype: SimsPruner
+)pbdoc");
+
+    sp.def(
+        "__call__",
+        [](SimsPruner const& self, word_graph_type const& wg) {
+          return self(wg);
+        },
+        py::arg("wg"),
+        R"pbdoc(
+:sig=(self: SimsPruner, wg: WordGraph) -> bool:
+
+Check if a word graph is accepted by the pruner.
+
+:param wg: A word graph.
+:type wg: WordGraph
+
+:returns: A boolean.
+:rtype: bool
+)pbdoc");
+
+    sp.def(
+        "__and__",
+        [](SimsPruner const& self, SimsPruner const& that) {
+          return combine_pruners(self, that, true);
+        },
+        py::is_operator());
+
+    sp.def(
+        "__or__",
+        [](SimsPruner const& self, SimsPruner const& that) {
+          return combine_pruners(self, that, false);
+        },
+        py::is_operator());
+
     ////////////////////////////////////////////////////////////////////////////
     // RepOrc
     ////////////////////////////////////////////////////////////////////////////
@@ -1422,6 +2134,7 @@ are seeking.
     // return_value_policy required here.
     ro.def("word_graph",
            &RepOrc::word_graph,
+           py::call_guard<py::gil_scoped_release>(),
            R"pbdoc(
 Get the word graph.
 
@@ -1472,6 +2185,7 @@ returned (with ``0`` nodes and ``0`` edges).
     // return_value_policy required here.
     mro.def("word_graph",
             &MinimalRepOrc::word_graph,
+            py::call_guard<py::gil_scoped_release>(),
             R"pbdoc(
 Get the word graph.
 
@@ -1563,6 +2277,150 @@ on the classes of a congruence.
     // Helper functions
     ////////////////////////////////////////////////////////////////////////////
 
+    m.def("sims_max_nodes_pruner",
+          &max_nodes_pruner,
+          py::arg("n"),
+          R"pbdoc(
+:sig=(n: int) -> SimsPruner:
+
+Returns a pruner rejecting word graphs with more than *n* nodes.
+
+This function returns a :any:`SimsPruner` that rejects a word graph if more
+than *n* of its nodes are reachable from ``0``.
+
+:param n: the maximum number of nodes.
+:type n: int
+
+:returns: A pruner.
+:rtype: SimsPruner
+)pbdoc");
+
+    m.def("sims_contains_pair_pruner",
+          &contains_pair_pruner,
+          py::arg("u"),
+          py::arg("v"),
+          R"pbdoc(
+:sig=(u: list[int], v: list[int]) -> SimsPruner:
+
+Returns a pruner rejecting word graphs whose congruence cannot contain a pair.
+
+This function returns a :any:`SimsPruner` that rejects a word graph if the
+paths labelled by *u* and *v* from ``0`` are both defined but end at
+different nodes. Hence every congruence found when using this pruner contains
+the pair ``(u, v)``.
+
+:param u: the first word.
+:type u: list[int]
+
+:param v: the second word.
+:type v: list[int]
+
+:returns: A pruner.
+:rtype: SimsPruner
+
+.. seealso:: :py:meth:`~Sims1.add_included_pair`
+)pbdoc");
+
+    m.def(
+        "sims_number_of_components_pruner",
+        &number_of_components_pruner,
+        py::arg("min"),
+        py::arg("max"),
+        R"pbdoc(
+:sig=(min: int, max: int) -> SimsPruner:
+
+Returns a pruner bounding the number of strongly connected components.
+
+This function returns a :any:`SimsPruner` that rejects a complete word graph if
+the number of strongly connected components of the subgraph induced by the
+nodes reachable from ``0`` does not belong to the range ``[min, max]``, and
+accepts every word graph that is not complete. If the presentation does not
+contain the empty word, then node ``0`` of every word graph found forms a
+strongly connected component on its own.
+
+:param min: the minimum number of components.
+:type min: int
+
+:param max: the maximum number of components.
+:type max: int
+
+:returns: A pruner.
+:rtype: SimsPruner
+
+:raises LibsemigroupsError: if *min* is greater than *max*.
+)pbdoc");
+
+    m.def(
+        "sims_transitive_pruner",
+        []() {
+          auto result        = number_of_components_pruner(1, 1);
+          result.description = "transitive_pruner()";
+          return result;
+        },
+        R"pbdoc(
+:sig=() -> SimsPruner:
+
+Returns a pruner rejecting word graphs that are not strongly connected.
+
+This function returns a :any:`SimsPruner` that rejects a complete word graph if
+the subgraph induced by the nodes reachable from ``0`` is not strongly
+connected, i.e. if the action it defines is not transitive, and accepts every
+word graph that is not complete. This is the same as
+``number_of_components_pruner(1, 1)``, and is only useful for monoid
+presentations.
+
+:returns: A pruner.
+:rtype: SimsPruner
+)pbdoc");
+
+    m.def(
+        "sims_refiner_pruner",
+        [](SimsRefinerIdeals const& refiner) {
+          return refiner_pruner(refiner, "SimsRefinerIdeals");
+        },
+        py::arg("refiner"),
+        R"pbdoc(
+:sig=(refiner: SimsRefinerIdeals | SimsRefinerFaithful) -> SimsPruner:
+:only-document-once:
+
+Returns a pruner calling a refiner.
+
+This function returns a :any:`SimsPruner` that accepts a word graph if and only
+if (a copy of) *refiner* does, so that, for example, the congruences arising
+from ideals can be found using ``refiner_pruner(SimsRefinerIdeals(p))`` combined
+with other instances of :any:`SimsPruner`.
+
+:param refiner: the refiner.
+:type refiner: SimsRefinerIdeals | SimsRefinerFaithful
+
+:returns: A pruner.
+:rtype: SimsPruner
+)pbdoc");
+
+    m.def(
+        "sims_refiner_pruner",
+        [](SimsRefinerFaithful const& refiner) {
+          return refiner_pruner(refiner, "SimsRefinerFaithful");
+        },
+        py::arg("refiner"),
+        R"pbdoc(
+:sig=(refiner: SimsRefinerIdeals | SimsRefinerFaithful) -> SimsPruner:
+:only-document-once:
+
+Returns a pruner calling a refiner.
+
+This function returns a :any:`SimsPruner` that accepts a word graph if and only
+if (a copy of) *refiner* does, so that, for example, the congruences arising
+from ideals can be found using ``refiner_pruner(SimsRefinerIdeals(p))`` combined
+with other instances of :any:`SimsPruner`.
+
+:param refiner: the refiner.
+:type refiner: SimsRefinerIdeals | SimsRefinerFaithful
+
+:returns: A pruner.
+:rtype: SimsPruner
+)pbdoc");
+
     m.def(
         "sims_right_generating_pairs",
         [](Presentation<word_type> const& p, word_graph_type const& wg) {
@@ -1868,6 +2726,110 @@ computing the two-sided congruence lattice of the semigroup or monoid.
 
 :returns: A boolean matrix defining the congruence poset.
 :rtype: Matrix
+)pbdoc");
+
+    m.def("sims_congruence_lattice",
+          &sims_congruence_lattice<Sims1>,
+          py::arg("sims"),
+          py::arg("n"),
+          py::arg("number_of_threads") = 1,
+          R"pbdoc(
+:sig=(sims: Sims1, n: int, number_of_threads: int = 1) -> tuple[list[WordGraph], numpy.ndarray]:
+
+Compute the right congruences with at most *n* classes and their covering
+relation.
+
+This function returns a tuple ``(graphs, covers)`` where ``graphs`` is a list
+of the word graphs returned by :any:`Sims1.iterator` with input *n* (with every
+node that has no defined targets removed), and ``covers`` is an array of ``uint32``
+with shape ``(k, 2)`` containing the pairs ``(i, j)``, in lexicographic order,
+such that the congruence defined by ``graphs[i]`` is covered by the one defined
+by ``graphs[j]``. In other words, ``covers`` contains the edges of the Hasse
+diagram of the poset returned by :any:`poset`, which is the right congruence
+lattice of the semigroup or monoid if *n* is large enough.
+
+If :py:meth:`~Sims1.number_of_threads` of *sims* is ``1``, then ``graphs`` is in
+the same order as :any:`Sims1.iterator`. Otherwise, the congruences are found
+by several threads, and the order of ``graphs`` (and hence the indices in
+``covers``) may differ from run to run, although the lattice that they
+describe does not.
+
+The congruences are enumerated, and the covering relation is computed using
+*number_of_threads* threads, without holding the GIL or creating a Python
+object for any intermediate congruence. For each congruence, only the
+congruences with fewer classes are checked for containment, and each of these
+is checked against the covers found so far, in decreasing order of the number
+of classes.
+
+:param sims: A :any:`Sims1` object.
+:type sims: Sims1
+
+:param n: Maximum number of congruence classes.
+:type n: int
+
+:param number_of_threads: the number of threads to use (default: ``1``).
+:type number_of_threads: int
+
+:returns: The congruences and their covering relation.
+:rtype: tuple[list[WordGraph], numpy.ndarray]
+
+:raises LibsemigroupsError: if *n* is ``0``.
+
+:raises LibsemigroupsError:
+    if :py:meth:`~Sims1.presentation()` has 0-generators and 0-relations (i.e.
+    it has not been initialised).
+)pbdoc");
+
+    m.def("sims_congruence_lattice",
+          &sims_congruence_lattice<Sims2>,
+          py::arg("sims"),
+          py::arg("n"),
+          py::arg("number_of_threads") = 1,
+          R"pbdoc(
+:sig=(sims: Sims2, n: int, number_of_threads: int = 1) -> tuple[list[WordGraph], numpy.ndarray]:
+
+Compute the two-sided congruences with at most *n* classes and their covering
+relation.
+
+This function returns a tuple ``(graphs, covers)`` where ``graphs`` is a list
+of the word graphs returned by :any:`Sims2.iterator` with input *n* (with every
+node that has no defined targets removed), and ``covers`` is an array of ``uint32``
+with shape ``(k, 2)`` containing the pairs ``(i, j)``, in lexicographic order,
+such that the congruence defined by ``graphs[i]`` is covered by the one defined
+by ``graphs[j]``. In other words, ``covers`` contains the edges of the Hasse
+diagram of the poset returned by :any:`poset`, which is the two-sided congruence
+lattice of the semigroup or monoid if *n* is large enough.
+
+If :py:meth:`~Sims2.number_of_threads` of *sims* is ``1``, then ``graphs`` is in
+the same order as :any:`Sims2.iterator`. Otherwise, the congruences are found
+by several threads, and the order of ``graphs`` (and hence the indices in
+``covers``) may differ from run to run, although the lattice that they
+describe does not.
+
+The congruences are enumerated, and the covering relation is computed using
+*number_of_threads* threads, without holding the GIL or creating a Python
+object for any intermediate congruence. For each congruence, only the
+congruences with fewer classes are checked for containment, and each of these
+is checked against the covers found so far, in decreasing order of the number
+of classes.
+
+:param sims: A :any:`Sims2` object.
+:type sims: Sims2
+
+:param n: Maximum number of congruence classes.
+:type n: int
+
+:param number_of_threads: the number of threads to use (default: ``1``).
+:type number_of_threads: int
+
+:returns: The congruences and their covering relation.
+:rtype: tuple[list[WordGraph], numpy.ndarray]
+
+:raises LibsemigroupsError: if *n* is ``0``.
+
+:raises LibsemigroupsError:
+    if :py:meth:`~Sims2.presentation()` has 0-generators and 0-relations (i.e.
+    it has not been initialised).
 )pbdoc");
   }  // init_sims
 
@@ -16,22 +16,83 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
+// C++ stl headers....
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint32_t, uint64_t
+#include <type_traits>  // for decay_t
+
 // libsemigroups headers
 #include <libsemigroups/constants.hpp>  // for POSITIVE_INFINITY
+#include <libsemigroups/exception.hpp>  // for LIBSEMIGROUPS_EXCEPTION
 #include <libsemigroups/stephen.hpp>    // for Stephen
 #include <libsemigroups/types.hpp>      // for word_type
 
 // pybind11....
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_stephen
+#include "main.hpp"          // for init_stephen
+#include "packed-words.hpp"  // for packed_letters, packed_offsets
+#include "threads.hpp"       // for run_in_threads
 
 namespace libsemigroups {
   namespace py = pybind11;
 
   namespace {
+    // Must be called while holding the GIL. Checks the packed words (letters,
+    // offsets), runs s, and then follows the path with source 0 labelled by
+    // each of the words in s.word_graph(), without holding the GIL. The i-th
+    // entry of the returned array is pred(target), where pred = make_pred(s)
+    // is made after s has run, and target is the last node of the i-th path,
+    // or UNDEFINED if there is no such path.
+    template <typename Stephen_, typename MakePred>
+    py::array_t<bool> stephen_follow_paths(Stephen_&             s,
+                                           packed_letters const& letters,
+                                           packed_offsets const& offsets,
+                                           size_t number_of_threads,
+                                           MakePred&& make_pred) {
+      // The words are checked before running s, which may not terminate.
+      size_t const n = throw_if_bad_packed_words(letters, offsets);
+      s.run();
+      auto const  pred = make_pred(s);
+      auto const& wg   = s.word_graph();
+      using node_type = typename std::decay_t<decltype(wg)>::node_type;
+
+      uint32_t const* l = letters.data();
+      uint64_t const* o = offsets.data();
+      for (size_t j = 0; j < static_cast<size_t>(letters.size()); ++j) {
+        if (l[j] >= wg.out_degree()) {
+          LIBSEMIGROUPS_EXCEPTION("letter index out of bounds, expected a "
+                                  "value in the range [0, {}), found {} in "
+                                  "position {}",
+                                  wg.out_degree(),
+                                  l[j],
+                                  j);
+        }
+      }
+
+      py::array_t<bool> result(n);
+      bool*             out = result.mutable_data();
+      {
+        py::gil_scoped_release release;
+        run_in_threads(n, number_of_threads, [&](size_t first, size_t last) {
+          for (size_t i = first; i < last; ++i) {
+            node_type node = 0;
+            for (uint64_t j = o[i]; j < o[i + 1]; ++j) {
+              node = wg.target_no_checks(node, l[j]);
+              if (node == static_cast<node_type>(UNDEFINED)) {
+                break;
+              }
+            }
+            out[i] = pred(node);
+          }
+        });
+      }
+      return result;
+    }
+
     template <typename PresentationType>
     void bind_stephen(py::module& m, std::string const& name) {
       using Stephen_ = Stephen<PresentationType>;
@@ -186,6 +247,12 @@ modifies the current :any:`Stephen` instance in-place. The result is a
 underlying word graphs instead of having to recompute them completely from
 scratch.
 
+For example, when checking many words with long common prefixes (such as
+words in short-lex order), a :any:`Stephen` instance for each common prefix
+can be run once, and then copied, and each copy multiplied by a
+:any:`Stephen` instance for one of the remaining suffixes. This is what
+:any:`stephen.PrefixCache` does.
+
 :param other: the Stephen instance to append.
 :type other: Stephen
 
@@ -323,6 +390,71 @@ word *w* is accepted if and only if :math:`uu^{-1}w` is equivalent to
   if no presentation was set at the construction of *s* or with
   :any:`Stephen.init` or if no word was set with :any:`Stephen.set_word`.
 
+.. warning::
+    Termination of the Stephen algorithm is undecidable in general, and
+    this function may never terminate.
+)pbdoc");
+
+      m.def(
+          "stephen_accepts_batch",
+          [](Stephen_&             s,
+             packed_letters const& letters,
+             packed_offsets const& offsets,
+             size_t                number_of_threads) {
+            return stephen_follow_paths(
+                s, letters, offsets, number_of_threads, [](Stephen_& t) {
+                  return [accept = t.accept_state()](auto node) {
+                    return node == accept;
+                  };
+                });
+          },
+          py::arg("s"),
+          py::arg("letters"),
+          py::arg("offsets"),
+          py::arg("number_of_threads") = 1,
+          R"pbdoc(
+:sig=(s: Stephen, letters: numpy.ndarray, offsets: numpy.ndarray, number_of_threads: int = 1) -> numpy.ndarray:
+:only-document-once:
+
+Check if each of a batch of words is accepted by a :any:`Stephen` instance.
+
+This function triggers the algorithm implemented in this class (if it hasn't
+been triggered already), and then checks whether each of the words
+``letters[offsets[i]:offsets[i + 1]]`` is accepted by *s*, in the sense of
+:any:`stephen.accepts`. Such packed arrays of words are returned by, for
+example, :any:`random_words`. The paths labelled by the words are followed in
+:any:`Stephen.word_graph` without holding the GIL using *number_of_threads*
+threads.
+
+:param s: the Stephen instance.
+:type s: Stephen
+
+:param letters: the letters of the words.
+:type letters: numpy.ndarray
+
+:param offsets: the offsets of the words in *letters*.
+:type offsets: numpy.ndarray
+
+:param number_of_threads: the number of threads to use (default: ``1``).
+:type number_of_threads: int
+
+:returns:
+  An array of ``bool`` whose ``i``-th entry is ``True`` if the ``i``-th word
+  is accepted by *s*.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError:
+  if no presentation was set at the construction of *s* or with
+  :any:`Stephen.init` or if no word was set with :any:`Stephen.set_word`.
+
+:raises LibsemigroupsError:
+  if *letters* and *offsets* are not 1-dimensional, or *offsets* is not
+  non-decreasing from ``0`` to ``len(letters)``.
+
+:raises LibsemigroupsError:
+  if any value in *letters* is not a letter of the alphabet of
+  :any:`Stephen.presentation`.
+
 .. warning::
     Termination of the Stephen algorithm is undecidable in general, and
     this function may never terminate.
@@ -374,6 +506,70 @@ it labels a path in :any:`Stephen.word_graph` with source ``0``.
   :any:`Stephen.init` or if no word was set with
   :any:`Stephen.set_word`.
 
+.. warning::
+    Termination of the Stephen algorithm is undecidable in general, and
+    this function may never terminate.
+)pbdoc");
+
+      m.def(
+          "stephen_is_left_factor_batch",
+          [](Stephen_&             s,
+             packed_letters const& letters,
+             packed_offsets const& offsets,
+             size_t                number_of_threads) {
+            return stephen_follow_paths(
+                s, letters, offsets, number_of_threads, [](Stephen_&) {
+                  return [](auto node) {
+                    return node != static_cast<decltype(node)>(UNDEFINED);
+                  };
+                });
+          },
+          py::arg("s"),
+          py::arg("letters"),
+          py::arg("offsets"),
+          py::arg("number_of_threads") = 1,
+          R"pbdoc(
+:sig=(s: Stephen, letters: numpy.ndarray, offsets: numpy.ndarray, number_of_threads: int = 1) -> numpy.ndarray:
+:only-document-once:
+
+Check if each of a batch of words is a left factor of :any:`Stephen.word`.
+
+This function triggers the algorithm implemented in this class (if it hasn't
+been triggered already), and then checks whether each of the words
+``letters[offsets[i]:offsets[i + 1]]`` is a left factor of
+:any:`Stephen.word`, in the sense of :any:`stephen.is_left_factor`. The paths
+labelled by the words are followed in :any:`Stephen.word_graph` without
+holding the GIL using *number_of_threads* threads.
+
+:param s: the Stephen instance.
+:type s: Stephen
+
+:param letters: the letters of the words.
+:type letters: numpy.ndarray
+
+:param offsets: the offsets of the words in *letters*.
+:type offsets: numpy.ndarray
+
+:param number_of_threads: the number of threads to use (default: ``1``).
+:type number_of_threads: int
+
+:returns:
+  An array of ``bool`` whose ``i``-th entry is ``True`` if the ``i``-th word
+  is a left factor of :any:`Stephen.word`.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError:
+  if no presentation was set at the construction of *s* or with
+  :any:`Stephen.init` or if no word was set with :any:`Stephen.set_word`.
+
+:raises LibsemigroupsError:
+  if *letters* and *offsets* are not 1-dimensional, or *offsets* is not
+  non-decreasing from ``0`` to ``len(letters)``.
+
+:raises LibsemigroupsError:
+  if any value in *letters* is not a letter of the alphabet of
+  :any:`Stephen.presentation`.
+
 .. warning::
     Termination of the Stephen algorithm is undecidable in general, and
     this function may never terminate.
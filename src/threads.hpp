@@ -0,0 +1,81 @@
+//
+// libsemigroups_pybind11 - python bindings for the C++ library libsemigroups
+// Copyright (C) 2024 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRC_THREADS_HPP_
+#define SRC_THREADS_HPP_
+
+#include <algorithm>  // for min
+#include <cstddef>    // for size_t
+#include <exception>  // for exception_ptr, current_exception, rethrow_...
+#include <mutex>      // for mutex, lock_guard
+#include <thread>     // for thread
+#include <vector>     // for vector
+
+namespace libsemigroups {
+
+  // Calls f(thread_id, first, last) for a partition of [0, n) into at most
+  // number_of_threads intervals, each in its own thread, where thread_id is
+  // the index of the interval, i.e. thread_id < number_of_threads. If any call
+  // to f throws, then the first exception thrown is rethrown once every thread
+  // has been joined. Must not be called while holding the GIL if f uses any
+  // Python objects.
+  template <typename Func>
+  void run_in_threads_with_id(size_t n, size_t number_of_threads, Func&& f) {
+    number_of_threads = std::min(number_of_threads, n);
+    if (number_of_threads <= 1) {
+      f(0, 0, n);
+      return;
+    }
+    size_t const chunk = (n + number_of_threads - 1) / number_of_threads;
+    std::exception_ptr       error;
+    std::mutex               mtx;
+    std::vector<std::thread> threads;
+    for (size_t first = 0; first < n; first += chunk) {
+      size_t const last      = std::min(first + chunk, n);
+      size_t const thread_id = threads.size();
+      threads.emplace_back([&f, &error, &mtx, thread_id, first, last]() {
+        try {
+          f(thread_id, first, last);
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(mtx);
+          if (!error) {
+            error = std::current_exception();
+          }
+        }
+      });
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+  // Calls f(first, last) for a partition of [0, n) into at most
+  // number_of_threads intervals, as in run_in_threads_with_id.
+  template <typename Func>
+  void run_in_threads(size_t n, size_t number_of_threads, Func&& f) {
+    run_in_threads_with_id(
+        n, number_of_threads, [&f](size_t, size_t first, size_t last) {
+          f(first, last);
+        });
+  }
+}  // namespace libsemigroups
+
+#endif  // SRC_THREADS_HPP_
@@ -17,8 +17,10 @@
 //
 
 // C++ std headers
-#include <functional>  // for function
-#include <string>      // for string, basic_string, oper...
+#include <functional>   // for function
+#include <string>       // for string, basic_string, oper...
+#include <type_traits>  // for is_same_v
+#include <utility>      // for move
 
 #include <libsemigroups/froidure-pin-base.hpp>   // for FroidurePinBase
 #include <libsemigroups/knuth-bendix-class.hpp>  // for KnuthBendix
@@ -42,6 +44,28 @@ namespace libsemigroups {
       });
     }
 
+    // When the words in the input and output have the same type, the rules
+    // and alphabet of p are moved into the result rather than copied.
+    // Otherwise the result has to be built word by word, but p is still
+    // cleared so that its memory is released as soon as possible.
+    template <typename InputWord, typename OutputWord>
+    void bind_pres_to_pres_consume(py::module& m, std::string const& name) {
+      std::string fn_name
+          = std::string("to_presentation_") + name + "_consume";
+      m.def(fn_name.c_str(), [](Presentation<InputWord>& p) {
+        if constexpr (std::is_same_v<InputWord, OutputWord>) {
+          p.throw_if_bad_alphabet_or_rules();
+          Presentation<OutputWord> result(std::move(p));
+          p.init();
+          return result;
+        } else {
+          auto result = to<Presentation<OutputWord>>(p);
+          p.init();
+          return result;
+        }
+      });
+    }
+
     template <typename InputWord, typename OutputWord>
     void bind_pres_func_to_pres(py::module& m, std::string const& name) {
       std::string fn_name = std::string("to_presentation_") + name;
@@ -114,6 +138,12 @@ namespace libsemigroups {
     bind_pres_to_pres<word_type, std::string>(m, "string");
     bind_pres_to_pres<std::string, std::string>(m, "string");
 
+    // From Presentation, consuming the argument
+    bind_pres_to_pres_consume<std::string, word_type>(m, "word");
+    bind_pres_to_pres_consume<word_type, word_type>(m, "word");
+    bind_pres_to_pres_consume<word_type, std::string>(m, "string");
+    bind_pres_to_pres_consume<std::string, std::string>(m, "string");
+
     // From Presentation + function
     bind_pres_func_to_pres<std::string, word_type>(m, "word");
     bind_pres_func_to_pres<word_type, word_type>(m, "word");
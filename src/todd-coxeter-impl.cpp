@@ -18,9 +18,13 @@
 
 // TODO(0.5): remove the doc that isn't actually used
 
-// libsemigroups headers
-#include <chrono>
+// C++ stl headers....
+#include <algorithm>  // for min
+#include <chrono>     // for nanoseconds
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint32_t
 
+// libsemigroups headers
 #include <libsemigroups/todd-coxeter.hpp>
 
 #include <libsemigroups/detail/cong-common-class.hpp>
@@ -1292,6 +1296,7 @@ standardized with respect to the order *val* ; and ``False`` if not.
     thing.def("spanning_tree",
               &ToddCoxeterImpl_::spanning_tree,
               py::return_value_policy::reference_internal,
+              py::call_guard<py::gil_scoped_release>(),
               R"pbdoc(
 :sig=(self: ToddCoxeter) -> Forest:
 
@@ -1367,6 +1372,7 @@ The return value of this function indicates the following:
           return self.word_graph();
         },
         py::return_value_policy::reference_internal,
+        py::call_guard<py::gil_scoped_release>(),
         R"pbdoc(
 :sig=(self: ToddCoxeter) -> WordGraph:
 
@@ -1403,6 +1409,7 @@ returned by this function may not be compatible with the relations of
     thing.def("perform_lookahead",
               &ToddCoxeterImpl_::perform_lookahead,
               py::arg("stop_early"),
+              py::call_guard<py::gil_scoped_release>(),
               R"pbdoc(
 :sig=(self: ToddCoxeter, stop_early: bool) -> None:
 
@@ -1415,7 +1422,8 @@ extent of this lookahead are controlled by the settings
 ``True``, then the settings :any:`lookahead_stop_early_interval` and
 :any:`lookahead_stop_early_ratio` are used to determine whether or not the
 lookahead should be aborted early. If *stop_early* is ``False``, then these
-settings are ignored.
+settings are ignored. The global interpreter lock is released while the
+lookahead is performed.
 
 :param stop_early:
     whether or not to consider stopping the lookahead early if
@@ -1425,6 +1433,7 @@ settings are ignored.
 
     thing.def("shrink_to_fit",
               &ToddCoxeterImpl_::shrink_to_fit,
+              py::call_guard<py::gil_scoped_release>(),
               R"pbdoc(
 :sig=(self: ToddCoxeter) -> None:
 
@@ -1437,6 +1446,7 @@ then this function does nothing.
     thing.def("standardize",
               &ToddCoxeterImpl_::standardize,
               py::arg("val"),
+              py::call_guard<py::gil_scoped_release>(),
               R"pbdoc(
 :sig=(self: ToddCoxeter, val: Order) -> bool:
 
@@ -1614,6 +1624,73 @@ collapse can be specified using :any:`large_collapse`.
    >>> tc.number_of_large_collapses()
    0
 )pbdoc");
+
+    thing.def(
+        "memory_usage",
+        [](ToddCoxeterImpl_ const& self) {
+          using node_type = uint32_t;
+          auto const&  wg = self.current_word_graph();
+          size_t const n  = wg.number_of_nodes();
+          size_t const a  = std::min(
+              static_cast<size_t>(self.number_of_nodes_active()), n);
+          // Every node stores its targets, and the first source and next
+          // source for every label (so that the sources of a node can be
+          // found when nodes are identified), and the node manager stores
+          // the next and previous nodes, and the representative of every node.
+          size_t const per_node = (3 * wg.out_degree() + 3) * sizeof(node_type);
+          py::dict     result;
+          result["active_nodes"]   = a * per_node;
+          result["inactive_nodes"] = (n - a) * per_node;
+          result["total"]          = n * per_node;
+          return result;
+        },
+        R"pbdoc(
+:sig=(self: ToddCoxeter) -> dict[str, int]:
+
+Returns an estimate of the memory used by the current word graph.
+
+This function returns a dictionary containing an estimate of the number of
+bytes used to store the nodes of :any:`current_word_graph`. The key
+``"active_nodes"`` is the number of bytes used by the active nodes, i.e. the
+nodes counted by :any:`number_of_nodes_active`, the key ``"inactive_nodes"``
+is the number of bytes used by the inactive (dead or free) nodes, which are
+retained so that they can be recycled, and the key ``"total"`` is the sum of
+these.
+
+The number of nodes of :any:`current_word_graph` never decreases during an
+enumeration, and so the value of ``"total"`` is also the peak memory used to
+store the nodes since the :any:`ToddCoxeter` instance was constructed or last
+compacted by :any:`shrink_to_fit`. The inactive nodes are only released by
+:any:`shrink_to_fit`.
+
+Nodes are stored using 32-bit integers, and this function does not include
+any memory used to store the presentation, or the definitions and
+coincidences that are waiting to be processed.
+
+:returns: The estimated number of bytes used.
+:rtype: dict[str, int]
+
+.. doctest:: Python
+
+   >>> from libsemigroups_pybind11 import (Presentation, presentation, ToddCoxeter,
+   ... congruence_kind)
+   >>> p = Presentation("bcd")
+   >>> p.contains_empty_word(True)
+   <monoid presentation with 3 letters, 0 rules, and length 0>
+   >>> presentation.add_rule(p, "bb", "")
+   >>> presentation.add_rule(p, "cd", "")
+   >>> presentation.add_rule(p, "ccc", "")
+   >>> presentation.add_rule(p, "bcbcbc", "")
+   >>> presentation.add_rule(p, "bcbdbcbd", "")
+   >>> tc = ToddCoxeter(congruence_kind.twosided, p)
+   >>> tc.number_of_classes()
+   12
+   >>> tc.shrink_to_fit()
+   >>> tc.memory_usage()["total"] == 12 * (3 * 3 + 3) * 4
+   True
+   >>> tc.memory_usage()["inactive_nodes"]
+   0
+)pbdoc");
   }  // init_todd_coxeter
 
 }  // namespace libsemigroups
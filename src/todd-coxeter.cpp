@@ -16,9 +16,16 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
+// C++ headers
+#include <chrono>   // for nanoseconds
+#include <cstdint>  // for int64_t
+#include <vector>   // for vector
+
 // libsemigroups headers
+#include <libsemigroups/exception.hpp>  // for LIBSEMIGROUPS_EXCEPTION
 #include <libsemigroups/to-presentation.hpp>
 #include <libsemigroups/todd-coxeter.hpp>
+#include <libsemigroups/word-graph.hpp>  // for WordGraph
 
 // pybind11....
 #include <pybind11/chrono.h>
@@ -34,6 +41,60 @@ namespace libsemigroups {
   using std::literals::operator""sv;
 
   namespace {
+    // Helpers for pickling. The state of a congruence enumeration (i.e. the
+    // current word graph) cannot be restored using the public API of
+    // ToddCoxeter, and so only the definition of the congruence and the values
+    // of the settings are pickled. If the congruence was defined by a word
+    // graph, then that word graph is part of its definition, and it is
+    // pickled too. Enums are stored as their underlying ints.
+
+    py::tuple settings_state(detail::ToddCoxeterImpl const& tc) {
+      return py::make_tuple(tc.def_max(),
+                            static_cast<int>(tc.def_policy()),
+                            static_cast<int>(tc.def_version()),
+                            tc.f_defs(),
+                            tc.hlt_defs(),
+                            tc.large_collapse(),
+                            static_cast<int>(tc.lookahead_extent()),
+                            tc.lookahead_growth_factor(),
+                            tc.lookahead_growth_threshold(),
+                            tc.lookahead_min(),
+                            tc.lookahead_next(),
+                            tc.lookahead_stop_early_interval().count(),
+                            tc.lookahead_stop_early_ratio(),
+                            static_cast<int>(tc.lookahead_style()),
+                            tc.lower_bound(),
+                            tc.save(),
+                            static_cast<int>(tc.strategy()),
+                            tc.use_relations_in_extra());
+    }
+
+    void set_settings_state(detail::ToddCoxeterImpl& tc,
+                            py::tuple const&         state) {
+      using options = detail::ToddCoxeterImpl::options;
+      tc.def_max(state[0].cast<size_t>())
+          .def_policy(static_cast<options::def_policy>(state[1].cast<int>()))
+          .def_version(static_cast<options::def_version>(state[2].cast<int>()))
+          .f_defs(state[3].cast<size_t>())
+          .hlt_defs(state[4].cast<size_t>())
+          .large_collapse(state[5].cast<size_t>())
+          .lookahead_extent(
+              static_cast<options::lookahead_extent>(state[6].cast<int>()))
+          .lookahead_growth_factor(state[7].cast<float>())
+          .lookahead_growth_threshold(state[8].cast<size_t>())
+          .lookahead_min(state[9].cast<size_t>())
+          .lookahead_next(state[10].cast<size_t>())
+          .lookahead_stop_early_interval(
+              std::chrono::nanoseconds(state[11].cast<int64_t>()))
+          .lookahead_stop_early_ratio(state[12].cast<float>())
+          .lookahead_style(
+              static_cast<options::lookahead_style>(state[13].cast<int>()))
+          .lower_bound(state[14].cast<size_t>())
+          .save(state[15].cast<bool>())
+          .strategy(static_cast<options::strategy>(state[16].cast<int>()))
+          .use_relations_in_extra(state[17].cast<bool>());
+    }
+
     template <typename Word>
     void bind_todd_coxeter(py::module& m, std::string const& name) {
       using ToddCoxeter_ = ToddCoxeter<Word>;
@@ -134,6 +195,61 @@ If the :any:`ToddCoxeter` instance is not :any:`Runner.finished`,
 then it might be that equivalent input words produce different output
 words. This function triggers no congruence enumeration.)pbdoc"sv});
       def_reduce(thing, "ToddCoxeter");
+      def_reduce_batch(thing, "ToddCoxeter");
+      def_contains_batch(thing, "ToddCoxeter");
+
+      thing.def(py::pickle(
+          [](ToddCoxeter_ const& self) {
+            if (self.started() && !self.finished()) {
+              LIBSEMIGROUPS_EXCEPTION(
+                  "cannot pickle a ToddCoxeter instance whose congruence "
+                  "enumeration has started but not finished");
+            }
+            // If self was constructed from another ToddCoxeter, then the
+            // generating pairs of that instance are included in the internal
+            // presentation or generating pairs of self, but not in the ones
+            // that are pickled.
+            if (self.internal_presentation().rules.size()
+                    != self.presentation().rules.size()
+                || self.internal_generating_pairs().size()
+                       != self.generating_pairs().size()) {
+              LIBSEMIGROUPS_EXCEPTION(
+                  "cannot pickle a ToddCoxeter instance constructed from "
+                  "another ToddCoxeter instance");
+            }
+            // If self was constructed from a word graph, then the presentation
+            // is empty, but the word graph is not.
+            py::object wg = py::none();
+            if (self.presentation().alphabet().size()
+                != self.current_word_graph().out_degree()) {
+              if (self.started()) {
+                LIBSEMIGROUPS_EXCEPTION(
+                    "cannot pickle a ToddCoxeter instance constructed from a "
+                    "WordGraph once its congruence enumeration has started");
+              }
+              wg = py::cast(self.current_word_graph());
+            }
+            return py::make_tuple(static_cast<int>(self.kind()),
+                                  self.presentation(),
+                                  self.generating_pairs(),
+                                  settings_state(self),
+                                  wg);
+          },
+          [](py::tuple const& state) {
+            auto const knd
+                = static_cast<congruence_kind>(state[0].cast<int>());
+            ToddCoxeter_ result
+                = state[4].is_none()
+                      ? ToddCoxeter_(knd, state[1].cast<Presentation<Word>>())
+                      : ToddCoxeter_(knd, state[4].cast<WordGraph<uint32_t>>());
+            auto pairs = state[2].cast<std::vector<Word>>();
+            for (size_t i = 0; i + 1 < pairs.size(); i += 2) {
+              congruence_common::add_generating_pair(
+                  result, pairs[i], pairs[i + 1]);
+            }
+            set_settings_state(result, state[3].cast<py::tuple>());
+            return result;
+          }));
 
       ////////////////////////////////////////////////////////////////////////
 
@@ -407,6 +523,16 @@ enumeration of ``tc``.)pbdoc",
                                               .raises             = raises,
                                               .var                = "tc"});
 
+      def_normal_forms_batches<ToddCoxeter<Word>>(
+          m,
+          "ToddCoxeter",
+          "todd_coxeter",
+          doc{.detail             = R"pbdoc(
+This function triggers a full enumeration of ``tc``.)pbdoc",
+              .only_document_once = true,
+              .raises             = raises,
+              .var                = "tc"});
+
       ////////////////////////////////////////////////////////////////////////
       // Helper functions - specific to ToddCoxeter
       ////////////////////////////////////////////////////////////////////////
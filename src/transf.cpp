@@ -16,11 +16,20 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
+// C++ stl headers....
+#include <algorithm>  // for fill
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint8_t, uint16_t, uint32_t, uint64_t
+#include <limits>     // for numeric_limits
+#include <vector>     // for vector
+
 // libsemigroups headers
+#include <libsemigroups/exception.hpp>  // for LIBSEMIGROUPS_EXCEPTION
 #include <libsemigroups/ranges.hpp>
 #include <libsemigroups/transf.hpp>
 
 // pybind11....
+#include <pybind11/numpy.h>  // for array_t
 #include <pybind11/operators.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -718,6 +727,313 @@ fewer points requiring less space per point.
       m.def("transf_inverse",
             py::overload_cast<Perm_ const&>(&inverse<N, Scalar>));
     }  // bind_perm
+
+    ////////////////////////////////////////////////////////////////////////
+    // Batched functions
+    ////////////////////////////////////////////////////////////////////////
+
+    // A batch of k transformations, partial perms, or permutations of the
+    // same degree n is passed to and from Python as a numpy array with shape
+    // (k, n) and dtype uint8, uint16, or uint32, the i-th row being the list
+    // of images of the i-th element. If partial is true, then the maximum
+    // value of the dtype represents UNDEFINED. The dtype is not converted,
+    // so that the batch functions for Transf1, Transf2, and Transf4 (etc)
+    // are separate overloads.
+    template <typename Scalar>
+    using transf_batch = py::array_t<Scalar, py::array::c_style>;
+
+    template <typename Scalar>
+    size_t transf_batch_degree(transf_batch<Scalar> const& a, bool partial) {
+      if (a.ndim() != 2) {
+        LIBSEMIGROUPS_EXCEPTION("expected a 2-dimensional array of images, "
+                                "found a {}-dimensional array",
+                                a.ndim());
+      }
+      // If partial is true, then the maximum value is UNDEFINED, and so is
+      // not a point.
+      size_t const n   = a.shape(1);
+      size_t const max = static_cast<size_t>(std::numeric_limits<Scalar>::max())
+                         + (partial ? 0 : 1);
+      if (n > max) {
+        LIBSEMIGROUPS_EXCEPTION(
+            "expected the degree to be at most {} for this dtype, found {}",
+            max,
+            n);
+      }
+      return n;
+    }
+
+    // Must be called without the GIL, throws if any image in the array
+    // "in" of length k * n is not a point (or UNDEFINED if partial is true).
+    template <typename Scalar>
+    void throw_if_bad_batch_images(Scalar const* in,
+                                   size_t        k,
+                                   size_t        n,
+                                   bool          partial) {
+      constexpr Scalar undef = std::numeric_limits<Scalar>::max();
+      for (size_t i = 0; i < k * n; ++i) {
+        if (in[i] >= n && !(partial && in[i] == undef)) {
+          LIBSEMIGROUPS_EXCEPTION(
+              "image value out of bounds in row {}, expected value in "
+              "[0, {}){}, found {}",
+              i / n,
+              n,
+              partial ? " or UNDEFINED" : "",
+              uint64_t(in[i]));
+        }
+      }
+    }
+
+    template <typename Scalar>
+    void bind_transf_batch(py::module& m) {
+      using batch            = transf_batch<Scalar>;
+      constexpr Scalar undef = std::numeric_limits<Scalar>::max();
+
+      m.def(
+          "transf_product_batch",
+          [](batch const& a, batch const& b, bool partial) {
+            size_t const n = transf_batch_degree(a, partial);
+            if (b.ndim() != 2 || a.shape(0) != b.shape(0)
+                || a.shape(1) != b.shape(1)) {
+              LIBSEMIGROUPS_EXCEPTION(
+                  "expected the arguments to have the same shape, found "
+                  "arrays of sizes {} and {}",
+                  a.size(),
+                  b.size());
+            }
+            size_t const  k   = a.shape(0);
+            batch         result({a.shape(0), a.shape(1)});
+            Scalar const* x   = a.data();
+            Scalar const* y   = b.data();
+            Scalar*       out = result.mutable_data();
+            {
+              py::gil_scoped_release release;
+              throw_if_bad_batch_images(x, k, n, partial);
+              throw_if_bad_batch_images(y, k, n, partial);
+              for (size_t i = 0; i < k; ++i, x += n, y += n, out += n) {
+                for (size_t j = 0; j < n; ++j) {
+                  out[j] = (x[j] == undef && partial) ? undef : y[x[j]];
+                }
+              }
+            }
+            return result;
+          },
+          py::arg("a"),
+          py::arg("b"),
+          py::arg("partial") = false,
+          R"pbdoc(
+:sig=(a: numpy.ndarray, b: numpy.ndarray, partial: bool = False) -> numpy.ndarray:
+:only-document-once:
+
+Returns the products of two batches of transformations, partial perms, or
+permutations.
+
+The arrays *a* and *b* must have the same shape ``(k, n)`` and the same dtype
+``numpy.uint8``, ``numpy.uint16``, or ``numpy.uint32``, and the ``i``-th row
+of each array is the list of images of an element of degree ``n``. If
+*partial* is ``True``, then the maximum value of the dtype represents
+:any:`UNDEFINED`, as for partial perms. The products are computed without
+holding the GIL, and without constructing any :any:`Transf`, :any:`PPerm`, or
+:any:`Perm` objects.
+
+:param a: the left hand factors.
+:type a: numpy.ndarray
+
+:param b: the right hand factors.
+:type b: numpy.ndarray
+
+:param partial: whether or not the elements are partial (default: ``False``).
+:type partial: bool
+
+:returns:
+  An array of the same shape and dtype as *a* whose ``i``-th row is the list
+  of images of the product of the elements defined by ``a[i]`` and ``b[i]``.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError: if *a* and *b* do not have the same shape.
+
+:raises LibsemigroupsError:
+  if *a* or *b* contains a value that is greater than or equal to ``n``
+  (other than :any:`UNDEFINED` when *partial* is ``True``).
+
+.. doctest::
+
+   >>> import numpy as np
+   >>> from libsemigroups_pybind11 import transf
+   >>> from libsemigroups_pybind11.transf import Transf
+   >>> a = np.array([[0, 0, 2, 2, 0, 1]], dtype=np.uint8)
+   >>> transf.product_batch(a, a)
+   array([[0, 0, 2, 2, 0, 0]], dtype=uint8)
+   >>> Transf([0, 0, 2, 2, 0, 1]) ** 2
+   Transf([0, 0, 2, 2, 0, 0])
+)pbdoc");
+
+      m.def(
+          "transf_inverse_batch",
+          [](batch const& a, bool partial) {
+            size_t const  n   = transf_batch_degree(a, partial);
+            size_t const  k   = a.shape(0);
+            batch         result({a.shape(0), a.shape(1)});
+            Scalar const* x   = a.data();
+            Scalar*       out = result.mutable_data();
+            {
+              py::gil_scoped_release release;
+              throw_if_bad_batch_images(x, k, n, partial);
+              // seen[p] == i + 1 if p is in the image of the i-th element
+              std::vector<size_t> seen(n, 0);
+              for (size_t i = 0; i < k; ++i, x += n, out += n) {
+                std::fill(out, out + n, undef);
+                for (size_t j = 0; j < n; ++j) {
+                  if (x[j] == undef && partial) {
+                    continue;
+                  } else if (seen[x[j]] == i + 1) {
+                    LIBSEMIGROUPS_EXCEPTION(
+                        "the element in row {} is not injective, the "
+                        "points {} and {} have the same image {}",
+                        i,
+                        uint64_t(out[x[j]]),
+                        j,
+                        uint64_t(x[j]));
+                  }
+                  seen[x[j]] = i + 1;
+                  out[x[j]]  = j;
+                }
+              }
+            }
+            return result;
+          },
+          py::arg("a"),
+          py::arg("partial") = false,
+          R"pbdoc(
+:sig=(a: numpy.ndarray, partial: bool = False) -> numpy.ndarray:
+:only-document-once:
+
+Returns the inverses of a batch of partial perms or permutations.
+
+The array *a* of shape ``(k, n)`` has the same format as in
+:any:`product_batch`. If *partial* is ``False``, then each row of *a* must
+be a permutation, and otherwise each row must be a partial perm.
+
+:param a: the elements.
+:type a: numpy.ndarray
+
+:param partial: whether or not the elements are partial (default: ``False``).
+:type partial: bool
+
+:returns:
+  An array of the same shape and dtype as *a* whose ``i``-th row is the list
+  of images of the inverse of the element defined by ``a[i]``.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError:
+  if *a* contains a value that is greater than or equal to ``n`` (other than
+  :any:`UNDEFINED` when *partial* is ``True``).
+
+:raises LibsemigroupsError: if any row of *a* has repeated (defined) values.
+)pbdoc");
+
+      m.def(
+          "transf_rank_batch",
+          [](batch const& a, bool partial) {
+            size_t const          n      = transf_batch_degree(a, partial);
+            size_t const          k      = a.shape(0);
+            py::array_t<uint64_t> result(a.shape(0));
+            Scalar const*         x   = a.data();
+            uint64_t*             out = result.mutable_data();
+            {
+              py::gil_scoped_release release;
+              throw_if_bad_batch_images(x, k, n, partial);
+              std::vector<size_t> seen(n, 0);
+              for (size_t i = 0; i < k; ++i, x += n) {
+                out[i] = 0;
+                for (size_t j = 0; j < n; ++j) {
+                  if (!(x[j] == undef && partial) && seen[x[j]] != i + 1) {
+                    seen[x[j]] = i + 1;
+                    out[i]++;
+                  }
+                }
+              }
+            }
+            return result;
+          },
+          py::arg("a"),
+          py::arg("partial") = false,
+          R"pbdoc(
+:sig=(a: numpy.ndarray, partial: bool = False) -> numpy.ndarray:
+:only-document-once:
+
+Returns the ranks of a batch of transformations, partial perms, or
+permutations.
+
+The array *a* of shape ``(k, n)`` has the same format as in
+:any:`product_batch`.
+
+:param a: the elements.
+:type a: numpy.ndarray
+
+:param partial: whether or not the elements are partial (default: ``False``).
+:type partial: bool
+
+:returns:
+  An array of ``numpy.uint64`` of length ``k`` whose ``i``-th entry is the
+  number of distinct (defined) values in ``a[i]``.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError:
+  if *a* contains a value that is greater than or equal to ``n`` (other than
+  :any:`UNDEFINED` when *partial* is ``True``).
+)pbdoc");
+
+      m.def(
+          "transf_image_batch",
+          [](batch const& a, bool partial) {
+            size_t const      n   = transf_batch_degree(a, partial);
+            size_t const      k   = a.shape(0);
+            py::array_t<bool> result({a.shape(0), a.shape(1)});
+            Scalar const*     x   = a.data();
+            bool*             out = result.mutable_data();
+            {
+              py::gil_scoped_release release;
+              throw_if_bad_batch_images(x, k, n, partial);
+              std::fill(out, out + k * n, false);
+              for (size_t i = 0; i < k; ++i, x += n, out += n) {
+                for (size_t j = 0; j < n; ++j) {
+                  if (!(x[j] == undef && partial)) {
+                    out[x[j]] = true;
+                  }
+                }
+              }
+            }
+            return result;
+          },
+          py::arg("a"),
+          py::arg("partial") = false,
+          R"pbdoc(
+:sig=(a: numpy.ndarray, partial: bool = False) -> numpy.ndarray:
+:only-document-once:
+
+Returns the images of a batch of transformations, partial perms, or
+permutations.
+
+The array *a* of shape ``(k, n)`` has the same format as in
+:any:`product_batch`.
+
+:param a: the elements.
+:type a: numpy.ndarray
+
+:param partial: whether or not the elements are partial (default: ``False``).
+:type partial: bool
+
+:returns:
+  A boolean array of shape ``(k, n)`` whose ``(i, j)``-th entry is ``True``
+  if and only if ``j`` is in the image of the element defined by ``a[i]``.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError:
+  if *a* contains a value that is greater than or equal to ``n`` (other than
+  :any:`UNDEFINED` when *partial* is ``True``).
+)pbdoc");
+    }  // bind_transf_batch
   }    // namespace
 
   void init_transf(py::module& m) {
@@ -735,5 +1051,10 @@ fewer points requiring less space per point.
     bind_pperm<0, uint8_t>(m, "PPerm1");
     bind_pperm<0, uint16_t>(m, "PPerm2");
     bind_pperm<0, uint32_t>(m, "PPerm4");
+
+    // Batched functions
+    bind_transf_batch<uint8_t>(m);
+    bind_transf_batch<uint16_t>(m);
+    bind_transf_batch<uint32_t>(m);
   }
 }  // namespace libsemigroups
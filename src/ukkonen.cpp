@@ -17,21 +17,118 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
+// C++ stl headers....
+#include <cstddef>   // for size_t
+#include <cstdint>   // for uint32_t, uint64_t
+#include <iterator>  // for distance
+#include <limits>    // for numeric_limits
+#include <map>       // for map
+#include <string>    // for string
+#include <vector>    // for vector
+
 // libsemigroups headers
-#include <libsemigroups/types.hpp>  // for word_type
+#include <libsemigroups/exception.hpp>  // for LIBSEMIGROUPS_EXCEPTION
+#include <libsemigroups/types.hpp>      // for word_type
 #include <libsemigroups/ukkonen.hpp>
 
 // pybind11....
+#include <pybind11/numpy.h>
 #include <pybind11/operators.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_ukkonen
+#include "main.hpp"          // for init_ukkonen
+#include "packed-words.hpp"  // for packed_letters, packed_offsets
 
 namespace libsemigroups {
   namespace py = pybind11;
 
+  namespace {
+    // An estimate of the number of bytes used by a node of a std::map with
+    // the given value type, i.e. the value plus the parent, left, and right
+    // pointers and the colour of a red-black tree node.
+    template <typename Map>
+    constexpr size_t map_node_size() {
+      return sizeof(typename Map::value_type) + 4 * sizeof(void*);
+    }
+
+    // Returns an estimate of the number of bytes used by u to store its
+    // nodes, the children of its nodes, the underlying word (including the
+    // unique letters), and for each distinct word its multiplicity and the
+    // position where it begins.
+    py::dict ukkonen_memory_usage(Ukkonen const& u) {
+      using children_type   = decltype(Ukkonen::Node::children);
+      size_t const nodes    = u.nodes().capacity() * sizeof(Ukkonen::Node);
+      size_t       children = 0;
+      for (auto const& n : u.nodes()) {
+        children += n.children.size() * map_node_size<children_type>();
+      }
+      size_t const word
+          = std::distance(u.begin(), u.end()) * sizeof(letter_type);
+      size_t const words = 2 * u.number_of_distinct_words() * sizeof(size_t);
+
+      py::dict result;
+      result["nodes"]    = nodes;
+      result["children"] = children;
+      result["word"]     = word;
+      result["words"]    = words;
+      result["total"]    = sizeof(Ukkonen) + nodes + children + word + words;
+      return result;
+    }
+
+    py::dict ukkonen_compact_arrays(Ukkonen const& u) {
+      auto const& nodes = u.nodes();
+      size_t      m     = 0;
+      for (auto const& n : nodes) {
+        m += n.children.size();
+      }
+      if (std::distance(u.begin(), u.end())
+              >= std::numeric_limits<uint32_t>::max()
+          || nodes.size() >= std::numeric_limits<uint32_t>::max()) {
+        LIBSEMIGROUPS_EXCEPTION("the suffix tree is too large to be indexed "
+                                "by 32-bit integers, it has {} nodes",
+                                nodes.size());
+      }
+      py::array_t<uint32_t> l(nodes.size()), r(nodes.size()),
+          parent(nodes.size()), child_nodes(m);
+      py::array_t<uint64_t> child_offsets(nodes.size() + 1), child_letters(m);
+
+      auto* pl = l.mutable_data();
+      auto* pr = r.mutable_data();
+      auto* pp = parent.mutable_data();
+      auto* po = child_offsets.mutable_data();
+      auto* pc = child_letters.mutable_data();
+      auto* pn = child_nodes.mutable_data();
+
+      size_t k = 0;
+      po[0]    = 0;
+      for (size_t i = 0; i < nodes.size(); ++i) {
+        pl[i] = nodes[i].l;
+        pr[i] = nodes[i].r;
+        pp[i] = nodes[i].parent == static_cast<size_t>(UNDEFINED)
+                    ? std::numeric_limits<uint32_t>::max()
+                    : nodes[i].parent;
+        // std::map iterates in order of the letters, and so the children of
+        // every node are sorted.
+        for (auto const& [letter, child] : nodes[i].children) {
+          pc[k] = letter;
+          pn[k] = child;
+          ++k;
+        }
+        po[i + 1] = k;
+      }
+      py::dict result;
+      result["l"]             = l;
+      result["r"]             = r;
+      result["parent"]        = parent;
+      result["child_offsets"] = child_offsets;
+      result["child_letters"] = child_letters;
+      result["child_nodes"]   = child_nodes;
+      return result;
+    }
+  }  // namespace
+
   template <typename Word>
   void bind_ukkonen_extras(py::module& m, py::class_<Ukkonen>& thing) {
     ////////////////////////////////////////////////////////////////////////
@@ -841,6 +938,35 @@ Returns the maximum length of word in the suffix tree.
 :rtype: int
 
 :complexity: Constant.
+)pbdoc");
+    thing.def("memory_usage",
+              &ukkonen_memory_usage,
+              R"pbdoc(
+:sig=(self: Ukkonen) -> dict[str, int]:
+
+Returns an estimate of the memory used by the suffix tree.
+
+This function returns a dictionary containing an estimate of the number of
+bytes used to store the nodes of *self* (key ``"nodes"``), the children of
+every node (key ``"children"``), the underlying word containing all of the
+words in the suffix tree (key ``"word"``), the multiplicity and position of
+every distinct word (key ``"words"``), and the sum of these values and the size
+of *self* itself (key ``"total"``). The estimates do not include any overheads
+of the memory allocator. The memory used by the compact layout returned by
+:any:`ukkonen.compact_arrays` is the sum of the ``nbytes`` of its arrays.
+
+:returns: The estimated number of bytes used by each component.
+:rtype: dict[str, int]
+
+:complexity: Linear in the number of nodes.
+
+.. doctest::
+
+   >>> from libsemigroups_pybind11 import Ukkonen, ukkonen
+   >>> u = Ukkonen()
+   >>> ukkonen.add_words(u, ["aaeaaa", "abcd"])
+   >>> u.memory_usage()["total"] > len(u.nodes())
+   True
 )pbdoc");
     thing.def("multiplicity",
               &Ukkonen::multiplicity,
@@ -986,6 +1112,7 @@ correspond to intervals of letters in that delimited string.
     m.def("ukkonen_number_of_distinct_subwords",
           &ukkonen::number_of_distinct_subwords,
           py::arg("u"),
+          py::call_guard<py::gil_scoped_release>(),
           R"pbdoc(
 :sig=(u: Ukkonen) -> int:
 Returns the total number of distinct subwords of the words in the suffix tree *u*.
@@ -999,6 +1126,93 @@ Returns the total number of distinct subwords of the words in the suffix tree *u
 :complexity: Linear in ``Ukkonen.length_of_distinct_words``.
 )pbdoc");
 
+    m.def("ukkonen_compact_arrays",
+          &ukkonen_compact_arrays,
+          py::arg("u"),
+          R"pbdoc(
+:sig=(u: Ukkonen) -> dict[str, numpy.ndarray]:
+
+Returns a compact struct-of-arrays copy of the nodes of a suffix tree.
+
+This function returns a ``dict`` with the following numpy arrays, where ``n``
+is the number of nodes of *u*, and the ``i``-th entry of each of the first
+three arrays corresponds to ``u.nodes()[i]``:
+
+* ``"l"`` and ``"r"`` (``numpy.uint32``, length ``n``): the values of
+  :any:`Ukkonen.Node.l` and :any:`Ukkonen.Node.r`;
+* ``"parent"`` (``numpy.uint32``, length ``n``): the value of
+  :any:`Ukkonen.Node.parent`, with :any:`UNDEFINED` (for the root) represented
+  by ``2 ** 32 - 1``;
+* ``"child_offsets"`` (``numpy.uint64``, length ``n + 1``): the children of
+  the ``i``-th node are in positions ``child_offsets[i]`` to
+  ``child_offsets[i + 1]`` of the next two arrays;
+* ``"child_letters"`` (``numpy.uint64``) and ``"child_nodes"``
+  (``numpy.uint32``): the first letters of the edges to the children, sorted
+  in increasing order for every node, and the indices of the children.
+
+This layout uses considerably less memory than the nodes of *u* (see
+:any:`Ukkonen.memory_usage`), and can be used for read-only processing of very
+large suffix trees, or for estimating their memory requirements.
+
+:param u: the :any:`Ukkonen` object.
+:type u: Ukkonen
+
+:returns: The dictionary of arrays.
+:rtype: dict[str, numpy.ndarray]
+
+:raises LibsemigroupsError:
+  if *u* has too many nodes or letters to be indexed by 32-bit integers.
+)pbdoc");
+
+    m.def(
+        "ukkonen_add_words_batch",
+        [](Ukkonen&              u,
+           packed_letters const& letters,
+           packed_offsets const& offsets) {
+          size_t const    n = throw_if_bad_packed_words(letters, offsets);
+          uint32_t const* l = letters.data();
+          uint64_t const* o = offsets.data();
+          py::gil_scoped_release release;
+          for (size_t i = 0; i < n; ++i) {
+            ukkonen::add_word(u, l + o[i], l + o[i + 1]);
+          }
+        },
+        py::arg("u"),
+        py::arg("letters"),
+        py::arg("offsets"),
+        R"pbdoc(
+:sig=(u: Ukkonen, letters: numpy.ndarray, offsets: numpy.ndarray) -> None:
+
+Add a packed batch of words to an :any:`Ukkonen` object.
+
+The words are passed as a pair of arrays *letters* and *offsets*, so that the
+``i``-th word is ``letters[offsets[i]:offsets[i + 1]]``; such arrays are
+returned by, for example, :any:`random_words`. This function is equivalent to
+calling :any:`ukkonen.add_word` for every word in turn, but the words are
+added without holding the GIL and without converting them to Python objects.
+
+:param u: the :any:`Ukkonen` object.
+:type u: Ukkonen
+
+:param letters: the letters of the words.
+:type letters: numpy.ndarray
+
+:param offsets: the offsets of the words in *letters*.
+:type offsets: numpy.ndarray
+
+:raises LibsemigroupsError:
+  if *letters* and *offsets* are not 1-dimensional, or *offsets* is not
+  non-decreasing from ``0`` to ``len(letters)``.
+
+.. doctest::
+
+   >>> from libsemigroups_pybind11 import Ukkonen, random_words, ukkonen
+   >>> u = Ukkonen()
+   >>> ukkonen.add_words_batch(u, *random_words(100, 1, 10, 2, 0))
+   >>> u.number_of_words()
+   100
+)pbdoc");
+
     bind_ukkonen_extras<word_type>(m, thing);
     bind_ukkonen_extras<std::string>(m, thing);
   }  // init_ukkonen
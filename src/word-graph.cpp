@@ -17,16 +17,24 @@
 //
 
 // C++ stl headers....
-#include <cstddef>  // for uint32_t
-#include <vector>   // for vector
+#include <cstddef>  // for size_t
+#include <cstdint>   // for uint32_t, uint64_t
+#include <iterator>  // for back_inserter
+#include <optional>  // for optional
+#include <string>    // for string
+#include <utility>   // for pair
+#include <vector>    // for vector
 
 // libsemigroups....
 #include <libsemigroups/config.hpp>     // for LIBSEMIGROUPS_EIGEN_ENABLED
 #include <libsemigroups/constants.hpp>  // for operator!=, operator==
 #include <libsemigroups/detail/int-range.hpp>  // for IntegralRange<>::value_type
-#include <libsemigroups/word-graph.hpp>        // for WordGraph
+#include <libsemigroups/dot.hpp>         // for Dot
+#include <libsemigroups/exception.hpp>   // for LIBSEMIGROUPS_EXCEPTION
+#include <libsemigroups/word-graph.hpp>  // for WordGraph
 
 // pybind11....
+#include <pybind11/numpy.h>      // for array_t
 #include <pybind11/operators.h>  // for self, self_t, operator!=, operator*
 #include <pybind11/pybind11.h>   // for class_, make_iterator, init, enum_
 #include <pybind11/stl.h>        // for conversion of C++ to py types
@@ -36,16 +44,435 @@
 #endif
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_word_graph
+#include "main.hpp"     // for init_word_graph
+#include "threads.hpp"  // for run_in_threads
 
 namespace libsemigroups {
   namespace py = pybind11;
 
+  namespace {
+    // Returns a (number_of_nodes, out_degree) array containing the targets of
+    // <wg>, with UNDEFINED represented by the maximum value of Node.
+    template <typename Node>
+    py::array_t<Node> targets_array(WordGraph<Node> const& wg) {
+      py::array_t<Node> result({static_cast<py::ssize_t>(wg.number_of_nodes()),
+                                static_cast<py::ssize_t>(wg.out_degree())});
+      auto r = result.template mutable_unchecked<2>();
+      {
+        py::gil_scoped_release release;
+        for (size_t s = 0; s < wg.number_of_nodes(); ++s) {
+          for (size_t a = 0; a < wg.out_degree(); ++a) {
+            r(s, a) = wg.target_no_checks(s, a);
+          }
+        }
+      }
+      return result;
+    }
+
+    template <typename Node>
+    WordGraph<Node> word_graph_from_array(
+        py::array_t<Node, py::array::c_style | py::array::forcecast> const&
+            targets) {
+      if (targets.ndim() != 2) {
+        LIBSEMIGROUPS_EXCEPTION(
+            "expected a 2-dimensional array, found {} dimension(s)",
+            targets.ndim());
+      }
+      auto            t = targets.template unchecked<2>();
+      size_t const    n = t.shape(0);
+      size_t const    m = t.shape(1);
+      WordGraph<Node> result(n, m);
+      {
+        py::gil_scoped_release release;
+        for (size_t s = 0; s < n; ++s) {
+          for (size_t a = 0; a < m; ++a) {
+            Node const x = t(s, a);
+            if (x != UNDEFINED && x >= n) {
+              LIBSEMIGROUPS_EXCEPTION(
+                  "target value out of bounds, the target of the edge with "
+                  "source {} and label {} is {}, expected a value in the range "
+                  "[0, {}) or UNDEFINED",
+                  s,
+                  a,
+                  x,
+                  n);
+            }
+            result.target_no_checks(s, a, x);
+          }
+        }
+      }
+      return result;
+    }
+
+    using index_pairs
+        = py::array_t<uint64_t, py::array::c_style | py::array::forcecast>;
+
+    // Must be called while holding the GIL, throws if graphs contains None.
+    template <typename Node>
+    void throw_if_contains_none(
+        std::vector<WordGraph<Node> const*> const& graphs) {
+      for (size_t i = 0; i < graphs.size(); ++i) {
+        if (graphs[i] == nullptr) {
+          LIBSEMIGROUPS_EXCEPTION("expected a list of word graphs, found None "
+                                  "in position {}",
+                                  i);
+        }
+      }
+    }
+
+    // Must be called while holding the GIL, throws if graphs contains None or
+    // pairs is not a (k, 2) array of indices of graphs, and returns k.
+    template <typename Node>
+    size_t throw_if_bad_index_pairs(
+        std::vector<WordGraph<Node> const*> const& graphs,
+        index_pairs const&                         pairs) {
+      if (pairs.ndim() != 2 || pairs.shape(1) != 2) {
+        LIBSEMIGROUPS_EXCEPTION("expected an array of shape (k, 2), found an "
+                                "array with {} dimension(s)",
+                                pairs.ndim());
+      }
+      throw_if_contains_none(graphs);
+      uint64_t const* p = pairs.data();
+      for (py::ssize_t i = 0; i < 2 * pairs.shape(0); ++i) {
+        if (p[i] >= graphs.size()) {
+          LIBSEMIGROUPS_EXCEPTION("index out of bounds in row {}, expected a "
+                                  "value in the range [0, {}), found {}",
+                                  i / 2,
+                                  graphs.size(),
+                                  p[i]);
+        }
+      }
+      return pairs.shape(0);
+    }
+
+    // Returns the subgraph of wg induced on the nodes reachable from 0, with
+    // the nodes renumbered in the order they are first visited by a
+    // breadth-first search from 0 that follows the edges of each node in
+    // increasing order of label. This is the order of the shortlex least words
+    // labelling paths from 0, and so two word graphs have the same canonical
+    // form if and only if their subgraphs reachable from 0 are isomorphic via
+    // an isomorphism fixing 0.
+    template <typename Node>
+    WordGraph<Node> canonical_form(WordGraph<Node> const& wg) {
+      size_t const n = wg.number_of_nodes();
+      size_t const m = wg.out_degree();
+      if (n == 0) {
+        return WordGraph<Node>(0, m);
+      }
+      std::vector<Node> new_node(n, static_cast<Node>(UNDEFINED));
+      std::vector<Node> old_node = {0};
+      new_node[0]                = 0;
+      for (size_t i = 0; i < old_node.size(); ++i) {
+        for (size_t a = 0; a < m; ++a) {
+          Node const t = wg.target_no_checks(old_node[i], a);
+          if (t != UNDEFINED && new_node[t] == UNDEFINED) {
+            new_node[t] = static_cast<Node>(old_node.size());
+            old_node.push_back(t);
+          }
+        }
+      }
+      WordGraph<Node> result(old_node.size(), m);
+      for (size_t s = 0; s < old_node.size(); ++s) {
+        for (size_t a = 0; a < m; ++a) {
+          Node const t = wg.target_no_checks(old_node[s], a);
+          if (t != UNDEFINED) {
+            result.target_no_checks(s, a, new_node[t]);
+          }
+        }
+      }
+      return result;
+    }
+
+    // Unlike std::hash or WordGraph::hash_value, this only depends on h and
+    // x, and so gives the same value on every platform and in every process.
+    // It is the hash_combine step followed by the splitmix64 finaliser.
+    inline uint64_t stable_hash_combine(uint64_t h, uint64_t x) {
+      h ^= x + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+      h ^= h >> 30;
+      h *= 0xbf58476d1ce4e5b9ULL;
+      h ^= h >> 27;
+      h *= 0x94d049bb133111ebULL;
+      return h ^ (h >> 31);
+    }
+
+    // Returns the 128-bit fingerprint of c, which must already be a
+    // canonical form, as a pair of independent 64-bit hashes (high, low) of
+    // its number of nodes, out-degree, and targets, where every UNDEFINED
+    // target is hashed as 2 ** 64 - 1.
+    template <typename Node>
+    std::pair<uint64_t, uint64_t>
+    fingerprint_of_canonical(WordGraph<Node> const& c) {
+      uint64_t              hi = 0x243f6a8885a308d3ULL;
+      uint64_t              lo = 0x13198a2e03707344ULL;
+      auto                  add = [&hi, &lo](uint64_t x) {
+        hi = stable_hash_combine(hi, x);
+        lo = stable_hash_combine(lo, x * 0xd6e8feb86659fd93ULL + 1);
+      };
+      add(c.number_of_nodes());
+      add(c.out_degree());
+      for (size_t s = 0; s < c.number_of_nodes(); ++s) {
+        for (size_t a = 0; a < c.out_degree(); ++a) {
+          Node const t = c.target_no_checks(s, a);
+          add(t == UNDEFINED ? ~uint64_t(0) : static_cast<uint64_t>(t));
+        }
+      }
+      return {hi, lo};
+    }
+
+    // Returns the 128-bit fingerprint of the canonical form of wg.
+    template <typename Node>
+    std::pair<uint64_t, uint64_t> fingerprint(WordGraph<Node> const& wg) {
+      return fingerprint_of_canonical(canonical_form(wg));
+    }
+
+    // Must be called while holding the GIL.
+    inline py::int_ fingerprint_to_int(std::pair<uint64_t, uint64_t> const& x) {
+      return py::int_((py::int_(x.first) << py::int_(64))
+                      | py::int_(x.second));
+    }
+
+    // Appends x to buf as 4 little-endian bytes.
+    inline void append_uint32_le(std::string& buf, uint32_t x) {
+      for (size_t i = 0; i < 4; ++i) {
+        buf.push_back(static_cast<char>((x >> (8 * i)) & 0xFF));
+      }
+    }
+
+    // Writes the subgraph of wg induced on the nodes s with keep[s] to file
+    // in the given format, without constructing a Dot object. The output is
+    // built in chunks of roughly chunk_size bytes without holding the GIL,
+    // and every chunk is passed to file.write as a bytes object. The nodes
+    // and edges are written in the same order, and in the case of "dot" with
+    // the same attributes, as by word_graph::dot. Must be called while
+    // holding the GIL.
+    template <typename Node>
+    void write_word_graph(WordGraph<Node> const&   wg,
+                          py::object const&        file,
+                          std::string const&       format,
+                          std::vector<bool> const& keep) {
+      size_t const chunk_size = size_t(1) << 20;
+      size_t const n          = wg.number_of_nodes();
+      size_t const m          = wg.out_degree();
+      bool const   dot        = (format == "dot");
+      bool const   graphml    = (format == "graphml");
+
+      py::object  write = file.attr("write");
+      std::string buf;
+      buf.reserve(chunk_size + 256);
+      auto flush = [&write, &buf]() {
+        if (!buf.empty()) {
+          write(py::bytes(buf));
+          buf.clear();
+        }
+      };
+      // Calls f(s) for every node s with keep[s], releasing the GIL while
+      // buf is being filled, and writing buf whenever it is full.
+      auto for_each_node = [&](auto&& f) {
+        size_t s = 0;
+        while (s < n) {
+          {
+            py::gil_scoped_release release;
+            for (; s < n && buf.size() < chunk_size; ++s) {
+              if (keep[s]) {
+                f(s);
+              }
+            }
+          }
+          flush();
+        }
+      };
+      auto out = std::back_inserter(buf);
+
+      if (dot) {
+        buf += "digraph WordGraph {\n\n";
+        for_each_node([&](size_t s) {
+          fmt::format_to(out, "  {}  [shape=\"box\"]\n", s);
+        });
+      } else if (graphml) {
+        buf += "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+               "<graphml xmlns=\"http://graphml.graphdrawing.org/xmlns\">\n"
+               "  <key id=\"label\" for=\"edge\" attr.name=\"label\" "
+               "attr.type=\"int\"/>\n"
+               "  <graph id=\"WordGraph\" edgedefault=\"directed\">\n";
+        for_each_node([&](size_t s) {
+          fmt::format_to(out, "    <node id=\"n{}\"/>\n", s);
+        });
+      }
+
+      for_each_node([&](size_t s) {
+        for (size_t a = 0; a < m; ++a) {
+          Node const t = wg.target_no_checks(s, a);
+          if (t == UNDEFINED || !keep[t]) {
+            continue;
+          }
+          if (dot) {
+            fmt::format_to(out,
+                           "  {} -> {}  [color=\"{}\"]\n",
+                           s,
+                           t,
+                           Dot::colors[a % Dot::colors.size()]);
+          } else if (graphml) {
+            fmt::format_to(out,
+                           "    <edge source=\"n{}\" target=\"n{}\"><data "
+                           "key=\"label\">{}</data></edge>\n",
+                           s,
+                           t,
+                           a);
+          } else {
+            append_uint32_le(buf, static_cast<uint32_t>(s));
+            append_uint32_le(buf, static_cast<uint32_t>(a));
+            append_uint32_le(buf, static_cast<uint32_t>(t));
+          }
+        }
+      });
+
+      if (dot) {
+        buf += "}";
+      } else if (graphml) {
+        buf += "  </graph>\n</graphml>\n";
+      }
+      flush();
+    }
+
+    // Defines is_subrelation_batch and call_batch for Meeter or Joiner. The
+    // Thing objects store some scratch data that is reused by every call, so
+    // one copy of self is used per thread.
+    template <typename Thing, typename Node>
+    void def_batch(py::class_<Thing>& thing,
+                   std::string const& name,
+                   std::string const& op) {
+      using WordGraph_ = WordGraph<Node>;
+
+      thing.def(
+          "is_subrelation_batch",
+          [](Thing&                                 self,
+             std::vector<WordGraph_ const*> const& graphs,
+             index_pairs const&                     pairs,
+             size_t                                 number_of_threads) {
+            size_t const      k = throw_if_bad_index_pairs(graphs, pairs);
+            uint64_t const*   p = pairs.data();
+            py::array_t<bool> result(k);
+            bool*             out = result.mutable_data();
+            {
+              py::gil_scoped_release release;
+              run_in_threads(
+                  k, number_of_threads, [&](size_t first, size_t last) {
+                    Thing  copy;
+                    Thing& scratch = (first == 0 ? self : copy);
+                    for (size_t i = first; i < last; ++i) {
+                      out[i] = scratch.is_subrelation(*graphs[p[2 * i]],
+                                                      *graphs[p[2 * i + 1]]);
+                    }
+                  });
+            }
+            return result;
+          },
+          py::arg("graphs"),
+          py::arg("pairs"),
+          py::arg("number_of_threads") = 1,
+          fmt::format(R"pbdoc(
+:sig=(self: {0}, graphs: list[WordGraph], pairs: numpy.ndarray, number_of_threads: int = 1) -> numpy.ndarray:
+
+Check containment for many pairs of word graphs.
+
+This function returns an array whose ``i``-th entry is
+``self.is_subrelation(graphs[pairs[i][0]], graphs[pairs[i][1]])``. The pairs
+are processed without holding the GIL using *number_of_threads* threads, each
+of which reuses the same scratch storage for all of its pairs.
+
+:param graphs: the word graphs.
+:type graphs: list[WordGraph]
+
+:param pairs:
+  a 2-dimensional array of shape ``(k, 2)`` containing indices in *graphs*.
+:type pairs: numpy.ndarray
+
+:param number_of_threads: the number of threads to use (default: ``1``).
+:type number_of_threads: int
+
+:returns: An array of ``bool`` of length ``k``.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError:
+  if *graphs* contains ``None``, or *pairs* does not have shape ``(k, 2)``, or
+  *pairs* contains a value greater than or equal to ``len(graphs)``.
+
+:raises LibsemigroupsError:
+  if :any:`{0}.is_subrelation` raises for any pair.
+)pbdoc",
+                      name)
+              .c_str());
+
+      thing.def(
+          "call_batch",
+          [](Thing&                                 self,
+             std::vector<WordGraph_ const*> const& graphs,
+             index_pairs const&                     pairs,
+             size_t                                 number_of_threads) {
+            size_t const            k = throw_if_bad_index_pairs(graphs, pairs);
+            uint64_t const*         p = pairs.data();
+            std::vector<WordGraph_> result(k);
+            {
+              py::gil_scoped_release release;
+              run_in_threads(
+                  k, number_of_threads, [&](size_t first, size_t last) {
+                    Thing  copy;
+                    Thing& scratch = (first == 0 ? self : copy);
+                    for (size_t i = first; i < last; ++i) {
+                      scratch(result[i],
+                              *graphs[p[2 * i]],
+                              *graphs[p[2 * i + 1]]);
+                    }
+                  });
+            }
+            return result;
+          },
+          py::arg("graphs"),
+          py::arg("pairs"),
+          py::arg("number_of_threads") = 1,
+          fmt::format(R"pbdoc(
+:sig=(self: {0}, graphs: list[WordGraph], pairs: numpy.ndarray, number_of_threads: int = 1) -> list[WordGraph]:
+
+Compute the {1}s of many pairs of word graphs.
+
+This function returns a list whose ``i``-th entry is
+``self(graphs[pairs[i][0]], graphs[pairs[i][1]])``. The pairs are processed
+without holding the GIL using *number_of_threads* threads, each of which reuses
+the same scratch storage for all of its pairs.
+
+:param graphs: the word graphs.
+:type graphs: list[WordGraph]
+
+:param pairs:
+  a 2-dimensional array of shape ``(k, 2)`` containing indices in *graphs*.
+:type pairs: numpy.ndarray
+
+:param number_of_threads: the number of threads to use (default: ``1``).
+:type number_of_threads: int
+
+:returns: A list of the {1}s of length ``k``.
+:rtype: list[WordGraph]
+
+:raises LibsemigroupsError:
+  if *graphs* contains ``None``, or *pairs* does not have shape ``(k, 2)``, or
+  *pairs* contains a value greater than or equal to ``len(graphs)``.
+
+:raises LibsemigroupsError:
+  if :any:`{0}.__call__` raises for any pair.
+)pbdoc",
+                      name,
+                      op)
+              .c_str());
+    }
+  }  // namespace
+
   void init_word_graph(py::module& m) {
     using WordGraph_ = WordGraph<uint32_t>;
 
     using node_type  = typename WordGraph_::node_type;
     using label_type = typename WordGraph_::label_type;
+    using node_array
+        = py::array_t<node_type, py::array::c_style | py::array::forcecast>;
 
     py::class_<WordGraph_> thing(m,
                                  "WordGraph",
@@ -56,7 +483,12 @@ Instances of this class represent word graphs. If the word graph has ``n``
 nodes, they are represented by the numbers :math:`\{0, ..., n - 1\}`, and every
 node has the same number ``m`` of out-edges (edges with source that node and
 target any other node or :any:`UNDEFINED`). The number ``m`` is referred to as
-the *out-degree* of the word graph, or any of its nodes.)pbdoc");
+the *out-degree* of the word graph, or any of its nodes.
+
+A word graph can be converted to a ``numpy.ndarray`` of shape ``(n, m)`` with
+``numpy.uint32`` entries using ``numpy.asarray``, where the ``(s, a)``-entry is
+the target of the edge with source ``s`` and label ``a``, and
+:any:`UNDEFINED` is represented by the maximum value of ``numpy.uint32``.)pbdoc");
 
     thing.def("__repr__", [](WordGraph_ const& self) {
       return to_human_readable_repr(self);
@@ -141,6 +573,64 @@ out-degree is specified by the length of the first item in *targets*.
 
 )pbdoc");
 
+    thing.def(py::init(&word_graph_from_array<node_type>),
+              py::arg("targets"),
+              R"pbdoc(
+:sig=(self: WordGraph, targets: numpy.ndarray[numpy.uint32]) -> None:
+
+Construct a word graph from a 2-dimensional array of targets.
+
+This function constructs a word graph whose number of nodes is the number of
+rows of *targets*, and whose out-degree is the number of columns of
+*targets*. The target of the edge with source ``s`` and label ``a`` is
+``targets[s, a]``, where :any:`UNDEFINED` is represented by the maximum value
+of ``numpy.uint32``. The targets are copied in a single pass, without
+converting each target to a Python object, and so this is much faster than
+constructing a word graph from a list of lists when the word graph is large.
+
+:param targets: the array of targets.
+:type targets: numpy.ndarray[numpy.uint32]
+
+:raises LibsemigroupsError: if *targets* is not 2-dimensional.
+
+:raises LibsemigroupsError:
+    if any target in *targets* is not less than the number of rows of
+    *targets* and is not :any:`UNDEFINED`.
+
+.. doctest::
+
+  >>> import numpy
+  >>> from libsemigroups_pybind11 import WordGraph
+  >>> numpy.asarray(WordGraph(numpy.array([[1, 0], [0, 1]], dtype=numpy.uint32)))
+  array([[1, 0],
+         [0, 1]], dtype=uint32)
+)pbdoc");
+
+    // There doesn't seem to be any way of accessing the underlying storage of
+    // a WordGraph, and so we can't implement the buffer protocol without
+    // copying. Instead we implement the numpy array protocol, which makes a
+    // copy of the targets in a single pass.
+    thing.def(
+        "__array__",
+        [](WordGraph_ const& self, py::object dtype, py::object copy) {
+          if (!copy.is_none() && !copy.cast<bool>()) {
+            throw py::value_error(
+                "a WordGraph cannot be converted to an array without copying");
+          }
+          py::array result = targets_array(self);
+          if (!dtype.is_none()) {
+            return py::array(result.attr("astype")(dtype));
+          }
+          return result;
+        },
+        py::arg("dtype") = py::none(),
+        py::arg("copy")  = py::none());
+
+    thing.def(py::pickle(
+        [](WordGraph_ const& self) { return targets_array(self); },
+        [](py::array_t<node_type, py::array::c_style | py::array::forcecast>
+               state) { return word_graph_from_array<node_type>(state); }));
+
     thing.def("add_nodes",
               &WordGraph_::add_nodes,
               py::arg("nr"),
@@ -711,6 +1201,60 @@ This function returns a :any:`Dot` object representing the word graph *wg*.
 :rtype: Dot
    )pbdoc");
 
+    m.def(
+        "word_graph_write",
+        [](WordGraph_ const&                wg,
+           py::object const&                file,
+           std::string const&               file_format,
+           std::optional<node_array> const& nodes) {
+          if (file_format != "dot" && file_format != "graphml"
+              && file_format != "edges") {
+            LIBSEMIGROUPS_EXCEPTION("expected the 3rd argument (file_format) "
+                                    "to be \"dot\", \"graphml\", or "
+                                    "\"edges\", found \"{}\"",
+                                    file_format);
+          }
+          size_t const      n = wg.number_of_nodes();
+          std::vector<bool> keep(n, !nodes.has_value());
+          if (nodes.has_value()) {
+            node_type const* first = nodes->data();
+            for (py::ssize_t i = 0; i < nodes->size(); ++i) {
+              if (first[i] >= n) {
+                LIBSEMIGROUPS_EXCEPTION("node value out of bounds in position "
+                                        "{}, expected a value in the range "
+                                        "[0, {}), found {}",
+                                        i,
+                                        n,
+                                        first[i]);
+              }
+              keep[first[i]] = true;
+            }
+          }
+          // A path is only opened once the arguments have been validated, so
+          // that an existing file is not truncated if they are invalid.
+          if (!py::isinstance<py::str>(file)
+              && !py::hasattr(file, "__fspath__")) {
+            write_word_graph(wg, file, file_format, keep);
+            return;
+          }
+          py::object f = py::module_::import("io").attr("open")(file, "wb");
+          try {
+            write_word_graph(wg, f, file_format, keep);
+          } catch (...) {
+            f.attr("close")();
+            throw;
+          }
+          f.attr("close")();
+        },
+        py::arg("wg"),
+        py::arg("file"),
+        py::arg("file_format"),
+        py::arg("nodes"),
+        R"pbdoc(
+Implementation of :any:`word_graph.write`, where *file* must be a path or a
+binary file object.
+)pbdoc");
+
     m.def(
         "word_graph_equal_to",
         [](WordGraph_ const& x,
@@ -1377,6 +1921,222 @@ spanning tree corresponds to the order *val*.
 :rtype: tuple[bool, Forest]
 )pbdoc");
 
+    m.def(
+        "word_graph_canonical_form",
+        [](WordGraph_ const& wg) {
+          py::gil_scoped_release release;
+          return canonical_form(wg);
+        },
+        py::arg("wg"),
+        R"pbdoc(
+:sig=(wg: WordGraph) -> WordGraph:
+Returns the canonical form of a word graph.
+
+This function returns the word graph obtained from the subgraph of *wg*
+induced on the nodes reachable from ``0``, where the nodes are renumbered in
+the order that they are first visited by a breadth-first search from ``0``
+that follows the out-edges of every node in increasing order of their labels.
+In other words, the nodes are numbered in :any:`Order.shortlex` order of the
+least words labelling paths from ``0`` to them, as in :any:`standardize`.
+
+Two word graphs have equal canonical forms if and only if their subgraphs
+reachable from ``0`` are isomorphic via an isomorphism mapping ``0`` to
+``0``. In particular, the word graphs returned by :any:`Sims1` or
+:any:`ToddCoxeter.word_graph` for the same congruence have the same canonical
+form, regardless of the order that their nodes were defined in.
+
+:param wg: the word graph.
+:type wg: WordGraph
+
+:returns: The canonical form of *wg*.
+:rtype: WordGraph
+
+:complexity:
+  :math:`O(mn)` where :math:`m` is the number of nodes and :math:`n` is the
+  out-degree of *wg*.
+
+.. doctest::
+
+    >>> from libsemigroups_pybind11 import WordGraph, word_graph
+    >>> x = WordGraph(3, [[2, 0], [1, 1], [1, 0]])
+    >>> word_graph.canonical_form(x)
+    <WordGraph with 3 nodes, 6 edges, & out-degree 2>
+    >>> word_graph.canonical_form(x) == WordGraph(3, [[1, 0], [2, 0], [2, 2]])
+    True
+)pbdoc");
+
+    m.def(
+        "word_graph_canonical_form_batch",
+        [](std::vector<WordGraph_ const*> const& graphs,
+           size_t                                 number_of_threads) {
+          throw_if_contains_none(graphs);
+          std::vector<WordGraph_> result(graphs.size());
+          {
+            py::gil_scoped_release release;
+            run_in_threads(graphs.size(),
+                           number_of_threads,
+                           [&](size_t first, size_t last) {
+                             for (size_t i = first; i < last; ++i) {
+                               result[i] = canonical_form(*graphs[i]);
+                             }
+                           });
+          }
+          return result;
+        },
+        py::arg("graphs"),
+        py::arg("number_of_threads") = 1,
+        R"pbdoc(
+:sig=(graphs: list[WordGraph], number_of_threads: int = 1) -> list[WordGraph]:
+Returns the canonical forms of many word graphs.
+
+This function returns a list whose ``i``-th entry is
+``canonical_form(graphs[i])``. The word graphs are processed without holding
+the GIL using *number_of_threads* threads.
+
+:param graphs: the word graphs.
+:type graphs: list[WordGraph]
+
+:param number_of_threads: the number of threads to use (default: ``1``).
+:type number_of_threads: int
+
+:returns: The canonical forms of the word graphs in *graphs*.
+:rtype: list[WordGraph]
+
+:raises LibsemigroupsError: if *graphs* contains ``None``.
+)pbdoc");
+
+    m.def(
+        "word_graph_fingerprint",
+        [](WordGraph_ const& wg) {
+          std::pair<uint64_t, uint64_t> result;
+          {
+            py::gil_scoped_release release;
+            result = fingerprint(wg);
+          }
+          return fingerprint_to_int(result);
+        },
+        py::arg("wg"),
+        R"pbdoc(
+:sig=(wg: WordGraph) -> int:
+Returns a 128-bit fingerprint of the canonical form of a word graph.
+
+This function returns a non-negative integer less than ``2 ** 128`` computed
+from the number of nodes, the out-degree, and the targets of
+:any:`canonical_form(wg) <canonical_form>`. Word graphs with equal canonical
+forms have equal fingerprints, and word graphs with different canonical forms
+have equal fingerprints with negligible probability.
+
+Unlike ``hash(wg)``, the fingerprint does not depend on the numbering of the
+nodes of *wg*, or on the platform, process, or version of
+``libsemigroups_pybind11``, and so fingerprints computed in different
+processes (for example, in the shards of a search using :any:`Sims1`) can be
+compared directly.
+
+:param wg: the word graph.
+:type wg: WordGraph
+
+:returns: The fingerprint of *wg*.
+:rtype: int
+
+:complexity:
+  :math:`O(mn)` where :math:`m` is the number of nodes and :math:`n` is the
+  out-degree of *wg*.
+
+.. doctest::
+
+    >>> from libsemigroups_pybind11 import WordGraph, word_graph
+    >>> x = WordGraph(3, [[2, 0], [1, 1], [1, 0]])
+    >>> y = WordGraph(3, [[1, 0], [2, 0], [2, 2]])
+    >>> word_graph.fingerprint(x) == word_graph.fingerprint(y)
+    True
+    >>> x == y
+    False
+)pbdoc");
+
+    m.def(
+        "word_graph_fingerprint_batch",
+        [](std::vector<WordGraph_ const*> const& graphs,
+           size_t                                 number_of_threads) {
+          throw_if_contains_none(graphs);
+          std::vector<std::pair<uint64_t, uint64_t>> fps(graphs.size());
+          {
+            py::gil_scoped_release release;
+            run_in_threads(graphs.size(),
+                           number_of_threads,
+                           [&](size_t first, size_t last) {
+                             for (size_t i = first; i < last; ++i) {
+                               fps[i] = fingerprint(*graphs[i]);
+                             }
+                           });
+          }
+          py::list result(fps.size());
+          for (size_t i = 0; i < fps.size(); ++i) {
+            result[i] = fingerprint_to_int(fps[i]);
+          }
+          return result;
+        },
+        py::arg("graphs"),
+        py::arg("number_of_threads") = 1,
+        R"pbdoc(
+:sig=(graphs: list[WordGraph], number_of_threads: int = 1) -> list[int]:
+Returns the fingerprints of many word graphs.
+
+This function returns a list whose ``i``-th entry is
+``fingerprint(graphs[i])``. The word graphs are processed without holding the
+GIL using *number_of_threads* threads.
+
+:param graphs: the word graphs.
+:type graphs: list[WordGraph]
+
+:param number_of_threads: the number of threads to use (default: ``1``).
+:type number_of_threads: int
+
+:returns: The fingerprints of the word graphs in *graphs*.
+:rtype: list[int]
+
+:raises LibsemigroupsError: if *graphs* contains ``None``.
+)pbdoc");
+
+    // The next two functions are used by CanonicalDict and CanonicalSet to
+    // compute the canonical form of each word graph only once, rather than
+    // once for the key and again for its fingerprint.
+    m.def("word_graph_canonical_key", [](WordGraph_ const& wg) {
+      WordGraph_                    c;
+      std::pair<uint64_t, uint64_t> fp;
+      {
+        py::gil_scoped_release release;
+        c  = canonical_form(wg);
+        fp = fingerprint_of_canonical(c);
+      }
+      return py::make_tuple(std::move(c), fingerprint_to_int(fp));
+    });
+
+    m.def("word_graph_canonical_keys",
+          [](std::vector<WordGraph_ const*> const& graphs,
+             size_t                                 number_of_threads) {
+            throw_if_contains_none(graphs);
+            std::vector<WordGraph_>                    canonical(graphs.size());
+            std::vector<std::pair<uint64_t, uint64_t>> fps(graphs.size());
+            {
+              py::gil_scoped_release release;
+              run_in_threads(graphs.size(),
+                             number_of_threads,
+                             [&](size_t first, size_t last) {
+                               for (size_t i = first; i < last; ++i) {
+                                 canonical[i] = canonical_form(*graphs[i]);
+                                 fps[i]
+                                     = fingerprint_of_canonical(canonical[i]);
+                               }
+                             });
+            }
+            py::list result(graphs.size());
+            for (size_t i = 0; i < graphs.size(); ++i) {
+              result[i] = py::make_tuple(std::move(canonical[i]),
+                                         fingerprint_to_int(fps[i]));
+            }
+            return result;
+          });
+
     m.def(
         "word_graph_topological_sort",
         [](WordGraph_ const& wg) { return word_graph::topological_sort(wg); },
@@ -1676,6 +2436,8 @@ and *y*.
 :raises LibsemigroupsError: if *yroot* isn't a node in *y*;
 :raises LibsemigroupsError: if  ``x.out_degree() != y.out_degree()``.)pbdoc");
 
+    def_batch<Meeter, node_type>(meeter, "Meeter", "meet");
+
     ////////////////////////////////////////////////////////////////////////
     // Joiner
     ////////////////////////////////////////////////////////////////////////
@@ -1913,5 +2675,7 @@ and *y*.
 :raises LibsemigroupsError: if *x* has no nodes;
 :raises LibsemigroupsError: if *y* has no nodes;
 :raises LibsemigroupsError: if ``x.out_degree() != y.out_degree()``.)pbdoc");
+
+    def_batch<Joiner, node_type>(joiner, "Joiner", "join");
   }
 }  // namespace libsemigroups
@@ -18,10 +18,14 @@
 
 // C std headers....
 #include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t, uint64_t
 
 // C++ stl headers....
+#include <algorithm>         // for min
 #include <initializer_list>  // for initializer_list
 #include <iosfwd>            // for string
+#include <string>            // for string
+#include <type_traits>       // for decay_t
 #include <vector>            // for vector
 
 // libsemigroups....
@@ -33,17 +37,228 @@
 
 // pybind11....
 #include <pybind11/complex.h>
+#include <pybind11/numpy.h>     // for array_t
 #include <pybind11/pybind11.h>  // for make_iterator, module
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_words
+#include "main.hpp"          // for init_words
+#include "packed-words.hpp"  // for pack_words
+#include "threads.hpp"       // for run_in_threads
 
 namespace libsemigroups {
   namespace py = pybind11;
 
   using size_type = typename std::vector<word_type>::size_type;
 
+  namespace {
+    // The arguments of fill are written to, and so must not be converted.
+    using fill_letters = py::array_t<uint32_t, py::array::c_style>;
+    using fill_offsets = py::array_t<uint64_t, py::array::c_style>;
+
+    // Must be called while holding the GIL.
+    template <typename Range>
+    py::tuple take_words(Range& r, size_t n) {
+      using Word = std::decay_t<decltype(r.get())>;
+      std::vector<Word> words;
+      {
+        py::gil_scoped_release release;
+        for (; words.size() < n && !r.at_end(); r.next()) {
+          words.push_back(r.get());
+        }
+      }
+      return pack_words(words);
+    }
+
+    // Writes as many of the next words of r as fit into letters and offsets,
+    // and returns the number of words written. Must be called while holding
+    // the GIL.
+    template <typename Range>
+    size_t fill_words(Range& r, fill_letters& letters, fill_offsets& offsets) {
+      if (letters.ndim() != 1 || offsets.ndim() != 1) {
+        LIBSEMIGROUPS_EXCEPTION("expected 1-dimensional arrays of letters and "
+                                "offsets, found {}- and {}-dimensional arrays",
+                                letters.ndim(),
+                                offsets.ndim());
+      }
+      if (offsets.size() == 0) {
+        LIBSEMIGROUPS_EXCEPTION(
+            "expected the array of offsets to be non-empty, found size 0");
+      }
+      auto         l           = letters.mutable_unchecked<1>();
+      auto         o           = offsets.mutable_unchecked<1>();
+      size_t const max_words   = offsets.size() - 1;
+      size_t const max_letters = letters.size();
+      size_t       i = 0, k = 0;
+      o(0)                    = 0;
+      {
+        py::gil_scoped_release release;
+        for (; i < max_words && !r.at_end(); ++i, r.next()) {
+          auto const& w = r.get();
+          if (k + w.size() > max_letters) {
+            break;
+          }
+          for (auto x : w) {
+            l(k++) = detail::to_packed_letter(x);
+          }
+          o(i + 1) = k;
+        }
+      }
+      return i;
+    }
+
+    // Replaces w by the word n places after it in shortlex order over an
+    // alphabet of size a, by adding n to the bijective base-a numeral whose
+    // digits are the letters of w plus 1. Returns false (and leaves w in an
+    // unspecified state) if the result is longer than max_length.
+    bool shortlex_advance(word_type& w,
+                          size_t     n,
+                          size_t     a,
+                          size_t     max_length) {
+      uint64_t carry = n;
+      for (auto it = w.rbegin(); it != w.rend() && carry != 0; ++it) {
+        uint64_t d     = *it + 1 + carry;
+        uint64_t digit = (d - 1) % a + 1;
+        carry          = (d - digit) / a;
+        *it            = digit - 1;
+      }
+      while (carry != 0) {
+        if (w.size() == max_length) {
+          return false;
+        }
+        uint64_t digit = (carry - 1) % a + 1;
+        carry          = (carry - digit) / a;
+        w.insert(w.begin(), digit - 1);
+      }
+      return true;
+    }
+
+    void skip_words(WordRange& wr, size_t n) {
+      if (wr.order() != Order::shortlex || wr.alphabet_size() == 0) {
+        for (; n > 0 && !wr.at_end(); --n) {
+          wr.next();
+        }
+        return;
+      }
+      if (n == 0 || wr.at_end()) {
+        return;
+      }
+      word_type w = wr.get();
+      if (!shortlex_advance(w, n, wr.alphabet_size(), wr.last().size())) {
+        w = wr.last();
+      }
+      wr.first(w);
+    }
+
+    void skip_strings(StringRange& sr, size_t n) {
+      std::string const& alphabet = sr.alphabet();
+      if (sr.order() != Order::shortlex || alphabet.empty()) {
+        for (; n > 0 && !sr.at_end(); --n) {
+          sr.next();
+        }
+        return;
+      }
+      if (n == 0 || sr.at_end()) {
+        return;
+      }
+      word_type w;
+      for (auto c : sr.get()) {
+        w.push_back(alphabet.find(c));
+      }
+      std::string s;
+      if (shortlex_advance(w, n, alphabet.size(), sr.last().size())) {
+        for (auto x : w) {
+          s.push_back(alphabet[x]);
+        }
+      } else {
+        s = sr.last();
+      }
+      sr.first(s);
+    }
+
+    // The splitmix64 output function, which is a bijection on uint64_t.
+    uint64_t mix64(uint64_t z) {
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+      return z ^ (z >> 31);
+    }
+
+    // The i-th word returned by random_words is generated by a splitmix64
+    // generator whose initial state depends only on the seed, the stream id,
+    // and i, so that the output does not depend on the number of threads.
+    class SplitMix64 {
+      uint64_t _state;
+
+     public:
+      SplitMix64(uint64_t seed, uint64_t stream_id, uint64_t index)
+          : _state(mix64(mix64(mix64(seed) ^ stream_id) ^ index)) {}
+
+      uint64_t operator()() {
+        return mix64(_state += 0x9E3779B97F4A7C15);
+      }
+
+      // Returns a value in [0, n), the bias is negligible for small n.
+      uint64_t operator()(uint64_t n) {
+        return (*this)() % n;
+      }
+    };
+
+    // Must be called while holding the GIL.
+    py::tuple packed_random_words(size_t   number,
+                                  size_t   min,
+                                  size_t   max,
+                                  size_t   alphabet_size,
+                                  uint64_t seed,
+                                  uint64_t stream_id,
+                                  size_t   number_of_threads) {
+      if (min >= max) {
+        LIBSEMIGROUPS_EXCEPTION("the 2nd argument (min) must be less than the "
+                                "3rd argument (max), found {} >= {}",
+                                min,
+                                max);
+      } else if (alphabet_size == 0 && max > 1) {
+        LIBSEMIGROUPS_EXCEPTION("the 4th argument (alphabet size) must be "
+                                "non-zero if the 3rd argument (max) is greater "
+                                "than 1, found {}",
+                                max);
+      } else if (number_of_threads == 0) {
+        LIBSEMIGROUPS_EXCEPTION(
+            "the 7th argument (number of threads) must be non-zero");
+      }
+      py::array_t<uint64_t> offsets(number + 1);
+      auto                  o = offsets.mutable_unchecked<1>();
+      o(0)                    = 0;
+      {
+        py::gil_scoped_release release;
+        for (size_t i = 0; i < number; ++i) {
+          size_t len = min;
+          if (max - min > 1) {
+            len += SplitMix64(seed, stream_id, i)(max - min);
+          }
+          o(i + 1) = o(i) + len;
+        }
+      }
+      py::array_t<uint32_t> letters(o(number));
+      auto                  l = letters.mutable_unchecked<1>();
+      {
+        py::gil_scoped_release release;
+        run_in_threads(
+            number, number_of_threads, [&](size_t first, size_t last) {
+              for (size_t i = first; i < last; ++i) {
+                SplitMix64 rng(seed, stream_id, i);
+                if (max - min > 1) {
+                  rng(max - min);  // the length
+                }
+                for (uint64_t j = o(i); j < o(i + 1); ++j) {
+                  l(j) = rng(alphabet_size);
+                }
+              }
+            });
+      }
+      return py::make_tuple(letters, offsets);
+    }
+  }  // namespace
+
   void init_words(py::module& m) {
     ////////////////////////////////////////////////////////////////////////////
     // WordRange
@@ -441,6 +656,91 @@ since the last time :any:`WordRange.next()` or :any:`WordRange.get()` is called,
 
 :returns: Whether or not the settings have been changed.
 :rtype: bool
+)pbdoc");
+
+    thing1.def(
+        "fill",
+        [](WordRange& self, fill_letters& letters, fill_offsets& offsets) {
+          return fill_words(self, letters, offsets);
+        },
+        py::arg("letters").noconvert(),
+        py::arg("offsets").noconvert(),
+        R"pbdoc(
+:sig=(self: WordRange, letters: numpy.ndarray, offsets: numpy.ndarray) -> int:
+
+Write the next words of the range into existing arrays.
+
+This function writes as many of the next words of the range as fit into the
+arrays *letters* and *offsets*, so that the *i*-th word written is
+``letters[offsets[i]:offsets[i + 1]]``, and advances the range past them.
+At most ``len(offsets) - 1`` words are written, and fewer if the next word does
+not fit into the remaining space in *letters*. The values in *letters* after
+the last word written, and in *offsets* after the last offset written, are
+unchanged. The global interpreter lock is released while the words are
+written.
+
+:param letters: a contiguous array with dtype ``uint32``.
+:type letters: numpy.ndarray
+
+:param offsets: a contiguous array with dtype ``uint64``.
+:type offsets: numpy.ndarray
+
+:returns: The number of words written.
+:rtype: int
+
+:raises TypeError:
+  if *letters* or *offsets* is not a contiguous array with the correct dtype.
+
+:raises LibsemigroupsError:
+  if *letters* or *offsets* is not 1-dimensional, or *offsets* is empty.
+)pbdoc");
+    thing1.def(
+        "skip",
+        [](WordRange& self, size_t n) -> WordRange& {
+          skip_words(self, n);
+          return self;
+        },
+        py::arg("n"),
+        R"pbdoc(
+:sig=(self: WordRange, n: int) -> WordRange:
+
+Advance the range by a number of words.
+
+This function advances the range past the next *n* words, or to the end if
+there are fewer than *n* words remaining. If :any:`WordRange.order()` is
+:any:`Order.shortlex`, then this is done without enumerating the words that are
+skipped, in time proportional to the length of the words in the range, and
+:any:`WordRange.first()` is set to the new current word. This can be used to split
+a range into pieces by index. If :any:`WordRange.order()` is :any:`Order.lex`,
+then :any:`WordRange.next()` is called *n* times.
+
+:param n: the number of words to skip.
+:type n: int
+
+:returns: *self*.
+:rtype: WordRange
+)pbdoc");
+    thing1.def(
+        "take",
+        [](WordRange& self, size_t n) { return take_words(self, n); },
+        py::arg("n"),
+        R"pbdoc(
+:sig=(self: WordRange, n: int) -> tuple[numpy.ndarray, numpy.ndarray]:
+
+Get and consume the next (at most) *n* words of the range.
+
+This function returns the next (at most) *n* words of the range as a tuple
+``(letters, offsets)`` of flat arrays with dtypes ``uint32`` and ``uint64``,
+where the *i*-th word is ``letters[offsets[i]:offsets[i + 1]]``, and advances
+the range past them. Fewer than *n* words are returned only if the end
+of the range is reached. The global interpreter lock is released while the
+words are found.
+
+:param n: the maximum number of words.
+:type n: int
+
+:returns: A tuple of arrays containing the words.
+:rtype: tuple[numpy.ndarray, numpy.ndarray]
 )pbdoc");
 
     ////////////////////////////////////////////////////////////////////////////
@@ -848,6 +1148,91 @@ This setting is only used if :any:`StringRange.order()` is :any:`Order.lex`.
 
 :returns: *self*.
 :rtype: StringRange
+)pbdoc");
+
+    thing2.def(
+        "fill",
+        [](StringRange& self, fill_letters& letters, fill_offsets& offsets) {
+          return fill_words(self, letters, offsets);
+        },
+        py::arg("letters").noconvert(),
+        py::arg("offsets").noconvert(),
+        R"pbdoc(
+:sig=(self: StringRange, letters: numpy.ndarray, offsets: numpy.ndarray) -> int:
+
+Write the next strings of the range into existing arrays.
+
+This function writes as many of the next strings of the range as fit into the
+arrays *letters* and *offsets*, so that the *i*-th string written is
+``letters[offsets[i]:offsets[i + 1]]``, and advances the range past them. The letters are the code points of the characters
+of the strings. At most ``len(offsets) - 1`` strings are written, and fewer if the next string does
+not fit into the remaining space in *letters*. The values in *letters* after
+the last string written, and in *offsets* after the last offset written, are
+unchanged. The global interpreter lock is released while the strings are
+written.
+
+:param letters: a contiguous array with dtype ``uint32``.
+:type letters: numpy.ndarray
+
+:param offsets: a contiguous array with dtype ``uint64``.
+:type offsets: numpy.ndarray
+
+:returns: The number of strings written.
+:rtype: int
+
+:raises TypeError:
+  if *letters* or *offsets* is not a contiguous array with the correct dtype.
+
+:raises LibsemigroupsError:
+  if *letters* or *offsets* is not 1-dimensional, or *offsets* is empty.
+)pbdoc");
+    thing2.def(
+        "skip",
+        [](StringRange& self, size_t n) -> StringRange& {
+          skip_strings(self, n);
+          return self;
+        },
+        py::arg("n"),
+        R"pbdoc(
+:sig=(self: StringRange, n: int) -> StringRange:
+
+Advance the range by a number of strings.
+
+This function advances the range past the next *n* strings, or to the end if
+there are fewer than *n* strings remaining. If :any:`StringRange.order()` is
+:any:`Order.shortlex`, then this is done without enumerating the strings that are
+skipped, in time proportional to the length of the strings in the range, and
+:any:`StringRange.first()` is set to the new current string. This can be used to split
+a range into pieces by index. If :any:`StringRange.order()` is :any:`Order.lex`,
+then :any:`StringRange.next()` is called *n* times.
+
+:param n: the number of strings to skip.
+:type n: int
+
+:returns: *self*.
+:rtype: StringRange
+)pbdoc");
+    thing2.def(
+        "take",
+        [](StringRange& self, size_t n) { return take_words(self, n); },
+        py::arg("n"),
+        R"pbdoc(
+:sig=(self: StringRange, n: int) -> tuple[numpy.ndarray, numpy.ndarray]:
+
+Get and consume the next (at most) *n* strings of the range.
+
+This function returns the next (at most) *n* strings of the range as a tuple
+``(letters, offsets)`` of flat arrays with dtypes ``uint32`` and ``uint64``,
+where the *i*-th string is ``letters[offsets[i]:offsets[i + 1]]``, and advances
+the range past them. The letters are the code points of the characters of the
+strings. Fewer than *n* strings are returned only if the end of the range is
+reached. The global interpreter lock is released while the strings are found.
+
+:param n: the maximum number of strings.
+:type n: int
+
+:returns: A tuple of arrays containing the strings.
+:rtype: tuple[numpy.ndarray, numpy.ndarray]
 )pbdoc");
 
     ////////////////////////////////////////////////////////////////////////////
@@ -1339,6 +1724,78 @@ in the range ``[min, max)`` over the specified alphabet.
 :raises LibsemigroupsError: if *min* is greater than *max*;
 :raises LibsemigroupsError: if ``len(alphabet) == 0`` and ``min != 0``.
 
+.. seealso::
+    :any:`random_word`
+)pbdoc");
+
+    m.def("random_words",
+          &packed_random_words,
+          py::arg("number"),
+          py::arg("min"),
+          py::arg("max"),
+          py::arg("alphabet_size"),
+          py::arg("seed"),
+          py::arg("stream_id")         = 0,
+          py::arg("number_of_threads") = 1,
+          R"pbdoc(
+:sig=(number: int, min: int, max: int, alphabet_size: int, seed: int, stream_id: int = 0, number_of_threads: int = 1) -> tuple[numpy.ndarray, numpy.ndarray]:
+
+Returns many random words, reproducibly.
+
+This function returns *number* random words, each of which has random length
+in the range ``[min, max)`` and letters in ``[0, alphabet_size)``. The words are
+returned as a tuple ``(letters, offsets)`` of flat arrays with dtypes
+``uint32`` and ``uint64``, where the *i*-th word is
+``letters[offsets[i]:offsets[i + 1]]``.
+
+Unlike :any:`random_word`, the output depends only on *seed*, *stream_id*
+and the index of each word, and not on any global state or on
+*number_of_threads*. Different values of *stream_id* give independent
+streams of words, so that, for example, separate processes can each generate
+their own part of a corpus using the same *seed*. The letters of the words are
+generated using *number_of_threads* threads, and the global interpreter lock
+is released while the words are generated.
+
+:param number: the number of random words.
+:type number: int
+
+:param min: the minimum length of a word.
+:type min: int
+
+:param max: one above the maximum length of a word.
+:type max: int
+
+:param alphabet_size: the size of the alphabet.
+:type alphabet_size: int
+
+:param seed: the seed.
+:type seed: int
+
+:param stream_id: the stream (defaults to ``0``).
+:type stream_id: int
+
+:param number_of_threads: the number of threads to use (defaults to ``1``).
+:type number_of_threads: int
+
+:returns: A tuple of arrays containing the words.
+:rtype: tuple[numpy.ndarray, numpy.ndarray]
+
+:raises LibsemigroupsError: if *min* is not less than *max*.
+:raises LibsemigroupsError:
+  if *alphabet_size* is ``0`` and *max* is greater than ``1``.
+:raises LibsemigroupsError: if *number_of_threads* is ``0``.
+
+.. doctest::
+
+  >>> from libsemigroups_pybind11 import random_words
+  >>> letters, offsets = random_words(3, 2, 5, 2, seed=42)
+  >>> len(offsets)
+  4
+  >>> all(2 <= offsets[i + 1] - offsets[i] < 5 for i in range(3))
+  True
+  >>> all(x < 2 for x in letters)
+  True
+
 .. seealso::
     :any:`random_word`
 )pbdoc");
@@ -10,6 +10,8 @@ arising from action.*pp in libsemigroups.
 
 # pylint: disable=missing-function-docstring
 
+from concurrent.futures import ThreadPoolExecutor
+
 import pytest
 
 from libsemigroups_pybind11 import (
@@ -380,3 +382,19 @@ def test_action_return_policy(right_actions):
     assert action.add_generator(x) is action
     assert action.cache_scc_multipliers(False) is action
     assert action.init() is action
+
+
+def test_action_threads(right_actions, left_actions):
+    ReportGuard(False)
+    actions = right_actions + left_actions
+    copies = [action.copy() for action in actions]
+
+    with ThreadPoolExecutor(max_workers=len(actions)) as executor:
+        word_graphs = list(executor.map(lambda action: action.word_graph(), actions))
+
+    for action, copy, wg in zip(actions, copies, word_graphs):
+        assert wg == copy.word_graph()
+        assert action.scc().number_of_components() == copy.scc().number_of_components()
+        assert [action.root_of_scc(i) for i in range(0, len(action), 97)] == [
+            copy.root_of_scc(i) for i in range(0, len(copy), 97)
+        ]
@@ -13,7 +13,13 @@ import copy
 
 import pytest
 
-from libsemigroups_pybind11 import UNDEFINED, AhoCorasick, LibsemigroupsError, aho_corasick
+from libsemigroups_pybind11 import (
+    UNDEFINED,
+    AhoCorasick,
+    LibsemigroupsError,
+    aho_corasick,
+    random_words,
+)
 
 
 def basic_ac():
@@ -167,3 +173,28 @@ def test_aho_corasick_return_policy():
 def test_aho_corasick_active_nodes():
     ac = basic_ac()
     assert list(ac.active_nodes()) == [0, 1, 2, 3, 4, 5, 6, 8]
+
+
+def test_aho_corasick_search_all():
+    ac = basic_ac()
+    patterns = [[0, 1, 0, 1], [0, 1, 1, 0], [0, 1, 1, 0, 0]]
+    letters, offsets = random_words(200, 0, 30, 2, 42)
+    texts = [letters[offsets[i] : offsets[i + 1]].tolist() for i in range(200)]
+
+    expected = []
+    for i, w in enumerate(texts):
+        for j in range(1, len(w) + 1):
+            for p in sorted(patterns, key=len, reverse=True):
+                if j >= len(p) and w[j - len(p) : j] == p:
+                    expected.append((i, j, aho_corasick.traverse_word(ac, p)))
+
+    for nr_threads in (1, 4):
+        text, end, node = aho_corasick.search_all(ac, letters, offsets, nr_threads)
+        assert list(zip(text.tolist(), end.tolist(), node.tolist())) == expected
+        counts = aho_corasick.count_matches(ac, letters, offsets, nr_threads)
+        assert counts.tolist() == [sum(1 for x in expected if x[0] == i) for i in range(200)]
+
+    text, end, node = aho_corasick.search_all(ac, letters[:0], offsets[:1])
+    assert text.size == 0
+    with pytest.raises(LibsemigroupsError):
+        aho_corasick.count_matches(ac, letters, offsets[1:])
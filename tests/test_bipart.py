@@ -121,3 +121,24 @@ def test_bipartition_random():
     x = Bipartition([[1, 2], [-1, -2]])
     bipartition.random(x)
     bipartition.random(10**3)
+
+
+def test_bipartition_batch():
+    xs = [bipartition.random(8) for _ in range(20)]
+    ys = [bipartition.random(8) for _ in range(20)]
+    a, b = bipartition.to_array(xs), bipartition.to_array(ys)
+    assert a.shape == (20, 16)
+    assert list(a[0]) == list(xs[0].iterator())
+    assert bipartition.from_array(a) == xs
+    assert bipartition.from_array(bipartition.product_batch(a, b)) == [
+        x * y for x, y in zip(xs, ys)
+    ]
+    assert bipartition.product_batch(a[:0], b[:0]).shape == (0, 16)
+
+    with pytest.raises(LibsemigroupsError):
+        bipartition.product_batch(a, b[:, :8])
+    a[0, 0] = 5
+    with pytest.raises(LibsemigroupsError):
+        bipartition.product_batch(a, b)
+    with pytest.raises(LibsemigroupsError):
+        bipartition.to_array([xs[0], one(Bipartition([[1, -1]]))])
@@ -10,9 +10,10 @@ arising from bmat8.*pp in libsemigroups.
 
 # pylint: disable=missing-function-docstring
 
+import numpy as np
 import pytest
 
-from libsemigroups_pybind11 import BMat8, LibsemigroupsError
+from libsemigroups_pybind11 import BMat8, LibsemigroupsError, bmat8
 
 
 def test_bmat8_006():
@@ -112,3 +113,22 @@ def test_bmat8_006():
         zeros[8, 0] = True
     with pytest.raises(LibsemigroupsError):
         zeros[8, 8] = True
+
+
+def test_bmat8_batch():
+    xs = [bmat8.random(8) for _ in range(50)]
+    ys = [bmat8.random(6) for _ in range(50)]
+    a = np.array([x.to_int() for x in xs], dtype=np.uint64)
+    b = np.array([y.to_int() for y in ys], dtype=np.uint64)
+
+    assert bmat8.product_batch(a, b).tolist() == [(x * y).to_int() for x, y in zip(xs, ys)]
+    assert bmat8.transpose_batch(a).tolist() == [bmat8.transpose(x).to_int() for x in xs]
+    assert bmat8.row_space_basis_batch(a).tolist() == [
+        bmat8.row_space_basis(x).to_int() for x in xs
+    ]
+    assert bmat8.row_space_size_batch(a).tolist() == [bmat8.row_space_size(x) for x in xs]
+
+    assert bmat8.transpose_batch(a.reshape(5, 10)).shape == (5, 10)
+    assert bmat8.product_batch(a[:0], b[:0]).size == 0
+    with pytest.raises(LibsemigroupsError):
+        bmat8.product_batch(a, b[:10])
@@ -594,3 +594,40 @@ def test_congruence_return_policy():
     c = check_congruence_common_return_policy(Congruence)
 
     assert c.max_threads(2) is c
+
+
+def test_race():
+    ReportGuard(False)
+    p = Presentation([0, 1])
+    presentation.add_rule(p, [0, 0, 0], [0])
+    presentation.add_rule(p, [1, 1], [1])
+    presentation.add_rule(p, [0, 1, 0, 1], [0])
+
+    strategy = ToddCoxeter.options.strategy
+    runners = [ToddCoxeter(congruence_kind.twosided, p) for _ in range(2)]
+    runners[0].strategy(strategy.hlt)
+    runners[1].strategy(strategy.felsch)
+    runners.append(KnuthBendix(congruence_kind.twosided, p))
+    winner, report = congruence.race(runners, 2)
+    assert winner is not None
+    assert runners[winner].finished()
+    expected = ToddCoxeter(congruence_kind.twosided, p).number_of_classes()
+    assert runners[winner].number_of_classes() == expected
+    assert report[winner][0] == "won"
+    assert len(report) == 3
+    for outcome, secs in report:
+        assert outcome in ("won", "finished", "killed", "not started")
+        assert secs >= 0
+
+    q = Presentation([0, 1])
+    presentation.add_rule(q, [0, 1], [1, 0])
+    tc = ToddCoxeter(congruence_kind.twosided, q)
+    winner, report = congruence.race([tc], 4, timedelta(milliseconds=10))
+    assert winner is None
+    assert report == [("timed out", report[0][1])]
+
+    assert congruence.race([]) == (None, [])
+    with pytest.raises(LibsemigroupsError):
+        congruence.race([tc, tc])
+    with pytest.raises(LibsemigroupsError):
+        congruence.race([tc], 0)
@@ -12,9 +12,10 @@ arising from forest.*pp in libsemigroups.
 
 from copy import copy
 
+import numpy as np
 import pytest
 
-from libsemigroups_pybind11 import UNDEFINED, Forest, forest
+from libsemigroups_pybind11 import UNDEFINED, Forest, LibsemigroupsError, forest
 
 
 @pytest.fixture(name="f")
@@ -168,3 +169,57 @@ def test_forest_paths_from_roots():
     ptr.skip_n(100)
     assert ptr.at_end()
     assert ptr.get() == []
+
+
+def test_forest_arrays():
+    f = Forest(
+        [UNDEFINED, 4, 0, 0, UNDEFINED, 3, 8, 1, 1, 12, 12, 8, 3],
+        [UNDEFINED, 0, 0, 1, UNDEFINED, 0, 1, 1, 0, 0, 1, 0, 1],
+    )
+    parents, labels = f.parents_array(), f.labels_array()
+    none = np.iinfo(parents.dtype).max
+    assert [UNDEFINED if x == none else x for x in parents.tolist()] == f.parents()
+    assert [UNDEFINED if x == none else x for x in labels.tolist()] == f.labels()
+
+    # The arrays are copies, and so they are not changed by modifying f, or
+    # invalidated when the memory of f is reallocated.
+    f.set_parent_and_label(2, 1, 1)
+    assert parents[2] == 0 and labels[2] == 0
+    f.add_nodes(10**5)
+    assert parents.tolist()[:3] == [none, 4, 0]
+    assert len(f.parents_array()) == 10**5 + 13
+
+    f = Forest(f.parents()[:13], f.labels()[:13])
+    parents, labels = f.parents_array(), f.labels_array()
+    g = forest.from_arrays(parents, labels)
+    assert g == f
+    assert forest.from_arrays(parents.astype(np.int64), labels) == f
+    with pytest.raises(LibsemigroupsError):
+        forest.from_arrays(parents[:-1], labels)
+    with pytest.raises(LibsemigroupsError):
+        forest.from_arrays(parents.reshape(1, -1), labels.reshape(1, -1))
+
+
+def test_forest_paths_to_roots_batch():
+    f = Forest(
+        [UNDEFINED, 4, 0, 0, UNDEFINED, 3, 8, 1, 1, 12, 12, 8, 3],
+        [UNDEFINED, 0, 0, 1, UNDEFINED, 0, 1, 1, 0, 0, 1, 0, 1],
+    )
+    nodes = np.array([12, 6, 0, 9, 9, 4, 11], dtype=np.uint32)
+    for n in (1, 3):
+        letters, offsets = forest.paths_to_roots(f, nodes, n)
+        assert len(offsets) == len(nodes) + 1
+        assert [
+            letters[offsets[i] : offsets[i + 1]].tolist() for i in range(len(nodes))
+        ] == [forest.path_to_root(f, x) for x in nodes]
+
+    letters, offsets = forest.paths_to_roots(f, np.arange(0))
+    assert len(letters) == 0 and offsets.tolist() == [0]
+    with pytest.raises(LibsemigroupsError):
+        forest.paths_to_roots(f, np.array([13]))
+
+    f = Forest(3)
+    f.set_parent_and_label(0, 1, 0)
+    f.set_parent_and_label(1, 0, 0)
+    with pytest.raises(LibsemigroupsError):
+        forest.paths_to_roots(f, np.array([0]))
@@ -11,8 +11,10 @@
 import contextlib
 from datetime import timedelta
 
+import numpy as np
 import pytest
 
+import libsemigroups_pybind11
 from libsemigroups_pybind11 import (
     PBR,
     UNDEFINED,
@@ -33,6 +35,7 @@ from libsemigroups_pybind11 import (
     presentation,
     to,
 )
+from libsemigroups_pybind11.detail.cxx_wrapper import CxxWrapper
 
 from .runner import check_runner
 
@@ -568,6 +571,26 @@ def test_froidure_pin_return_policy():
     assert froidure_pin.to_element(S, [0, 1, 0]) is not froidure_pin.to_element(S, [0, 1, 0])
 
 
+def test_froidure_pin_mem_fns_bypass_getattr(monkeypatch):
+    S = FroidurePin(Perm([1, 0, 2, 3, 4, 5, 6]), Perm([1, 2, 3, 4, 5, 6, 0]))
+    S.run()
+    fallbacks = []
+
+    def getattr_spy(self, name):
+        fallbacks.append(name)
+        raise AttributeError(name)
+
+    # The copied member functions should never need the (slow) fallback in
+    # CxxWrapper.__getattr__, not even to look up cached return values.
+    monkeypatch.setattr(CxxWrapper, "__getattr__", getattr_spy)
+    assert S.position(S.generator(0)) == 0
+    assert S.generator(1) is S.generator(1)
+    assert S.fast_product(0, 1) == froidure_pin.product_by_reduction(S, 0, 1)
+    assert S.batch_size(10) is S
+    assert S.size() == 5040
+    assert fallbacks == []
+
+
 def test_froidure_pin_kbe_string():  # pylint: disable=too-many-statements
     p = Presentation("ab")
     presentation.add_rule(p, "aaaaaa", "aaa")
@@ -811,3 +834,106 @@ def test_froidure_pin_kbe_word():  # pylint: disable=too-many-statements
     assert froidure_pin.minimal_factorisation(S, [0] * 2) == [0, 0]
 
     assert froidure_pin.to_element(S, [0, 0]) == [0, 0]
+
+
+def test_froidure_pin_batch_positions():
+    ReportGuard(False)
+    S = FroidurePin([Transf([1, 0, 2]), Transf([1, 2, 0]), Transf([0, 0, 1])])
+    undefined = np.iinfo(np.uint32).max
+
+    xs = [S.generator(0), S.generator(1) * S.generator(2), Transf([0, 1, 2])]
+    assert list(S.current_positions(xs)) == [
+        undefined if S.current_position(x) == UNDEFINED else S.current_position(x) for x in xs
+    ]
+    result = S.positions(xs)
+    assert result.dtype == np.uint32
+    assert list(result) == [S.position(x) for x in xs]
+    assert list(S.current_positions(xs)) == list(result)
+    assert list(S.sorted_positions(xs)) == [S.sorted_position(x) for x in xs]
+    assert list(S.positions([Transf([2, 2, 2, 2])])) == [undefined]
+
+    words = [[0], [1, 2], [0, 1, 0, 2]]
+    letters = np.array([x for w in words for x in w], dtype=np.uint32)
+    offsets = np.cumsum([0] + [len(w) for w in words], dtype=np.uint64)
+    positions = froidure_pin.positions(S, letters, offsets)
+    assert list(positions) == [froidure_pin.position(S, w) for w in words]
+    assert list(froidure_pin.current_positions(S, letters, offsets)) == list(positions)
+
+    with pytest.raises(LibsemigroupsError):
+        froidure_pin.positions(S, np.array([3], dtype=np.uint32), np.array([0, 1]))
+
+    nf_letters, nf_offsets = froidure_pin.factorisations(S, np.arange(S.size()))
+    assert [
+        list(nf_letters[nf_offsets[i] : nf_offsets[i + 1]]) for i in range(S.size())
+    ] == [froidure_pin.factorisation(S, i) for i in range(S.size())]
+
+
+@pytest.mark.skipif(
+    not libsemigroups_pybind11.LIBSEMIGROUPS_HPCOMBI_ENABLED,
+    reason="libsemigroups was compiled without HPCombi",
+)
+def test_froidure_pin_hpcombi():
+    ReportGuard(False)
+    # pylint: disable=no-name-in-module
+    from libsemigroups_pybind11 import HPCombiPerm16, HPCombiTransf16
+
+    gens = [[1, 0, 2, 3, 4], [1, 2, 3, 4, 0], [0, 0, 2, 3, 4]]
+    S = FroidurePin([HPCombiTransf16(x) for x in gens])
+    assert S.size() == FroidurePin([Transf(x) for x in gens]).size() == 3125
+    assert S.generator(0) == HPCombiTransf16(gens[0])
+    assert S.generator(0)[15] == 15
+
+    S = FroidurePin([HPCombiPerm16([1, 0]), HPCombiPerm16([1, 2, 3, 4, 0])])
+    assert S.size() == 120
+
+
+def test_froidure_pin_memory_usage():
+    ReportGuard(False)
+    S = FroidurePin([Transf([1, 0, 2, 3]), Transf([1, 2, 3, 0]), Transf([0, 0, 2, 3])])
+    S.batch_size(16)
+    before = S.memory_usage()
+    assert set(before) == {
+        "elements",
+        "factorisations",
+        "left_cayley_graph",
+        "right_cayley_graph",
+        "total",
+    }
+    assert before["total"] == sum(v for k, v in before.items() if k != "total")
+
+    S.enumerate(32)
+    during = S.memory_usage()
+    assert S.current_size() < 256
+    assert during["right_cayley_graph"] == S.current_size() * 3 * 4
+
+    S.run()
+    after = S.memory_usage()
+    assert S.size() == 256
+    assert before["total"] < during["total"] < after["total"]
+    assert after["right_cayley_graph"] == after["left_cayley_graph"] == 256 * 3 * 4
+
+
+def test_froidure_pin_enumerate_parallel():
+    ReportGuard(False)
+    for gens in (
+        [Transf([1, 0, 2, 3, 4]), Transf([1, 2, 3, 4, 0]), Transf([0, 0, 2, 3, 4])],
+        [PPerm([0, 1, 2], [1, 2, 0], 4), PPerm([0, 1, 2], [0, 1, 3], 4)],
+        [Bipartition([[1, -2], [2, -1], [3, -3]]), Bipartition([[1, 2], [3, -3], [-1, -2]])],
+        [BMat8([[0, 1], [1, 0]]), BMat8([[1, 0], [1, 1]]), BMat8([[1, 0], [0, 0]])],
+    ):
+        S = FroidurePin(gens)
+        for n in (1, 2, 4):
+            elements, wg = froidure_pin.enumerate_parallel(gens, n)
+            assert elements == list(S)
+            assert wg == S.right_cayley_graph()
+
+    # Duplicate generators
+    gens = [Perm([1, 0, 2]), Perm([1, 2, 0]), Perm([1, 0, 2])]
+    elements, wg = froidure_pin.enumerate_parallel(gens, 2)
+    assert len(elements) == 6
+    assert wg == FroidurePin(gens).right_cayley_graph()
+
+    with pytest.raises(LibsemigroupsError):
+        froidure_pin.enumerate_parallel([Transf([0, 1]), Transf([0, 1, 2])])
+    with pytest.raises(LibsemigroupsError):
+        froidure_pin.enumerate_parallel(gens, 0)
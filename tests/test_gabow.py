@@ -10,9 +10,11 @@ libsemigroups_pybind11.
 
 # pylint: disable=missing-function-docstring
 
+import random
+
 import pytest
 
-from libsemigroups_pybind11 import Gabow, WordGraph, word_graph
+from libsemigroups_pybind11 import UNDEFINED, Gabow, WordGraph, word_graph
 
 
 @pytest.fixture(name="wg")
@@ -102,3 +104,51 @@ def test_gabow_return_policy(wg):
     assert g.reverse_spanning_forest() is g.reverse_spanning_forest()
     assert g.spanning_forest() is g.spanning_forest()
     assert g.word_graph() is g.word_graph()
+
+
+def test_gabow_component_ids(wg):
+    g = Gabow(wg)
+    assert g.component_ids().tolist() == [g.id(i) for i in range(17)]
+
+
+def _canonical_partition(ids):
+    lookup = {}
+    return [lookup.setdefault(x, len(lookup)) for x in ids]
+
+
+@pytest.mark.parametrize("number_of_threads", [1, 4])
+def test_word_graph_strongly_connected_components(number_of_threads):
+    rng = random.Random(31)
+    for n, m, density in ((1, 1, 0.5), (50, 2, 0.4), (200, 3, 0.2), (300, 2, 0.9)):
+        w = WordGraph(n, m)
+        for i in range(n):
+            for a in range(m):
+                if rng.random() < density:
+                    w.target(i, a, rng.randrange(n))
+        ids = word_graph.strongly_connected_components(w, number_of_threads)
+        g = Gabow(w)
+        assert ids.tolist() == _canonical_partition(g.id(i) for i in range(n))
+
+    assert len(word_graph.strongly_connected_components(WordGraph(0, 1), number_of_threads)) == 0
+
+
+@pytest.mark.parametrize("number_of_threads", [1, 4])
+def test_word_graph_strongly_connected_components_long_paths(number_of_threads):
+    # Each of these word graphs contains a path of length 10 ** 5, which would
+    # require a recursion of that depth.
+    n = 10**5
+
+    # A path with no cycles, so every node is a component
+    w = WordGraph(n, [[i + 1] for i in range(n - 1)] + [[UNDEFINED]])
+    ids = word_graph.strongly_connected_components(w, number_of_threads)
+    assert ids.tolist() == list(range(n))
+
+    # A cycle, so there is one component
+    w = WordGraph(n, [[(i - 1) % n] for i in range(n)])
+    ids = word_graph.strongly_connected_components(w, number_of_threads)
+    assert not ids.any()
+
+    # A path through the components {2k, 2k + 1}
+    w = WordGraph(n, [[min(i + 1, n - 1), i - i % 2] for i in range(n)])
+    ids = word_graph.strongly_connected_components(w, number_of_threads)
+    assert ids.tolist() == [i // 2 for i in range(n)]
@@ -8,9 +8,13 @@
 
 # pylint: disable=missing-function-docstring
 
+import numpy as np
+import pytest
+
 from libsemigroups_pybind11 import (
     POSITIVE_INFINITY,
     Kambites,
+    LibsemigroupsError,
     Presentation,
     ReportGuard,
     StringRange,
@@ -297,3 +301,42 @@ def test_kambites_return_policy():
     k = check_congruence_common_return_policy(Kambites)
 
     assert k.ukkonen() is k.ukkonen()
+
+
+def test_kambites_contains_batch_threads():
+    ReportGuard(False)
+    p = Presentation("abcdefg")
+    presentation.add_rule(p, "abcd", "aaaeaa")
+    presentation.add_rule(p, "ef", "dg")
+    k = Kambites(congruence_kind.twosided, p)
+    assert k.precompute() is k
+
+    words = ["abcd", "aaaeaa", "ef", "dg", "aaaaaef", "aaaaadg", "efababa", "dgababa", "a", "b"]
+    words += ["abcdef" * 3, "aaaeaadg" * 3, "g", ""]
+    letters = np.array([ord(x) for w in words for x in w], dtype=np.uint32)
+    offsets = np.cumsum([0] + [len(w) for w in words], dtype=np.uint64)
+    expected = [k.contains(words[i], words[i + 1]) for i in range(0, len(words), 2)]
+    assert expected[:4] == [True, True, True, True]
+    for threads in (1, 2, 3, 16):
+        copy = k.copy()
+        assert list(copy.contains_batch(letters, offsets, threads)) == expected
+    assert list(Kambites(congruence_kind.twosided, p).contains_batch(letters, offsets, 4)) == (
+        expected
+    )
+
+    # Without number_of_threads the overload taking only letters and offsets
+    # is used, with it the threaded one is used; both agree.
+    assert list(k.copy().contains_batch(letters, offsets)) == expected
+    assert list(k.copy().contains_batch(letters, offsets, number_of_threads=1)) == expected
+    assert list(k.copy().contains_batch(letters, offsets=offsets, number_of_threads=2)) == (
+        expected
+    )
+    pairs = [(words[i], words[i + 1]) for i in range(0, len(words), 2)]
+    assert list(k.copy().contains_batch(pairs)) == expected
+
+    with pytest.raises(LibsemigroupsError):
+        k.contains_batch(letters, offsets[:-1], 2)
+    q = Presentation("ab")
+    presentation.add_rule(q, "ab", "ba")
+    with pytest.raises(LibsemigroupsError):
+        Kambites(congruence_kind.twosided, q).precompute()
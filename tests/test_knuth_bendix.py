@@ -8,8 +8,11 @@
 
 # pylint: disable=missing-function-docstring
 
+import pickle
+from concurrent.futures import ThreadPoolExecutor
 from datetime import timedelta
 
+import numpy as np
 import pytest
 
 from _libsemigroups_pybind11 import Runner
@@ -360,3 +363,138 @@ def test_knuth_bendix_runner_state():
 #     assert k.presentation().alphabet() == p.alphabet()
 #     assert k.presentation().rules == p.rules
 #     assert list(k.active_rules()) == [(expected, "a")]
+
+
+def test_knuth_bendix_memory_usage():
+    ReportGuard(False)
+    p = Presentation("abc")
+    presentation.add_rule(p, "aaaa", "a")
+    presentation.add_rule(p, "bb", "b")
+    presentation.add_rule(p, "ab", "ba")
+    presentation.add_rule(p, "cc", "a")
+    for rewriter in ("RewriteFromLeft", "RewriteTrie"):
+        kb = KnuthBendix(congruence_kind.twosided, p, rewriter=rewriter)
+        before = kb.memory_usage()
+        assert set(before) == {"active_rules", "inactive_rules", "rewriter", "total"}
+        kb.run()
+        after = kb.memory_usage()
+        assert after["total"] == sum(v for k, v in after.items() if k != "total")
+        assert after["active_rules"] >= sum(len(u) + len(v) for u, v in kb.active_rules())
+        assert after["rewriter"] > 0
+        assert (kb.number_of_inactive_rules() == 0) == (after["inactive_rules"] == 0)
+
+
+def test_knuth_bendix_pickle():
+    ReportGuard(False)
+    for rewriter in ("RewriteFromLeft", "RewriteTrie"):
+        p = Presentation([0, 1])
+        presentation.add_rule(p, [0, 0, 0], [0])
+        presentation.add_rule(p, [1, 1], [1])
+        presentation.add_rule(p, [0, 1, 0, 1], [0, 0])
+        kb = KnuthBendix(congruence_kind.twosided, p, rewriter=rewriter)
+        kb.max_pending_rules(12).max_overlap(7)
+        kb.run()
+
+        copy_kb = pickle.loads(pickle.dumps(kb))
+        assert copy_kb is not kb
+        assert copy_kb.py_template_params == kb.py_template_params
+        assert copy_kb.presentation() == kb.presentation()
+        assert copy_kb.max_pending_rules() == 12
+        assert copy_kb.max_overlap() == 7
+        assert copy_kb.max_rules() == POSITIVE_INFINITY
+        assert copy_kb.overlap_policy() == kb.overlap_policy()
+        assert not copy_kb.started()
+        assert copy_kb.number_of_classes() == kb.number_of_classes()
+
+
+def test_knuth_bendix_batch():
+    ReportGuard(False)
+    for rewriter in ("RewriteFromLeft", "RewriteTrie"):
+        p = Presentation("ab")
+        presentation.add_rule(p, "aaa", "a")
+        presentation.add_rule(p, "bb", "b")
+        presentation.add_rule(p, "abab", "aa")
+        kb = KnuthBendix(congruence_kind.twosided, p, rewriter=rewriter)
+        words = ["", "a", "aaaaa", "abab", "bbbbab", "babba"]
+        assert kb.reduce_batch(words) == [kb.reduce(w) for w in words]
+        assert kb.reduce_batch([]) == []
+
+        pairs = [("aaa", "a"), ("abab", "aa"), ("a", "b"), ("bab", "babb")]
+        result = kb.contains_batch(pairs)
+        assert result.dtype == np.bool_
+        assert list(result) == [kb.contains(u, v) for u, v in pairs]
+
+        letters = np.array([ord(x) for x in "aaaaaabab"], dtype=np.uint32)
+        offsets = np.array([0, 5, 9], dtype=np.uint64)
+        nf_letters, nf_offsets = kb.reduce_batch(letters, offsets)
+        expected = [kb.reduce("aaaaa"), kb.reduce("abab")]
+        assert list(nf_offsets) == [0, len(expected[0]), len("".join(expected))]
+        assert "".join(chr(x) for x in nf_letters) == "".join(expected)
+        assert list(kb.contains_batch(letters, offsets)) == [
+            kb.contains("aaaaa", "abab")
+        ]
+
+        with pytest.raises(LibsemigroupsError):
+            kb.reduce_batch(letters, np.array([0, 5], dtype=np.uint64))
+        with pytest.raises(LibsemigroupsError):
+            kb.reduce_batch(letters, np.array([0, 6, 5, 9], dtype=np.uint64))
+        with pytest.raises(LibsemigroupsError):
+            kb.reduce_batch(letters, np.array([0, 100, 9], dtype=np.uint64))
+        with pytest.raises(LibsemigroupsError):
+            kb.reduce_batch(
+                np.array([ord("a"), 256 + ord("a")], dtype=np.uint32),
+                np.array([0, 2], dtype=np.uint64),
+            )
+        with pytest.raises(LibsemigroupsError):
+            kb.contains_batch(letters, np.array([0, 1, 5, 9], dtype=np.uint64))
+        with pytest.raises(LibsemigroupsError):
+            kb.reduce_batch(["abc"])
+
+
+def test_knuth_bendix_normal_forms_batches():
+    ReportGuard(False)
+    p = Presentation("ab")
+    presentation.add_rule(p, "aaa", "a")
+    presentation.add_rule(p, "bb", "b")
+    presentation.add_rule(p, "abab", "aa")
+    kb = KnuthBendix(congruence_kind.twosided, p)
+    expected = list(knuth_bendix.normal_forms(kb))
+    result = []
+    for letters, offsets in knuth_bendix.normal_forms_batches(kb, 3):
+        assert 0 < len(offsets) - 1 <= 3
+        result += [
+            "".join(chr(x) for x in letters[offsets[i] : offsets[i + 1]])
+            for i in range(len(offsets) - 1)
+        ]
+    assert result == expected
+
+    nf = knuth_bendix.normal_forms(kb)
+    letters, offsets = nf.next_batch(2)
+    assert len(offsets) == 3
+    assert "".join(chr(x) for x in letters) == "".join(expected[:2])
+    assert list(nf) == expected[2:]
+
+
+def test_knuth_bendix_threads():
+    ReportGuard(False)
+
+    def make(n, rewriter):
+        p = Presentation("abc")
+        presentation.add_rule(p, "a" * n, "")
+        presentation.add_rule(p, "bb", "")
+        presentation.add_rule(p, "cc", "")
+        presentation.add_rule(p, "abab", "")
+        presentation.add_rule(p, "acac", "")
+        return KnuthBendix(congruence_kind.twosided, p, rewriter=rewriter)
+
+    def gilman_graph(kb):
+        knuth_bendix.by_overlap_length(kb)
+        assert kb.confluent()
+        return kb.gilman_graph()
+
+    kbs = [make(n, r) for n in range(2, 6) for r in ("RewriteFromLeft", "RewriteTrie")]
+    with ThreadPoolExecutor(max_workers=len(kbs)) as executor:
+        word_graphs = list(executor.map(gilman_graph, kbs))
+    assert word_graphs == [
+        make(n, r).gilman_graph() for n in range(2, 6) for r in ("RewriteFromLeft", "RewriteTrie")
+    ]
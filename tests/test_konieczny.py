@@ -9,6 +9,7 @@
 
 # pylint: disable=missing-function-docstring, invalid-name
 
+from concurrent.futures import ThreadPoolExecutor
 from datetime import timedelta
 
 import pytest
@@ -427,3 +428,23 @@ def test_konieczny_return_policy():
     assert S.D_class_of_element(gens[0]) is S.D_class_of_element(gens[0])
     assert S.generator(0) is S.generator(0)
     assert S.D_class_of_element(gens[0]).rep() is S.D_class_of_element(gens[0]).rep()
+
+
+def test_konieczny_threads():
+    ReportGuard(False)
+    gens = [
+        [Transf([1, 0, 2, 3, 4]), Transf([1, 2, 3, 4, 0]), Transf([0, 0, 2, 3, 4])],
+        [
+            BMat8([[0, 1, 0, 0], [1, 0, 0, 0], [0, 0, 1, 0], [0, 0, 0, 1]]),
+            BMat8([[0, 1, 0, 0], [0, 0, 1, 0], [0, 0, 0, 1], [1, 0, 0, 0]]),
+            BMat8([[1, 0, 0, 0], [0, 1, 0, 0], [0, 0, 1, 0], [1, 0, 0, 1]]),
+            BMat8([[1, 0, 0, 0], [0, 1, 0, 0], [0, 0, 1, 0], [0, 0, 0, 0]]),
+        ],
+    ]
+
+    def number_of_D_classes(x):  # pylint: disable=invalid-name
+        return Konieczny(x).number_of_D_classes()
+
+    with ThreadPoolExecutor(max_workers=len(gens)) as executor:
+        threaded = list(executor.map(number_of_D_classes, gens))
+    assert threaded == [number_of_D_classes(x) for x in gens]
@@ -0,0 +1,53 @@
+# Copyright (c) 2024, J. D. Mitchell
+#
+# Distributed under the terms of the GPL license version 3.
+#
+# The full license is in the file LICENSE, distributed with this software.
+
+"""
+This module contains some tests for the lazily imported submodules of
+libsemigroups_pybind11.
+"""
+
+import subprocess
+import sys
+
+import pytest
+
+import libsemigroups_pybind11
+
+LAZY_SUBMODULES = ("action", "konieczny", "schreier_sims", "sims", "stephen")
+
+
+def test_lazy_submodules_not_imported():
+    # A fresh interpreter is required because the other tests import
+    # everything.
+    code = (
+        "import sys\n"
+        "import libsemigroups_pybind11\n"
+        f"print(*(m for m in {LAZY_SUBMODULES!r} "
+        "if f'libsemigroups_pybind11.{m}' in sys.modules))\n"
+    )
+    result = subprocess.run(
+        [sys.executable, "-c", code], capture_output=True, text=True, check=True
+    )
+    assert result.stdout.strip() == ""
+
+
+def test_lazy_names():
+    # pylint: disable=import-outside-toplevel
+    from libsemigroups_pybind11 import Konieczny, Sims1, Stephen, sims
+    from libsemigroups_pybind11.konieczny import Konieczny as _Konieczny
+
+    assert Konieczny is _Konieczny
+    assert Sims1 is libsemigroups_pybind11.Sims1
+    assert Stephen.__name__ == "Stephen"
+    assert sims is libsemigroups_pybind11.sims
+    assert callable(sims.poset)
+
+    names = dir(libsemigroups_pybind11)
+    for name in (*LAZY_SUBMODULES, "Action", "SchreierSims", "Sims2", "ToddCoxeter"):
+        assert name in names
+
+    with pytest.raises(AttributeError):
+        libsemigroups_pybind11.NotAThing  # pylint: disable=pointless-statement
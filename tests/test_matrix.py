@@ -10,9 +10,16 @@
 
 import copy
 
+import numpy as np
 import pytest
 
-from libsemigroups_pybind11 import Matrix, MatrixKind
+from libsemigroups_pybind11 import (
+    NEGATIVE_INFINITY,
+    LibsemigroupsError,
+    Matrix,
+    MatrixKind,
+    matrix,
+)
 
 
 @pytest.fixture(name="matrix_kinds")
@@ -171,3 +178,72 @@ def test_matrix_return_policy(matrix_kinds):
         assert x.transpose() is not x
         assert x.row(0) is not x.row(0)
         assert x.rows() is not x.rows()
+
+
+def _semiring_args(T):
+    if T in (MatrixKind.MaxPlusTrunc, MatrixKind.MinPlusTrunc):
+        return (11,)
+    if T == MatrixKind.NTP:
+        return (5, 7)
+    return ()
+
+
+def test_matrix_batch(matrix_kinds):
+    rows = [
+        [[0, 1, 1], [1, 0, 1], [1, 1, 1]],
+        [[1, 0, 0], [0, 0, 1], [0, 1, 0]],
+        [[0, 0, 1], [1, 0, 0], [1, 1, 0]],
+    ]
+    a = np.array(rows, dtype=np.int64)
+    b = a[::-1].copy()
+    for T in matrix_kinds:
+        args = _semiring_args(T)
+        if T == MatrixKind.ProjMaxPlus:
+            with pytest.raises(TypeError):
+                matrix.product_batch(T, a, b)
+            continue
+        xy = matrix.product_batch(T, a, b, *args)
+        x4 = matrix.pow_batch(T, a, 4, *args)
+        assert xy.shape == (3, 3, 3)
+        for i in range(3):
+            x, y = make_mat(T, rows[i]), make_mat(T, rows[2 - i])
+            assert xy[i].tolist() == list(x * y)
+            assert x4[i].tolist() == list(x**4)
+
+    with pytest.raises(LibsemigroupsError):
+        matrix.product_batch(MatrixKind.Boolean, a, a[:2])
+    with pytest.raises(LibsemigroupsError):
+        matrix.product_batch(MatrixKind.Boolean, a + 1, a)
+    with pytest.raises(LibsemigroupsError, match=r"shape \(k, n, n\), found .* shape \(3, 3\)"):
+        matrix.pow_batch(MatrixKind.Integer, a[0], 2)
+    with pytest.raises(LibsemigroupsError, match=r"shape \(3, 3, 2\)"):
+        matrix.pow_batch(MatrixKind.Integer, a[:, :, :2], 2)
+
+
+def test_matrix_closure():
+    a = np.array([[[0, 1, 0], [0, 0, 1], [0, 0, 0]]], dtype=np.int64)
+    assert matrix.closure(MatrixKind.Boolean, a).tolist() == [
+        [[1, 1, 1], [0, 1, 1], [0, 0, 1]]
+    ]
+    ninf = np.iinfo(np.int64).min
+    b = np.array([[[ninf, 2, ninf], [ninf, ninf, 3], [ninf, ninf, ninf]]])
+    c = matrix.closure(MatrixKind.MaxPlus, b)
+    assert c[0].tolist() == [[0, 2, 5], [ninf, 0, 3], [ninf, ninf, 0]]
+    x = Matrix(
+        MatrixKind.MaxPlus,
+        [
+            [NEGATIVE_INFINITY, 2, NEGATIVE_INFINITY],
+            [NEGATIVE_INFINITY, NEGATIVE_INFINITY, 3],
+            [NEGATIVE_INFINITY, NEGATIVE_INFINITY, NEGATIVE_INFINITY],
+        ],
+    )
+    assert matrix.product_batch(MatrixKind.MaxPlus, b, b)[0, 0, 2] == 5
+    assert (x * x)[0, 2] == 5
+
+    b[0, 2, 0] = 1
+    with pytest.raises(LibsemigroupsError):
+        matrix.closure(MatrixKind.MaxPlus, b)
+    c = matrix.closure(MatrixKind.MaxPlusTrunc, np.array([[[1]]]), 11)
+    assert c.tolist() == [[[11]]]
+    with pytest.raises(TypeError):
+        matrix.closure(MatrixKind.Integer, a)
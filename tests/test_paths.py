@@ -12,6 +12,7 @@ libsemigroups_pybind11.
 
 import sys
 
+import numpy as np
 import pytest
 
 from libsemigroups_pybind11 import (
@@ -159,3 +160,43 @@ def test_paths_number_of_paths():
     assert (
         paths.number_of_paths_algorithm(wg, 2, 2, 10, POSITIVE_INFINITY) == paths.algorithm.trivial
     )
+
+
+def test_paths_number_of_paths_all():
+    wg = WordGraph(4, [[0, 1], [1, 0], [2]])
+    for n in (1, 3):
+        for mn, mx in ((0, 10), (2, 10), (0, 0), (3, 4), (5, 40)):
+            result = paths.number_of_paths_all(wg, mn, mx, n)
+            assert result.dtype == np.uint64
+            assert result.tolist() == [paths.number_of_paths(wg, v, mn, mx) for v in range(4)]
+    assert paths.number_of_paths_all(wg).tolist() == [POSITIVE_INFINITY] * 3 + [1]
+
+    # Counts that don't fit in 64 bits
+    result = paths.number_of_paths_all(wg, 0, 70)
+    assert result.dtype == object
+    assert result.tolist() == [2**70 - 1, 2**70 - 1, 70, 1]
+
+    # Acyclic word graph, min and max = POSITIVE_INFINITY
+    wg = WordGraph(4, [[1, 2], [2, 3], [3], []])
+    assert paths.number_of_paths_all(wg).tolist() == [
+        paths.number_of_paths(wg, v) for v in range(4)
+    ]
+    assert paths.number_of_paths_all(wg, 2).tolist() == [
+        paths.number_of_paths(wg, v, 2, POSITIVE_INFINITY) for v in range(4)
+    ]
+
+
+def test_paths_take():
+    wg = WordGraph(3, [[1, 2], [2, 0], [0, 1]])
+    p = Paths(wg).source(0).max(6)
+    expected = list(p.copy())
+    chunks = []
+    while not p.at_end():
+        letters, offsets = p.take(7)
+        assert letters.dtype == np.uint32 and offsets.dtype == np.uint64
+        chunks += [letters[offsets[i] : offsets[i + 1]].tolist() for i in range(len(offsets) - 1)]
+    assert chunks == expected
+    letters, offsets = p.take(7)
+    assert len(letters) == 0 and offsets.tolist() == [0]
+    with pytest.raises(LibsemigroupsError):
+        Paths(wg).take(1)
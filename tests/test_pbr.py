@@ -12,7 +12,7 @@ from copy import copy
 
 import pytest
 
-from libsemigroups_pybind11 import PBR, pbr
+from libsemigroups_pybind11 import PBR, LibsemigroupsError, pbr
 
 
 def test_ops():
@@ -104,3 +104,18 @@ def test_pbr_return_policy():
     x = PBR([[0, 1, 2]] * 6)
 
     assert x.copy() is not x
+
+
+def test_pbr_batch():
+    xs = [PBR([[0, 1, 2]] * 6), pbr.one(3), PBR([[3], [], [4, 5], [0], [1], [2]])]
+    ys = [pbr.one(3), PBR([[3], [], [4, 5], [0], [1], [2]]), PBR([[0, 1, 2]] * 6)]
+    a, b = pbr.to_array(xs), pbr.to_array(ys)
+    assert a.shape == (3, 6, 6)
+    assert a.dtype == bool
+    assert pbr.from_array(a) == xs
+    assert pbr.from_array(pbr.product_batch(a, b)) == [x * y for x, y in zip(xs, ys)]
+
+    with pytest.raises(LibsemigroupsError):
+        pbr.product_batch(a, b[:2])
+    with pytest.raises(LibsemigroupsError):
+        pbr.to_array([xs[0], pbr.one(2)])
@@ -10,7 +10,10 @@
 # pylint: disable=comparison-with-callable, too-many-lines
 
 import copy
+import pickle
+from itertools import product
 
+import numpy as np
 import pytest
 
 from libsemigroups_pybind11 import (
@@ -885,6 +888,94 @@ def test_greedy_reduce_length_and_number_of_gens_030():
     assert p2 == q2
 
 
+def test_add_rules_packed():
+    letters = np.array([0, 0, 0, 1, 1, 0, 1, 0, 1], dtype=np.uint32)
+    offsets = np.array([0, 3, 3, 5, 6, 9, 9])
+    p = presentation.from_packed([0, 1], letters, offsets)
+    assert p.alphabet() == [0, 1]
+    assert p.rules == [[0, 0, 0], [], [1, 1], [0], [1, 0, 1], []]
+
+    q = Presentation("ab")
+    presentation.add_rule(q, "aa", "b")
+    presentation.add_rules_packed(q, np.frombuffer(b"abba", dtype=np.uint8), [0, 2, 4])
+    assert q.rules == ["aa", "b", "ab", "ba"]
+    r = presentation.from_packed("ab", np.frombuffer(b"aab", dtype=np.uint8), [0, 2, 3])
+    assert r.alphabet() == "ab"
+    assert r.rules == ["aa", "b"]
+
+    with pytest.raises(LibsemigroupsError):
+        presentation.add_rules_packed(q, np.frombuffer(b"abc", dtype=np.uint8), [0, 2, 3])
+    with pytest.raises(LibsemigroupsError):
+        presentation.add_rules_packed(q, letters, [0, 3, 5, 9])
+    with pytest.raises(LibsemigroupsError):
+        presentation.add_rules_packed(q, np.frombuffer(b"abb", dtype=np.uint8), [0, 2])
+    with pytest.raises(LibsemigroupsError):
+        presentation.from_packed([0, 0], letters, offsets)
+    assert q.rules == ["aa", "b", "ab", "ba"]
+
+
+def test_save_load(tmp_path):
+    p = examples.symmetric_group_Moo97_a(5)
+    q = Presentation("abc")
+    q.contains_empty_word(True)
+    presentation.add_rule(q, "abca", "")
+    presentation.add_rule(q, "bb", "c")
+    for x in (p, q, Presentation([0, 1]), Presentation("")):
+        path = tmp_path / "p.bin"
+        presentation.save(x, path)
+        y = presentation.load(path)
+        assert y == x
+        assert y.alphabet() == x.alphabet()
+        assert y.contains_empty_word() == x.contains_empty_word()
+        letters, offsets = presentation.to_packed(x)
+        assert presentation.from_packed(x.alphabet(), letters, offsets).rules == x.rules
+
+    with open(tmp_path / "bad.bin", "wb") as file:
+        file.write(b"\0" * 64)
+    with pytest.raises(ValueError):
+        presentation.load(tmp_path / "bad.bin")
+    with pytest.raises(ValueError):
+        presentation.load(__file__)
+
+
+def test_greedy_reduce_length_with_timings():
+    # The steps must reproduce greedy_reduce_length(_and_number_of_gens)
+    # exactly, so compare the two on several presentations
+    presentations = (
+        ("ab", ["aaaaaaaaaaaaaaaa", "a", "bbbbbbbbbbbbbbbb", "b", "abb", "baa"]),
+        ("ab", ["aaaaaa", "a", "bbbbbb", "b", "abb", "baa"]),
+        ("abc", ["abcabcabcabc", "a", "acbacbacb", "c", "bcbcbcbc", "aa"]),
+        ("abc", ["aaaa", "a", "bbb", "b", "ccc", "c", "abababab", "ab", "acacacac", "ca"]),
+        ("ab", ["abaabaabaaba" * 2, "b", "baabbaab", "abbaabba"]),
+        ("abcd", ["abcdabcd", "dcba", "abcd", "bcda", "ddcc", "ccdd"]),
+        ("ab", ["ab", "ba"]),
+    )
+    for (alphabet, rules), reduce_gens in product(presentations, (False, True)):
+        p = Presentation(alphabet)
+        p.rules = rules
+        q = p.copy()
+        steps = presentation.greedy_reduce_length_with_timings(p, reduce_gens)
+        if reduce_gens:
+            presentation.greedy_reduce_length_and_number_of_gens(q)
+        else:
+            presentation.greedy_reduce_length(q)
+        assert p == q
+        assert len(steps) == len(p.alphabet()) - len(alphabet)
+        for w, _, _, secs in steps:
+            assert isinstance(w, str) and len(w) > 1
+            assert secs >= 0
+        if steps:
+            assert steps[-1][1:3] == (presentation.length(p), len(p.alphabet()))
+            assert [x[1] for x in steps] == sorted((x[1] for x in steps), reverse=True)
+
+    p = Presentation([0, 1])
+    presentation.add_rule(p, [0, 0, 0, 0, 0, 0], [0])
+    presentation.add_rule(p, [1, 1, 1, 1, 1, 1], [1])
+    steps = presentation.greedy_reduce_length_with_timings(p)
+    assert all(isinstance(w, list) for w, *_ in steps)
+    assert presentation.longest_subword_reducing_length(p) == []
+
+
 def test_longest_shortest_rule_031():
     check_longest_rule(to_word)
     check_longest_rule(to_string)
@@ -1349,3 +1440,22 @@ def test_presentation_try_detect_inverses():
     p.alphabet("abcdef")
     p.rules = ["ab", "", "ba", "", "cd", "", "dc", "", "e", "ef"]
     assert presentation.try_detect_inverses(p) == ("dcba", "cdab")
+
+
+def test_presentation_pickle():
+    for alphabet in ("abc", [0, 1, 2]):
+        p = Presentation(alphabet)
+        p.contains_empty_word(True)
+        presentation.add_rule(p, alphabet[:2], alphabet[2:])
+        presentation.add_rule(p, alphabet[1:], alphabet[:1])
+        q = pickle.loads(pickle.dumps(p))
+        assert q is not p
+        assert q == p
+        assert q.py_template_params == p.py_template_params
+        assert q.contains_empty_word()
+
+        ip = InversePresentation(p)
+        ip.inverses(alphabet[::-1])
+        iq = pickle.loads(pickle.dumps(ip))
+        assert iq.rules == ip.rules
+        assert iq.inverses() == ip.inverses()
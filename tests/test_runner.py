@@ -8,11 +8,22 @@
 arising from runner.*pp in libsemigroups.
 """
 
+import _thread
+import threading
 from datetime import datetime, timedelta
 
 import pytest
 
-from libsemigroups_pybind11 import Reporter
+from libsemigroups_pybind11 import (
+    KnuthBendix,
+    Presentation,
+    ProgressRecord,
+    Reporter,
+    ReportGuard,
+    ToddCoxeter,
+    congruence_kind,
+    record_progress,
+)
 
 
 def test_reporter_000():
@@ -44,3 +55,91 @@ def test_reporter_000():
     assert s.report_every() == timedelta(seconds=1)
 
     assert s.report_every() == timedelta(seconds=1)
+
+
+def test_runner_releases_gil():
+    """Check that run does not block other threads, so that kill can be
+    called while run is in progress."""
+    ReportGuard(False)
+    p = Presentation("ab")
+    # The free monoid on 2 generators is infinite, so this never finishes
+    tc = ToddCoxeter(congruence_kind.twosided, p)
+    thread = threading.Thread(target=tc.run)
+    thread.start()
+    while not tc.running():
+        pass
+    tc.kill()
+    thread.join(timeout=10)
+    assert not thread.is_alive()
+    assert tc.dead()
+    assert not tc.finished()
+
+
+def test_runner_run_until_interrupted():
+    """Check that a signal received during run_until_interrupted stops the
+    runner and raises."""
+    ReportGuard(False)
+    p = Presentation("ab")
+    tc = ToddCoxeter(congruence_kind.twosided, p)
+    timer = threading.Timer(0.1, _thread.interrupt_main)
+    timer.start()
+    with pytest.raises(KeyboardInterrupt):
+        tc.run_until_interrupted(timedelta(milliseconds=1))
+    timer.join()
+    assert tc.stopped_by_predicate()
+    assert not tc.finished()
+    assert not tc.dead()
+
+    p = Presentation("ab")
+    p.rules = ["aa", "a", "bb", "b", "ab", "ba"]
+    tc = ToddCoxeter(congruence_kind.twosided, p)
+    tc.run_until_interrupted()
+    assert tc.finished()
+    assert tc.number_of_classes() == 3
+
+
+def test_record_progress():
+    """Check that record_progress samples the statistics of a runner while it
+    runs, and stops with it."""
+    ReportGuard(False)
+    p = Presentation("ab")
+    tc = ToddCoxeter(congruence_kind.twosided, p)
+    seen = []
+    records = record_progress(
+        tc,
+        every=timedelta(milliseconds=10),
+        callback=seen.append,
+        time_limit=timedelta(milliseconds=100),
+    )
+    assert seen == records
+    assert len(records) >= 2
+    assert all(isinstance(r, ProgressRecord) for r in records)
+    assert all(x.time <= y.time for x, y in zip(records, records[1:]))
+    assert records[0].state == "running_for"
+    assert records[-1].state == tc.current_state().name
+    assert tc.timed_out()
+    assert set(records[-1].stats) == {"nodes_active", "large_collapses"}
+    assert records[-1].stats["nodes_active"] == tc.number_of_nodes_active()
+    assert not tc.finished()
+
+    p.rules = ["aa", "a", "bb", "b", "ab", "ba"]
+    kb = KnuthBendix(congruence_kind.twosided, p)
+    records = record_progress(kb)
+    assert kb.finished()
+    assert records[-1].stats["rules_active"] == kb.number_of_active_rules()
+
+    with pytest.raises(ValueError):
+        record_progress(kb, every=timedelta(0))
+
+
+def test_record_progress_callback_raises():
+    """Check that an exception raised by the callback kills the runner."""
+    ReportGuard(False)
+    tc = ToddCoxeter(congruence_kind.twosided, Presentation("ab"))
+
+    def callback(_):
+        raise RuntimeError("stop!")
+
+    with pytest.raises(RuntimeError):
+        record_progress(tc, every=timedelta(milliseconds=10), callback=callback)
+    assert tc.dead()
@@ -14,6 +14,7 @@
 
 from copy import copy
 
+import numpy as np
 import pytest
 
 from libsemigroups_pybind11 import LibsemigroupsError, Perm, ReportGuard, SchreierSims
@@ -512,6 +513,35 @@ def test_SchreierSims_Perm2(checks_with_int):
         check(511)
 
 
+@pytest.mark.parametrize("n, dtype", [(255, np.uint8), (511, np.uint16)])
+def test_SchreierSims_contains_many(n, dtype):
+    ReportGuard(False)
+    gens = [
+        Perm([1, 0, 2, 3, 4, 5] + list(range(6, n))),
+        Perm([1, 2, 3, 4, 0, 5] + list(range(6, n))),
+    ]
+    S = SchreierSims(gens)
+
+    rng = np.random.default_rng(1)
+    a = np.tile(np.arange(n, dtype=dtype), (200, 1))
+    for row in a:
+        row[:6] = rng.permutation(6)
+    a[0, 0] = a[0, 1]
+
+    expected = [False] + [S.contains(Perm(list(row))) for row in a[1:]]
+    for number_of_threads in (1, 3):
+        assert S.contains_many(a, number_of_threads).tolist() == expected
+    assert any(expected) and not all(expected)
+
+    with pytest.raises(LibsemigroupsError):
+        S.contains_many(a[:, :-1])
+    with pytest.raises(LibsemigroupsError):
+        S.contains_many(a[0])
+    a[1, 0] = n
+    with pytest.raises(LibsemigroupsError):
+        S.contains_many(a)
+
+
 def test_SchreierSims_return_policy():
     gens = [
         Perm([0, 2, 4, 6, 7, 3, 8, 1, 5] + list(range(9, 511))),
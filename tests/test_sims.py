@@ -11,7 +11,9 @@ arising from sims.*pp in libsemigroups.
 # pylint: disable=missing-function-docstring, invalid-name
 
 import os
+import threading
 
+import numpy as np
 import pytest
 
 from libsemigroups_pybind11 import (
@@ -333,6 +335,18 @@ def test_sims1_004():
 
     assert d.number_of_nodes() == 7
 
+    for searches in (1, 3, 16):
+        d = orc.number_of_threads(1).concurrent_word_graph(searches)
+        assert d.number_of_nodes() == 7
+
+    ro = RepOrc(word=list[int])
+    ro.presentation(p).target_size(15).min_nodes(1).max_nodes(16)
+    d = ro.concurrent_word_graph(4)
+    assert 7 <= d.number_of_nodes() <= 16
+    assert ro.min_nodes(8).max_nodes(7).concurrent_word_graph(4).number_of_nodes() == 0
+    with pytest.raises(LibsemigroupsError):
+        ro.concurrent_word_graph(0)
+
 
 @pytest.mark.quick
 def test_sims_refiner_faithful_128():
@@ -397,6 +411,152 @@ def test_sims1_902():
     assert s.number_of_threads(8).number_of_congruences(2) == 67
 
 
+def test_sims1_batches():
+    ReportGuard(False)
+    p = Presentation([0, 1])
+    p.contains_empty_word(True)
+    presentation.add_rule(p, [0, 0, 0], [0])
+    presentation.add_rule(p, [1, 1], [1])
+    presentation.add_rule(p, [0, 1, 0, 1], [0])
+    s = Sims1(p)
+
+    def targets(wg):
+        num = word_graph.number_of_nodes_reachable_from(wg, 0)
+        return tuple(tuple(wg.target(x, a) for a in range(2)) for x in range(num))
+
+    expected = sorted(targets(wg) for wg in s.iterator(5))
+    for threads in (1, 2, 4):
+        for batch_size in (1, 4, 100):
+            result = []
+            for tgts, offsets in s.number_of_threads(threads).batches(5, batch_size):
+                assert tgts.dtype == np.uint32
+                assert 0 < len(offsets) - 1 <= batch_size
+                for i in range(len(offsets) - 1):
+                    table = tgts[offsets[i] : offsets[i + 1]].reshape(-1, 2)
+                    result.append(tuple(tuple(int(x) for x in row) for row in table))
+            assert sorted(result) == expected
+
+    it = s.number_of_threads(1).batches(5, 1)
+    assert len(next(it)[1]) == 2
+    del it
+
+    with pytest.raises(LibsemigroupsError):
+        s.batches(0)
+    with pytest.raises(LibsemigroupsError):
+        s.batches(5, 0)
+
+
+def test_sims_congruence_lattice():
+    ReportGuard(False)
+    p = Presentation([0, 1])
+    p.contains_empty_word(True)
+    presentation.add_rule(p, [0, 0, 0], [0])
+    presentation.add_rule(p, [1, 1], [1])
+    presentation.add_rule(p, [0, 1, 0, 1], [0])
+
+    q = Presentation([0, 1])
+    presentation.add_rule(q, [0, 1], [1, 0])
+
+    for s, n in ((Sims1(p), 5), (Sims2(q), 3)):
+        s.number_of_threads(1)
+        mat = sims.poset(s, n)
+        m = s.number_of_congruences(n)
+        expected = [[i, j] for i in range(m) for j in range(m) if mat[i, j]]
+        for threads in (1, 2, 4):
+            graphs, covers = sims.congruence_lattice(s, n, threads)
+            assert covers.dtype == np.uint32
+            assert covers.shape == (len(expected), 2)
+            assert covers.tolist() == expected
+            assert len(graphs) == m
+            for wg, x in zip(graphs, s.iterator(n)):
+                num = word_graph.number_of_nodes_reachable_from(x, 0)
+                assert wg.number_of_nodes() == num
+                assert wg == x.induced_subgraph(0, num)
+
+        # With a multi-threaded search the order of the congruences may vary,
+        # but the lattice is the same up to renumbering.
+        expected_graphs, _ = sims.congruence_lattice(s, n)
+        graphs, covers = sims.congruence_lattice(s.copy().number_of_threads(4), n, 2)
+        assert sorted(graphs) == sorted(expected_graphs)
+        pos = {expected_graphs.index(wg): i for i, wg in enumerate(graphs)}
+        assert sorted([pos[i], pos[j]] for i, j in expected) == covers.tolist()
+
+    with pytest.raises(LibsemigroupsError):
+        sims.congruence_lattice(Sims1(p), 0)
+    with pytest.raises(LibsemigroupsError):
+        sims.congruence_lattice(Sims1(word=list[int]), 5)
+
+
+def test_sims_pruner():
+    ReportGuard(False)
+    p = Presentation([0, 1])
+    p.contains_empty_word(True)
+    presentation.add_rule(p, [0, 0, 0], [0])
+    presentation.add_rule(p, [1, 1], [1])
+    presentation.add_rule(p, [0, 1, 0, 1], [0])
+    n = 5
+
+    def num_nodes(wg):
+        return word_graph.number_of_nodes_reachable_from(wg, 0)
+
+    def contains(wg, u, v):
+        return word_graph.follow_path(wg, 0, u) == word_graph.follow_path(wg, 0, v)
+
+    def is_transitive(wg):
+        m = num_nodes(wg)
+        return all(0 in word_graph.nodes_reachable_from(wg, x) for x in range(m))
+
+    all_wgs = [wg.copy() for wg in Sims1(p).iterator(n)]
+    for pruner, pred in [
+        (sims.max_nodes_pruner(3), lambda wg: num_nodes(wg) <= 3),
+        (sims.contains_pair_pruner([0], [1]), lambda wg: contains(wg, [0], [1])),
+        (sims.transitive_pruner(), is_transitive),
+        (
+            sims.max_nodes_pruner(2) | sims.contains_pair_pruner([0, 1], [1]),
+            lambda wg: num_nodes(wg) <= 2 or contains(wg, [0, 1], [1]),
+        ),
+        (
+            sims.max_nodes_pruner(4) & sims.transitive_pruner(),
+            lambda wg: num_nodes(wg) <= 4 and is_transitive(wg),
+        ),
+    ]:
+        expected = sum(1 for wg in all_wgs if pred(wg))
+        assert [pruner(wg) for wg in all_wgs] == [pred(wg) for wg in all_wgs]
+        for threads in (1, 4):
+            s = Sims1(p).number_of_threads(threads).add_pruner(pruner)
+            assert s.number_of_congruences(n) == expected
+
+    assert repr(sims.max_nodes_pruner(3) & sims.transitive_pruner()) == (
+        "<SimsPruner (max_nodes_pruner(3) & transitive_pruner())>"
+    )
+    with pytest.raises(LibsemigroupsError):
+        sims.number_of_components_pruner(2, 1)
+
+    ip = sims.refiner_pruner(SimsRefinerIdeals(p))
+    assert Sims1(p).add_pruner(ip).number_of_congruences(n) == (
+        Sims1(p).add_pruner(SimsRefinerIdeals(p)).number_of_congruences(n)
+    )
+
+
+def test_sims1_stats_while_running():
+    ReportGuard(False)
+    p = Presentation([0, 1])
+    p.contains_empty_word(True)
+    presentation.add_rule(p, [0, 1], [1, 0])
+    s = Sims1(p).number_of_threads(2)
+
+    result = []
+    thread = threading.Thread(target=lambda: result.append(s.number_of_congruences(7)))
+    thread.start()
+    snapshots = []
+    while thread.is_alive():
+        snapshots.append(s.stats().total_pending_now())
+    thread.join()
+    assert result[0] > 0
+    assert snapshots == sorted(snapshots)
+    assert all(x <= s.stats().total_pending_now() for x in snapshots)
+
+
 def test_sims2_901():
     ReportGuard(False)
     p = Presentation([0, 1])
@@ -11,7 +11,7 @@ arising from stephen.*pp in libsemigroups.
 # pylint: disable=missing-function-docstring, invalid-name, too-many-lines
 
 from functools import cmp_to_key
-from itertools import islice
+from itertools import islice, product
 
 import pytest
 
@@ -29,6 +29,7 @@ from libsemigroups_pybind11 import (
     congruence_kind,
     lexicographical_compare,
     presentation,
+    random_words,
     stephen,
     todd_coxeter,
     word_graph,
@@ -1583,3 +1584,62 @@ def test_stephen_return_policy():
     assert S.init(p) is S
     assert S.set_word([0, 1]) is S
     assert S.word_graph() is S.word_graph()
+
+
+@pytest.mark.quick
+def test_stephen_batch():
+    ReportGuard(False)
+    p = Presentation([0, 1])
+    presentation.add_rule(p, [0, 0, 0], [0])
+    presentation.add_rule(p, [1, 1, 1], [1])
+    presentation.add_rule(p, [0, 1, 0, 1], [0, 0])
+    s = Stephen(p)
+    s.set_word([1, 1, 0, 1])
+
+    letters, offsets = random_words(300, 0, 9, 2, 42)
+    words = [letters[offsets[i] : offsets[i + 1]].tolist() for i in range(300)]
+    for n in (1, 4):
+        acc = stephen.accepts_batch(s, letters, offsets, n)
+        lf = stephen.is_left_factor_batch(s, letters, offsets, n)
+        assert acc.tolist() == [stephen.accepts(s, w) for w in words]
+        assert lf.tolist() == [stephen.is_left_factor(s, w) for w in words]
+    assert not (acc & ~lf).any()
+
+    letters[0] = 2
+    with pytest.raises(LibsemigroupsError):
+        stephen.accepts_batch(s, letters, offsets)
+    with pytest.raises(LibsemigroupsError):
+        stephen.is_left_factor_batch(s, letters, offsets[:-1])
+
+
+@pytest.mark.quick
+def test_stephen_prefix_cache():
+    ReportGuard(False)
+    p = Presentation([0, 1])
+    presentation.add_rule(p, [0, 0, 0], [0])
+    presentation.add_rule(p, [1, 1, 1], [1])
+    presentation.add_rule(p, [0, 1, 0, 1], [0, 0])
+    cache = stephen.PrefixCache(p)
+
+    others = [list(v) for n in range(5) for v in product([0, 1], repeat=n)]
+    for n in range(1, 6):
+        for w in product([0, 1], repeat=n):
+            w = list(w)
+            s = Stephen(p)
+            s.set_word(w).run()
+            t = cache(w)
+            assert t.word() == w
+            assert t.finished()
+            assert t == s
+            assert [stephen.accepts(t, v) for v in others] == [
+                stephen.accepts(s, v) for v in others
+            ]
+
+    s = cache([0, 1, 1])
+    assert cache([0, 1, 1, 0, 1]).word() == [0, 1, 1, 0, 1]
+    assert cache([0, 1, 1]) is s
+    assert cache([1]) is not s
+    assert cache([0, 1, 1]) is not s
+
+    with pytest.raises(LibsemigroupsError):
+        cache([0, 2])
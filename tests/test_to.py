@@ -31,6 +31,7 @@ from libsemigroups_pybind11 import (
     InversePresentation,
     Kambites,
     KnuthBendix,
+    LibsemigroupsError,
     Presentation,
     ReportGuard,
     ToddCoxeter,
@@ -615,6 +616,32 @@ def test_to_Presentation_029():
     check_froidure_pin_to_pres(list[int])
 
 
+# Consuming the argument
+
+
+@pytest.mark.parametrize("Word", [str, list[int]])
+def test_to_Presentation_consume(Word):
+    for Return in (str, list[int]):
+        p = sample_pres(Word)
+        expected = to(p, rtype=(Presentation, Return))
+        q = to(p, rtype=(Presentation, Return), consume=True)
+        assert q == expected
+        assert len(p.alphabet()) == 0
+        assert p.rules == []
+
+    p = sample_pres(Word)
+    p.rules = p.rules + (["c", "a"] if Word is str else [[2], [0]])
+    copy = p.copy()
+    with pytest.raises(LibsemigroupsError):
+        to(p, rtype=(Presentation, Word), consume=True)
+    assert p == copy
+
+    with pytest.raises(TypeError):
+        to(p, rtype=(Presentation,), consume=True)
+    with pytest.raises(TypeError):
+        to(p, rtype=(ToddCoxeter, Word), consume=True)
+
+
 ###############################################################################
 # InversePresentation
 ###############################################################################
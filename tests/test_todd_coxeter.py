@@ -8,18 +8,23 @@
 
 # pylint: disable=missing-function-docstring, invalid-name
 
+import pickle
+from concurrent.futures import ThreadPoolExecutor
 from datetime import timedelta
 
+import numpy as np
 import pytest
 
 from libsemigroups_pybind11 import (
     UNDEFINED,
     FroidurePin,
+    LibsemigroupsError,
     Order,
     Presentation,
     ReportGuard,
     ToddCoxeter,
     Transf,
+    WordGraph,
     WordRange,
     congruence_kind,
     froidure_pin,
@@ -315,6 +320,31 @@ def test_096():
         assert word_graph.is_compatible(wg, 0, wg.number_of_nodes(), lhs, rhs)
 
 
+def test_todd_coxeter_memory_usage():
+    ReportGuard(False)
+    p = Presentation("ab")
+    p.contains_empty_word(True)
+    presentation.add_rule(p, "aaaa", "")
+    presentation.add_rule(p, "bbb", "")
+    presentation.add_rule(p, "abab", "")
+    tc = ToddCoxeter(congruence_kind.twosided, p)
+    tc.strategy(strategy.hlt)
+    before = tc.memory_usage()
+    assert set(before) == {"active_nodes", "inactive_nodes", "total"}
+    assert before["total"] == before["active_nodes"] + before["inactive_nodes"]
+
+    assert tc.number_of_classes() == 24
+    during = tc.memory_usage()
+    per_node = (3 * 2 + 3) * 4
+    assert during["total"] == tc.current_word_graph().number_of_nodes() * per_node
+    assert during["active_nodes"] == tc.number_of_nodes_active() * per_node
+
+    tc.shrink_to_fit()
+    after = tc.memory_usage()
+    assert after["inactive_nodes"] == 0
+    assert after["total"] == after["active_nodes"] <= during["total"]
+
+
 def test_redundant_rule():
     p = Presentation("ab")
     p.rules = ["aaa", "a", "bbbb", "b", "abab", "aaaaaa"]
@@ -413,3 +443,122 @@ def test_todd_coxeter_return_policy():
 
     assert tc.spanning_tree() is tc.spanning_tree()
     assert tc.word_graph() is tc.word_graph()
+
+
+def test_todd_coxeter_pickle():
+    ReportGuard(False)
+    p = Presentation("ab")
+    presentation.add_rule(p, "aaa", "a")
+    presentation.add_rule(p, "bb", "b")
+    presentation.add_rule(p, "abab", "aa")
+    tc = ToddCoxeter(congruence_kind.onesided, p)
+    tc.add_generating_pair("ab", "a")
+    tc.strategy(strategy.felsch).lookahead_min(1234).save(True)
+    tc.run()
+
+    copy_tc = pickle.loads(pickle.dumps(tc))
+    assert copy_tc is not tc
+    assert copy_tc.kind() == congruence_kind.onesided
+    assert copy_tc.presentation() == tc.presentation()
+    assert copy_tc.generating_pairs() == ["ab", "a"]
+    assert copy_tc.strategy() == strategy.felsch
+    assert copy_tc.lookahead_min() == 1234
+    assert copy_tc.save()
+    assert not copy_tc.started()
+    assert copy_tc.number_of_classes() == tc.number_of_classes()
+
+
+def test_todd_coxeter_pickle_word_graph():
+    ReportGuard(False)
+    wg = WordGraph(4, [[1, 2], [3, 1], [2, 3], [3, 3]])
+    tc = ToddCoxeter(congruence_kind.onesided, wg)
+    tc.add_generating_pair([0], [1])
+
+    copy_tc = pickle.loads(pickle.dumps(tc))
+    assert copy_tc.kind() == congruence_kind.onesided
+    assert copy_tc.current_word_graph() == wg
+    assert copy_tc.generating_pairs() == [[0], [1]]
+    assert copy_tc.number_of_classes() == tc.number_of_classes()
+
+    with pytest.raises(LibsemigroupsError):
+        pickle.dumps(tc)
+
+
+def test_todd_coxeter_pickle_not_finished():
+    ReportGuard(False)
+    p = Presentation([0])
+    presentation.add_rule(p, [0, 0, 0, 0, 0, 0, 0, 0], [0])
+    tc = ToddCoxeter(congruence_kind.onesided, p)
+    tc.run_until(lambda: tc.currently_contains([0, 0, 0, 0, 0, 0, 0, 0], [0]) == tril.true)
+    assert not tc.finished()
+    with pytest.raises(LibsemigroupsError):
+        pickle.dumps(tc)
+    tc.run()
+    assert pickle.loads(pickle.dumps(tc)).number_of_classes() == tc.number_of_classes()
+
+
+def test_todd_coxeter_batch():
+    ReportGuard(False)
+    p = Presentation([0, 1])
+    presentation.add_rule(p, [0, 0, 0], [0])
+    presentation.add_rule(p, [1, 1], [1])
+    presentation.add_rule(p, [0, 1, 0, 1], [0, 0])
+    tc = ToddCoxeter(congruence_kind.twosided, p)
+    words = [[0, 0, 0, 0], [1, 0, 1, 1], [0, 1, 0, 1, 0], [1]]
+    assert tc.reduce_batch(words) == [tc.reduce(w) for w in words]
+
+    pairs = [([0, 0, 0], [0]), ([0], [1]), ([0, 1, 0, 1], [0, 0])]
+    assert list(tc.contains_batch(pairs)) == [True, False, True]
+
+    letters = np.array([x for w in words for x in w], dtype=np.uint32)
+    offsets = np.cumsum([0] + [len(w) for w in words], dtype=np.uint64)
+    nf_letters, nf_offsets = tc.reduce_batch(letters, offsets)
+    assert [
+        list(nf_letters[nf_offsets[i] : nf_offsets[i + 1]]) for i in range(len(words))
+    ] == [tc.reduce(w) for w in words]
+    assert list(tc.contains_batch(letters, offsets)) == [
+        tc.contains(words[0], words[1]),
+        tc.contains(words[2], words[3]),
+    ]
+
+
+def test_todd_coxeter_normal_forms_batches():
+    ReportGuard(False)
+    p = Presentation([0, 1])
+    presentation.add_rule(p, [0, 0, 0], [0])
+    presentation.add_rule(p, [1, 1], [1])
+    presentation.add_rule(p, [0, 1, 0, 1], [0, 0])
+    tc = ToddCoxeter(congruence_kind.twosided, p)
+    expected = list(todd_coxeter.normal_forms(tc))
+    for n in (1, 2, len(expected), len(expected) + 1):
+        result = []
+        for letters, offsets in todd_coxeter.normal_forms_batches(tc, n):
+            assert 0 < len(offsets) - 1 <= n
+            result += [
+                list(letters[offsets[i] : offsets[i + 1]])
+                for i in range(len(offsets) - 1)
+            ]
+        assert result == expected
+    with pytest.raises(LibsemigroupsError):
+        todd_coxeter.normal_forms_batches(tc, 0)
+
+
+def test_todd_coxeter_threads():
+    ReportGuard(False)
+
+    def make(n):
+        p = Presentation([0, 1])
+        presentation.add_rule(p, [0] * n, [])
+        presentation.add_rule(p, [1, 1], [])
+        presentation.add_rule(p, [0, 1] * 3, [])
+        return ToddCoxeter(congruence_kind.twosided, p)
+
+    def lookahead_then_word_graph(tc):
+        tc.run_for(timedelta(microseconds=10))
+        tc.perform_lookahead(False)
+        return tc.word_graph()
+
+    tcs = [make(n) for n in range(3, 9)]
+    with ThreadPoolExecutor(max_workers=len(tcs)) as executor:
+        word_graphs = list(executor.map(lookahead_then_word_graph, tcs))
+    assert word_graphs == [make(n).word_graph() for n in range(3, 9)]
@@ -12,18 +12,23 @@ permutations.
 
 import copy
 
+import numpy as np
 import pytest
 
-from libsemigroups_pybind11 import UNDEFINED
+from libsemigroups_pybind11 import UNDEFINED, LibsemigroupsError
 from libsemigroups_pybind11.transf import (
     Perm,
     PPerm,
     Transf,
     domain,
     image,
+    image_batch,
     inverse,
+    inverse_batch,
     left_one,
     one,
+    product_batch,
+    rank_batch,
     right_one,
 )
 
@@ -300,3 +305,42 @@ def test_transf_return_policy():
         assert x.copy() is not x
         assert x.images() is not x.images()
         assert x.increase_degree_by(2) is x
+
+
+def test_transf_batch():
+    xs = [[0, 0, 2, 2, 0, 1], [5, 4, 3, 2, 1, 0], [1, 1, 1, 1, 1, 1]]
+    ys = [[1, 2, 3, 4, 5, 0], [0, 0, 2, 2, 0, 1], [3, 2, 1, 0, 5, 4]]
+    for dtype in (np.uint8, np.uint16, np.uint32):
+        a, b = np.array(xs, dtype=dtype), np.array(ys, dtype=dtype)
+        xy = product_batch(a, b)
+        assert xy.dtype == dtype
+        assert xy.tolist() == [list((Transf(x) * Transf(y)).images()) for x, y in zip(xs, ys)]
+        assert rank_batch(a).tolist() == [Transf(x).rank() for x in xs]
+        im = image_batch(a)
+        assert [list(np.flatnonzero(r)) for r in im] == [image(Transf(x)) for x in xs]
+
+    p = np.array([[5, 2, 0, 1, 3, 4, 6]], dtype=np.uint16)
+    assert inverse_batch(p).tolist() == [list(inverse(Perm(p[0].tolist())).images())]
+    assert product_batch(p, inverse_batch(p)).tolist() == [list(range(7))]
+
+    with pytest.raises(LibsemigroupsError):
+        inverse_batch(np.array(xs, dtype=np.uint8))
+    with pytest.raises(LibsemigroupsError):
+        product_batch(np.array([[0, 6]], dtype=np.uint8), np.array([[0, 1]], dtype=np.uint8))
+    with pytest.raises(LibsemigroupsError):
+        product_batch(np.array(xs, dtype=np.uint8), np.array(ys[:2], dtype=np.uint8))
+
+
+def test_pperm_batch():
+    u = 255
+    f = PPerm([0, 1, 3], [2, 0, 1], 4)
+    a = np.array([[2, 0, u, 1]], dtype=np.uint8)
+    assert inverse_batch(a, partial=True).tolist() == [[1, 3, 0, u]]
+    assert [UNDEFINED if x == u else x for x in inverse_batch(a, True)[0]] == list(
+        inverse(f).images()
+    )
+    assert product_batch(a, a, partial=True).tolist() == [[u, 2, u, 0]]
+    assert rank_batch(a, partial=True).tolist() == [3]
+    assert image_batch(a, True).tolist() == [[True, True, True, False]]
+    with pytest.raises(LibsemigroupsError):
+        product_batch(a, a)
@@ -17,6 +17,7 @@ from libsemigroups_pybind11 import (
     UNDEFINED,
     LibsemigroupsError,
     Ukkonen,
+    random_words,
     ukkonen,
 )
 
@@ -396,3 +397,47 @@ def test_ukkonen_return_policy():
 
     st, _ = ukkonen.traverse(kknn, [1, 2, 3, 5])
     assert kknn.is_suffix(st) == UNDEFINED
+
+
+def test_ukkonen_add_words_batch():
+    letters, offsets = random_words(500, 0, 12, 3, 17)
+    words = [letters[offsets[i] : offsets[i + 1]].tolist() for i in range(500)]
+
+    u, v = Ukkonen(), Ukkonen()
+    ukkonen.add_words_batch(u, letters, offsets)
+    ukkonen.add_words(v, words)
+    assert u.number_of_words() == v.number_of_words()
+    assert u.number_of_distinct_words() == v.number_of_distinct_words()
+    assert u.length_of_distinct_words() == v.length_of_distinct_words()
+    assert ukkonen.number_of_distinct_subwords(u) == ukkonen.number_of_distinct_subwords(v)
+    assert all(ukkonen.is_subword(u, w) for w in words)
+
+    with pytest.raises(LibsemigroupsError):
+        ukkonen.add_words_batch(u, letters, offsets[:-1])
+
+
+def test_ukkonen_memory_usage_and_compact_arrays():
+    u = Ukkonen()
+    ukkonen.add_words(u, ["aaeaaa", "abcd", "bcda"])
+    nodes = u.nodes()
+    arrays = ukkonen.compact_arrays(u)
+    assert len(arrays["l"]) == len(nodes)
+    assert len(arrays["child_offsets"]) == len(nodes) + 1
+    assert arrays["child_offsets"][-1] == len(arrays["child_nodes"])
+    for i, n in enumerate(nodes):
+        assert arrays["l"][i] == n.l
+        assert arrays["r"][i] == n.r
+        assert arrays["parent"][i] == (2**32 - 1 if n.is_root() else n.parent)
+        first, last = arrays["child_offsets"][i], arrays["child_offsets"][i + 1]
+        letters = arrays["child_letters"][first:last].tolist()
+        assert letters == sorted(n.children)
+        assert arrays["child_nodes"][first:last].tolist() == [n.children[x] for x in letters]
+
+    before = u.memory_usage()
+    assert set(before) == {"nodes", "children", "word", "words", "total"}
+    assert before["total"] > sum(v for k, v in before.items() if k != "total")
+    ukkonen.add_word(u, "abcdefghijklmnop")
+    after = u.memory_usage()
+    assert after["total"] > before["total"]
+    assert after["words"] > before["words"]
+    assert sum(a.nbytes for a in arrays.values()) < before["total"]
@@ -11,7 +11,10 @@ libsemigroups_pybind11.
 # pylint: disable= missing-function-docstring
 
 import copy
+import io
+import pickle
 
+import numpy as np
 import pytest
 
 from _libsemigroups_pybind11 import LIBSEMIGROUPS_EIGEN_ENABLED
@@ -24,13 +27,12 @@ from libsemigroups_pybind11 import (
     MatrixKind,
     Meeter,
     Order,
+    Presentation,
     WordGraph,
+    presentation,
     word_graph,
 )
 
-if LIBSEMIGROUPS_EIGEN_ENABLED:
-    import numpy as np
-
 
 @pytest.fixture(name="word_graphs")
 def word_graph_fixture():
@@ -108,6 +110,62 @@ def test_adjacency_matrix(word_graphs):
         )
 
 
+def test_array(word_graphs):
+    for wg in word_graphs:
+        arr = np.asarray(wg)
+        assert arr.dtype == np.uint32
+        assert arr.shape == (wg.number_of_nodes(), wg.out_degree())
+        for s in wg.nodes():
+            for a in range(wg.out_degree()):
+                if wg.target(s, a) == UNDEFINED:
+                    assert arr[s, a] == np.iinfo(np.uint32).max
+                else:
+                    assert arr[s, a] == wg.target(s, a)
+        assert WordGraph(arr) == wg
+
+    wg = WordGraph(3, 2)
+    wg.target(0, 1, 2)
+    arr = np.asarray(wg)
+    assert arr[0, 0] == np.iinfo(np.uint32).max
+    assert arr[0, 1] == 2
+    assert WordGraph(arr) == wg
+    assert np.asarray(wg, dtype=np.int64)[0, 1] == 2
+    with pytest.raises(ValueError):
+        np.asarray(wg, copy=False)
+
+    with pytest.raises(LibsemigroupsError):
+        WordGraph(np.array([[0, 2], [1, 0]], dtype=np.uint32))
+    with pytest.raises(LibsemigroupsError):
+        WordGraph(np.array([0, 1], dtype=np.uint32))
+
+
+def test_pickle(word_graphs):
+    for wg in word_graphs:
+        assert pickle.loads(pickle.dumps(wg)) == wg
+    wg = WordGraph(0, 3)
+    assert pickle.loads(pickle.dumps(wg)).out_degree() == 3
+
+
+def test_save_load(word_graphs, tmp_path):
+    path = tmp_path / "wg.bin"
+    for wg in (*word_graphs, WordGraph(0, 3)):
+        word_graph.save(wg, path)
+        assert word_graph.load(path) == wg
+        assert word_graph.load(path).out_degree() == wg.out_degree()
+        targets = word_graph.load_targets(path)
+        assert targets.dtype == np.uint32
+        assert not targets.flags.writeable
+        assert (targets == np.asarray(wg)).all()
+
+    presentation.save(Presentation("ab"), path)
+    with pytest.raises(ValueError):
+        word_graph.load(path)
+    with open(path, "wb") as file:
+        file.write(b"abc")
+    with pytest.raises(ValueError):
+        word_graph.load_targets(path)
+
+
 def test_equal_to(word_graphs):
     wg1, wg2 = word_graphs
     assert wg1 != wg2
@@ -250,6 +308,126 @@ def test_standardize(word_graphs):
     assert f == word_graph.spanning_tree(wg1, 0)
 
 
+def test_canonical_form_and_fingerprint():
+    x = WordGraph(3, [[2, 0], [1, 1], [1, 0]])
+    y = WordGraph(3, [[1, 0], [2, 0], [2, 2]])
+    for wg in (x, y):
+        assert word_graph.canonical_form(wg) == y
+    assert word_graph.canonical_form(y) is not y
+    assert word_graph.fingerprint(x) == word_graph.fingerprint(y)
+    assert 0 <= word_graph.fingerprint(x) < 2**128
+
+    # Nodes not reachable from 0 are removed
+    z = WordGraph(4, [[3, UNDEFINED], [0, 0], [1, 1], [0, 3]])
+    assert word_graph.canonical_form(z) == WordGraph(2, [[1, UNDEFINED], [0, 1]])
+    assert word_graph.canonical_form(WordGraph(0, 2)) == WordGraph(0, 2)
+    assert word_graph.fingerprint(z) != word_graph.fingerprint(x)
+    assert word_graph.fingerprint(WordGraph(0, 1)) != word_graph.fingerprint(WordGraph(0, 2))
+
+    graphs = [x, y, z]
+    for n in (1, 2):
+        assert word_graph.canonical_form_batch(graphs, n) == [
+            word_graph.canonical_form(wg) for wg in graphs
+        ]
+        assert word_graph.fingerprint_batch(graphs, n) == [
+            word_graph.fingerprint(wg) for wg in graphs
+        ]
+    with pytest.raises(LibsemigroupsError):
+        word_graph.fingerprint_batch([x, None])
+
+
+def test_canonical_dict_and_set():
+    x = WordGraph(3, [[2, 0], [1, 1], [1, 0]])
+    y = WordGraph(3, [[1, 0], [2, 0], [2, 2]])
+    z = WordGraph(2, [[1, UNDEFINED], [0, 1]])
+
+    d = word_graph.CanonicalDict()
+    d[x] = 1
+    d[y] = 2
+    assert len(d) == 1
+    assert d[x] == 2
+    assert x in d and z not in d and 0 not in d
+    assert list(d) == [y]
+    with pytest.raises(KeyError):
+        d[z]  # pylint: disable=pointless-statement
+    d.update_batch([z, x, z], ["a", "b", "c"], 2)
+    assert dict(d.items()) == {y: "b", z: "c"}
+    del d[x]
+    assert list(d) == [z]
+    with pytest.raises(ValueError):
+        d.update_batch([x], [])
+
+    s = word_graph.CanonicalSet([x, y, z, x], number_of_threads=2)
+    assert len(s) == 2
+    assert x in s and y in s and z in s
+    s.discard(y)
+    s.discard(y)
+    assert list(s) == [z]
+    s.add(x)
+    assert len(s | word_graph.CanonicalSet([y])) == 2
+
+
+def test_write(tmp_path):
+    wg = WordGraph(4, [[1, 2], [0, 3], [2, 2], [3, UNDEFINED]])
+
+    f = io.BytesIO()
+    word_graph.write(wg, f)
+    assert f.getvalue().decode() == str(word_graph.dot(wg))
+
+    path = tmp_path / "wg.dot"
+    word_graph.write(wg, path)
+    assert path.read_bytes() == f.getvalue()
+
+    path = tmp_path / "wg.edges"
+    word_graph.write(wg, str(path), "edges")
+    edges = np.fromfile(path, dtype="<u4").reshape(-1, 3)
+    assert edges.tolist() == [
+        [0, 0, 1],
+        [0, 1, 2],
+        [1, 0, 0],
+        [1, 1, 3],
+        [2, 0, 2],
+        [2, 1, 2],
+        [3, 0, 3],
+    ]
+
+    word_graph.write(wg, path, "edges", nodes=[2, 0])
+    assert np.fromfile(path, dtype="<u4").reshape(-1, 3).tolist() == [
+        [0, 1, 2],
+        [2, 0, 2],
+        [2, 1, 2],
+    ]
+    # The components of wg are {0, 1}, {2}, and {3}
+    word_graph.write(wg, path, "edges", components=[0])
+    assert np.fromfile(path, dtype="<u4").reshape(-1, 3).tolist() == [[0, 0, 1], [1, 0, 0]]
+    word_graph.write(wg, path, "edges", nodes=[3], components=[1])
+    assert np.fromfile(path, dtype="<u4").reshape(-1, 3).tolist() == [
+        [2, 0, 2],
+        [2, 1, 2],
+        [3, 0, 3],
+    ]
+
+    f = io.BytesIO()
+    word_graph.write(wg, f, "graphml", nodes=[0, 1])
+    graphml = f.getvalue().decode()
+    assert graphml.count("<node ") == 2
+    assert '<edge source="n0" target="n1"><data key="label">0</data></edge>' in graphml
+    assert graphml.endswith("</graphml>\n")
+
+    with pytest.raises(LibsemigroupsError):
+        word_graph.write(wg, io.BytesIO(), "svg")
+    with pytest.raises(LibsemigroupsError):
+        word_graph.write(wg, io.BytesIO(), nodes=[4])
+
+    # Invalid arguments do not truncate an existing file
+    contents = path.read_bytes()
+    with pytest.raises(LibsemigroupsError):
+        word_graph.write(wg, path, "svg")
+    with pytest.raises(LibsemigroupsError):
+        word_graph.write(wg, str(path), nodes=[4])
+    assert path.read_bytes() == contents
+
+
 def test_topological_sort(word_graphs):
     wg1, _ = word_graphs
     assert word_graph.topological_sort(wg1) == []
@@ -294,6 +472,32 @@ def test_joiner(word_graphs):
     assert join.is_subrelation(wg2, wg1)
 
 
+@pytest.mark.parametrize("cls", [Meeter, Joiner])
+def test_meeter_joiner_batch(cls):
+    graphs = [
+        WordGraph(2, [[1, 0], [1, 0]]),
+        WordGraph(2, [[1, 1], [1, 1]]),
+        WordGraph(3, [[1, 2], [1, 2], [1, 2]]),
+        WordGraph(1, [[0, 0]]),
+        WordGraph(3, [[1, UNDEFINED], [2, 0], [0, 1]]),
+    ]
+    pairs = np.array([(i, j) for i in range(5) for j in range(5)])
+    op = cls()
+    for n in (1, 3):
+        subrel = op.is_subrelation_batch(graphs, pairs, n)
+        assert subrel.tolist() == [op.is_subrelation(graphs[i], graphs[j]) for i, j in pairs]
+        result = op.call_batch(graphs, pairs, n)
+        assert result == [op(graphs[i], graphs[j]) for i, j in pairs]
+
+    assert len(op.call_batch(graphs, np.zeros((0, 2), dtype=np.uint64))) == 0
+    with pytest.raises(LibsemigroupsError):
+        op.is_subrelation_batch(graphs, np.array([[0, 5]]))
+    with pytest.raises(LibsemigroupsError):
+        op.call_batch(graphs, np.array([0, 1]))
+    with pytest.raises(LibsemigroupsError):
+        op.call_batch(graphs + [WordGraph(1, 1)], np.array([[0, 5]]))
+
+
 def test_str(word_graphs):
     wg1, wg2 = word_graphs
     assert str(wg1) == "WordGraph(5, [[1], [2], [3], [4], [0]])"
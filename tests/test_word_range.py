@@ -8,6 +8,7 @@
 
 """This module contains some tests for the functionality in words."""
 
+import numpy as np
 import pytest
 
 from libsemigroups_pybind11 import (
@@ -21,6 +22,7 @@ from libsemigroups_pybind11 import (
     random_string,
     random_strings,
     random_word,
+    random_words,
 )
 from libsemigroups_pybind11.words import (
     human_readable_index,
@@ -65,6 +67,33 @@ def test_random_strings():
         assert len(s) == 5
 
 
+def test_random_words():
+    letters, offsets = random_words(1000, 2, 7, 3, seed=1, stream_id=5)
+    assert letters.dtype == np.uint32
+    assert len(offsets) == 1001
+    assert offsets[0] == 0 and offsets[-1] == len(letters)
+    assert all(2 <= offsets[i + 1] - offsets[i] < 7 for i in range(1000))
+    assert set(letters) == {0, 1, 2}
+
+    for n in (2, 3, 8):
+        other = random_words(1000, 2, 7, 3, seed=1, stream_id=5, number_of_threads=n)
+        assert np.array_equal(letters, other[0])
+        assert np.array_equal(offsets, other[1])
+    assert not np.array_equal(letters, random_words(1000, 2, 7, 3, seed=1, stream_id=6)[0])
+    assert not np.array_equal(letters, random_words(1000, 2, 7, 3, seed=2, stream_id=5)[0])
+
+    letters, offsets = random_words(10, 0, 1, 0, seed=0)
+    assert len(letters) == 0
+    assert list(offsets) == [0] * 11
+
+    with pytest.raises(LibsemigroupsError):
+        random_words(10, 3, 3, 2, seed=0)
+    with pytest.raises(LibsemigroupsError):
+        random_words(10, 0, 3, 0, seed=0)
+    with pytest.raises(LibsemigroupsError):
+        random_words(10, 0, 3, 2, seed=0, number_of_threads=0)
+
+
 def test_range_lex():
     wr, sr = WordRange(), StringRange()
     wr.alphabet_size(4).last([3, 3, 3]).upper_bound(4).order(Order.lex)
@@ -231,6 +260,46 @@ def test_StringRange_000():
     ]
 
 
+def test_WordRange_take_fill_skip():
+    words = WordRange().alphabet_size(3).min(0).max(6)
+    expected = list(words.copy())
+
+    wr = words.copy()
+    letters, offsets = wr.take(10)
+    assert letters.dtype == np.uint32
+    assert offsets.dtype == np.uint64
+    assert [list(letters[offsets[i] : offsets[i + 1]]) for i in range(10)] == expected[:10]
+    assert wr.get() == expected[10]
+
+    letters = np.zeros(9, dtype=np.uint32)
+    offsets = np.zeros(6, dtype=np.uint64)
+    assert wr.fill(letters, offsets) == 4
+    assert list(offsets[:5]) == [0, 2, 4, 6, 9]
+    assert [list(letters[offsets[i] : offsets[i + 1]]) for i in range(4)] == expected[10:14]
+    assert wr.get() == expected[14]
+    with pytest.raises(TypeError):
+        wr.fill(letters.astype(np.int64), offsets)
+
+    for order in (Order.shortlex, Order.lex):
+        wr = words.copy().order(order).upper_bound(6)
+        expected = list(wr.copy())
+        for n in (0, 1, 5, 17, 100, len(expected) - 1):
+            assert list(wr.copy().skip(n)) == expected[n:]
+        assert wr.copy().skip(len(expected)).at_end()
+        assert wr.copy().skip(10**9).at_end()
+
+
+def test_StringRange_take_skip():
+    strings = StringRange().alphabet("xyz").first("y").last("xxxxx")
+    expected = list(strings.copy())
+    letters, offsets = strings.copy().skip(7).take(5)
+    assert [
+        "".join(chr(x) for x in letters[offsets[i] : offsets[i + 1]]) for i in range(5)
+    ] == expected[7:12]
+    assert list(strings.copy().skip(30)) == expected[30:]
+    assert strings.copy().skip(len(expected)).at_end()
+
+
 def test_parse_relations():
     assert parse_relations("cd(ab)^2ef") == "cdababef"
     assert parse_relations("cd((ab)^2)^4ef") == "cdababababababababef"